@@ -0,0 +1,324 @@
+#include "AsyncLog.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace asynclog
+{
+    namespace
+    {
+        static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "RING_CAPACITY는 2의 거듭제곱");
+
+        // 스레드 하나가 쓰고 drain 스레드 하나가 읽는 링
+        struct Ring
+        {
+            std::array<Record, RING_CAPACITY> records;
+            alignas(64) std::atomic<uint32_t> head{0}; // 생산자만 증가
+            alignas(64) std::atomic<uint32_t> tail{0}; // drain 스레드만 증가
+            std::atomic<uint64_t> dropped{0};
+            std::atomic<bool> owned{true}; // 스레드 종료 시 false → 비면 다른 스레드가 재사용
+        };
+
+        struct State
+        {
+            std::mutex mutex; // rings 목록, 출력 대상 보호 (생산자 경로에서는 링 등록 시에만)
+            std::vector<std::unique_ptr<Ring>> rings;
+            std::FILE *out = stdout;
+
+            std::condition_variable drained;
+            uint64_t drainPass = 0;
+
+            std::thread worker;
+            std::atomic<bool> running{false};
+        };
+
+        void drainLoop();
+        void shutdown();
+
+        // 종료 시점 정적 소멸 순서와 무관하도록 해제하지 않음 (atexit에서 drain 스레드만 정리)
+        State &state()
+        {
+            static State *s = []
+            {
+                auto *created = new State();
+                created->running = true;
+                created->worker = std::thread(drainLoop);
+                std::atexit(shutdown);
+                return created;
+            }();
+            return *s;
+        }
+
+        // 스레드 종료 시 링 반납
+        struct ThreadRing
+        {
+            Ring *ring = nullptr;
+            uint32_t pending = 0; // acquire 후 commit 전 head
+
+            ~ThreadRing()
+            {
+                if (ring)
+                    ring->owned.store(false, std::memory_order_release);
+            }
+        };
+
+        thread_local ThreadRing threadRing;
+
+        Ring *attachRing()
+        {
+            State &s = state();
+            std::lock_guard<std::mutex> lock(s.mutex);
+            for (auto &ring : s.rings)
+            {
+                if (!ring->owned.load(std::memory_order_acquire) &&
+                    ring->head.load(std::memory_order_acquire) == ring->tail.load(std::memory_order_acquire))
+                {
+                    ring->owned.store(true, std::memory_order_relaxed);
+                    return ring.get();
+                }
+            }
+            s.rings.push_back(std::make_unique<Ring>());
+            return s.rings.back().get();
+        }
+
+        const char *levelTag(Level level)
+        {
+            switch (level)
+            {
+            case Level::Debug:
+                return "D";
+            case Level::Info:
+                return "I";
+            case Level::Warn:
+                return "W";
+            case Level::Error:
+                return "E";
+            }
+            return "?";
+        }
+
+        // "{}" 자리마다 다음 인자 값을 채움 (인자가 모자라면 "{}" 그대로)
+        void format(const Record &r, std::string &line)
+        {
+            char buf[64];
+            const std::time_t sec = static_cast<std::time_t>(r.timeNs / 1000000000ull);
+            std::tm tm{};
+            localtime_r(&sec, &tm);
+            const size_t n = std::strftime(buf, sizeof(buf), "%H:%M:%S", &tm);
+            line.append(buf, n);
+            std::snprintf(buf, sizeof(buf), ".%03u [%s] ", static_cast<unsigned>(r.timeNs / 1000000ull % 1000), levelTag(r.level));
+            line.append(buf);
+
+            const uint8_t *p = r.payload;
+            const uint8_t *end = r.payload + r.payloadSize;
+            for (const char *f = r.format; *f != '\0'; ++f)
+            {
+                if (f[0] != '{' || f[1] != '}' || p >= end)
+                {
+                    line.push_back(*f);
+                    continue;
+                }
+                ++f;
+
+                const ArgType type = static_cast<ArgType>(*p++);
+                switch (type)
+                {
+                case ArgType::Int:
+                {
+                    int64_t v;
+                    std::memcpy(&v, p, sizeof(v));
+                    p += sizeof(v);
+                    line.append(buf, std::snprintf(buf, sizeof(buf), "%lld", static_cast<long long>(v)));
+                    break;
+                }
+                case ArgType::Uint:
+                {
+                    uint64_t v;
+                    std::memcpy(&v, p, sizeof(v));
+                    p += sizeof(v);
+                    line.append(buf, std::snprintf(buf, sizeof(buf), "%llu", static_cast<unsigned long long>(v)));
+                    break;
+                }
+                case ArgType::Double:
+                {
+                    double v;
+                    std::memcpy(&v, p, sizeof(v));
+                    p += sizeof(v);
+                    line.append(buf, std::snprintf(buf, sizeof(buf), "%.3f", v));
+                    break;
+                }
+                case ArgType::Str:
+                {
+                    const size_t len = *p++;
+                    line.append(reinterpret_cast<const char *>(p), len);
+                    p += len;
+                    break;
+                }
+                default:
+                    p = end;
+                    break;
+                }
+            }
+            line.push_back('\n');
+        }
+
+        // 모든 링의 쌓인 레코드를 시간순으로 출력, 출력한 개수 반환
+        size_t drainOnce(std::vector<Ring *> &rings, std::vector<const Record *> &batch, std::string &text,
+                         uint64_t &reportedDrops)
+        {
+            State &s = state();
+            {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                rings.clear();
+                for (auto &ring : s.rings)
+                    rings.push_back(ring.get());
+            }
+
+            batch.clear();
+            std::vector<uint32_t> heads(rings.size());
+            uint64_t drops = 0;
+            for (size_t i = 0; i < rings.size(); ++i)
+            {
+                Ring &ring = *rings[i];
+                heads[i] = ring.head.load(std::memory_order_acquire);
+                for (uint32_t t = ring.tail.load(std::memory_order_relaxed); t != heads[i]; ++t)
+                    batch.push_back(&ring.records[t & (RING_CAPACITY - 1)]);
+                drops += ring.dropped.load(std::memory_order_relaxed);
+            }
+
+            std::stable_sort(batch.begin(), batch.end(),
+                             [](const Record *a, const Record *b) { return a->timeNs < b->timeNs; });
+
+            text.clear();
+            for (const Record *r : batch)
+                format(*r, text);
+            if (drops != reportedDrops)
+            {
+                text += "[asynclog] 링 포화로 버린 로그 " + std::to_string(drops - reportedDrops) + "건\n";
+                reportedDrops = drops;
+            }
+
+            // 포맷이 끝난 뒤에야 슬롯을 생산자에게 돌려줌
+            for (size_t i = 0; i < rings.size(); ++i)
+                rings[i]->tail.store(heads[i], std::memory_order_release);
+
+            if (!text.empty())
+            {
+                std::lock_guard<std::mutex> lock(s.mutex);
+                std::fwrite(text.data(), 1, text.size(), s.out);
+                std::fflush(s.out);
+            }
+            return batch.size();
+        }
+
+        void drainLoop()
+        {
+            State &s = state();
+            std::vector<Ring *> rings;
+            std::vector<const Record *> batch;
+            std::string text;
+            uint64_t reportedDrops = 0;
+
+            while (true)
+            {
+                const bool running = s.running.load(std::memory_order_acquire);
+                const size_t written = drainOnce(rings, batch, text, reportedDrops);
+                {
+                    std::lock_guard<std::mutex> lock(s.mutex);
+                    ++s.drainPass;
+                }
+                s.drained.notify_all();
+                if (!running)
+                    break;
+                if (written == 0)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        }
+
+        void shutdown()
+        {
+            State &s = state();
+            s.running.store(false, std::memory_order_release);
+            if (s.worker.joinable())
+                s.worker.join();
+        }
+    }
+
+    bool setFile(const std::string &path)
+    {
+        std::FILE *next = stdout;
+        if (!path.empty())
+        {
+            next = std::fopen(path.c_str(), "a");
+            if (next == nullptr)
+            {
+                std::fprintf(stderr, "[asynclog] 로그 파일 열기 실패: %s\n", path.c_str());
+                return false;
+            }
+        }
+
+        flush();
+        State &s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        if (s.out != stdout)
+            std::fclose(s.out);
+        s.out = next;
+        return true;
+    }
+
+    void flush()
+    {
+        State &s = state();
+        std::unique_lock<std::mutex> lock(s.mutex);
+        if (!s.running.load(std::memory_order_acquire))
+            return;
+        // 호출 전에 적재된 레코드를 확실히 포함하려면 지금 시작하는 패스가 끝날 때까지 (2패스)
+        const uint64_t target = s.drainPass + 2;
+        s.drained.wait(lock, [&]
+                       { return s.drainPass >= target || !s.running.load(std::memory_order_acquire); });
+    }
+
+    uint64_t dropped()
+    {
+        State &s = state();
+        std::lock_guard<std::mutex> lock(s.mutex);
+        uint64_t total = 0;
+        for (auto &ring : s.rings)
+            total += ring->dropped.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    namespace detail
+    {
+        Record *acquire()
+        {
+            ThreadRing &tr = threadRing;
+            if (tr.ring == nullptr)
+                tr.ring = attachRing();
+
+            Ring &ring = *tr.ring;
+            const uint32_t head = ring.head.load(std::memory_order_relaxed);
+            if (head - ring.tail.load(std::memory_order_acquire) >= RING_CAPACITY)
+            {
+                ring.dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            tr.pending = head;
+            return &ring.records[head & (RING_CAPACITY - 1)];
+        }
+
+        void commit()
+        {
+            ThreadRing &tr = threadRing;
+            tr.ring->head.store(tr.pending + 1, std::memory_order_release);
+        }
+    }
+}
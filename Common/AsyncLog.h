@@ -0,0 +1,169 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// 비동기 바이너리 로거 (LC, MFR, Simulator 공용)
+//
+// - 호출 스레드는 포맷 문자열 포인터 + 인자를 고정 크기 레코드로 자기 스레드 전용 링(SPSC)에 적재만 한다
+//   (락, 문자열 조립, 시스템 콜 없음). 링이 가득 차면 기다리지 않고 버리고 개수만 센다.
+// - 백그라운드 drain 스레드가 모든 링을 시간순으로 모아 "{}" 자리에 인자를 채워 출력한다.
+// - 레벨은 컴파일 시 ASYNCLOG_MIN_LEVEL(0=Debug, 1=Info, 2=Warn, 3=Error) 미만이면 호출 자체가 사라진다.
+//
+// 포맷 문자열은 문자열 리터럴만 받는다 (drain 스레드가 나중에 읽으므로 수명이 프로그램 전체여야 함).
+// 문자열 인자는 레코드 안에 복사되며 남은 공간만큼 잘린다.
+
+#ifndef ASYNCLOG_MIN_LEVEL
+#define ASYNCLOG_MIN_LEVEL 1
+#endif
+
+namespace asynclog
+{
+    enum class Level : uint8_t
+    {
+        Debug = 0,
+        Info = 1,
+        Warn = 2,
+        Error = 3,
+    };
+
+    constexpr Level MIN_LEVEL = static_cast<Level>(ASYNCLOG_MIN_LEVEL);
+
+    constexpr size_t RECORD_SIZE = 256;
+    constexpr size_t RING_CAPACITY = 1024; // 스레드당 레코드 수 (2의 거듭제곱)
+
+    struct Record
+    {
+        uint64_t timeNs;    // system_clock epoch ns
+        const char *format; // 문자열 리터럴
+        Level level;
+        uint8_t argCount;
+        uint16_t payloadSize;
+        uint8_t payload[RECORD_SIZE - 20];
+    };
+    static_assert(sizeof(Record) == RECORD_SIZE, "Record는 고정 크기여야 함");
+
+    // 인자 태그 (payload: [tag u8][값])
+    enum class ArgType : uint8_t
+    {
+        Int,    // int64
+        Uint,   // uint64
+        Double, // double
+        Str,    // [len u8][bytes]
+    };
+
+    // 출력 대상 파일 (빈 문자열이면 stdout). 열기 실패 시 false, 기존 출력 유지
+    bool setFile(const std::string &path);
+
+    // 지금까지 적재된 레코드가 모두 출력될 때까지 대기
+    void flush();
+
+    // 링이 가득 차 버려진 레코드 수 (전체 스레드 누적)
+    uint64_t dropped();
+
+    namespace detail
+    {
+        // 호출 스레드의 링에서 빈 슬롯을 얻음 (가득 차면 nullptr)
+        Record *acquire();
+        // acquire로 얻은 슬롯을 drain 스레드에 공개
+        void commit();
+
+        class Encoder
+        {
+        public:
+            explicit Encoder(Record &r) : p_(r.payload), end_(r.payload + sizeof(r.payload)), begin_(r.payload) {}
+
+            uint16_t size() const { return static_cast<uint16_t>(p_ - begin_); }
+
+            template <typename T>
+            void put(const T &v)
+            {
+                using U = std::decay_t<T>;
+                if constexpr (std::is_same_v<U, bool>)
+                    putScalar(ArgType::Uint, static_cast<uint64_t>(v));
+                else if constexpr (std::is_enum_v<U>)
+                    put(static_cast<std::underlying_type_t<U>>(v));
+                else if constexpr (std::is_floating_point_v<U>)
+                    putScalar(ArgType::Double, static_cast<double>(v));
+                else if constexpr (std::is_integral_v<U> && std::is_signed_v<U>)
+                    putScalar(ArgType::Int, static_cast<int64_t>(v));
+                else if constexpr (std::is_integral_v<U>)
+                    putScalar(ArgType::Uint, static_cast<uint64_t>(v));
+                else
+                    putStr(std::string_view(v));
+            }
+
+        private:
+            template <typename V>
+            void putScalar(ArgType type, V v)
+            {
+                if (end_ - p_ < static_cast<ptrdiff_t>(1 + sizeof(V)))
+                {
+                    p_ = end_;
+                    return;
+                }
+                *p_++ = static_cast<uint8_t>(type);
+                std::memcpy(p_, &v, sizeof(V));
+                p_ += sizeof(V);
+            }
+
+            void putStr(std::string_view s)
+            {
+                if (end_ - p_ < 2)
+                {
+                    p_ = end_;
+                    return;
+                }
+                const size_t room = static_cast<size_t>(end_ - p_) - 2;
+                const size_t len = std::min<size_t>({s.size(), room, 255});
+                *p_++ = static_cast<uint8_t>(ArgType::Str);
+                *p_++ = static_cast<uint8_t>(len);
+                std::memcpy(p_, s.data(), len);
+                p_ += len;
+            }
+
+            uint8_t *p_;
+            uint8_t *end_;
+            uint8_t *begin_;
+        };
+    }
+
+    template <Level L, size_t N, typename... Args>
+    inline void log(const char (&format)[N], const Args &...args)
+    {
+        if constexpr (L >= MIN_LEVEL)
+        {
+            Record *r = detail::acquire();
+            if (r == nullptr)
+                return;
+            r->timeNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  std::chrono::system_clock::now().time_since_epoch())
+                                                  .count());
+            r->format = format;
+            r->level = L;
+            r->argCount = static_cast<uint8_t>(sizeof...(Args));
+            detail::Encoder e(*r);
+            (e.put(args), ...);
+            r->payloadSize = e.size();
+            detail::commit();
+        }
+    }
+
+    template <size_t N, typename... Args>
+    inline void debug(const char (&format)[N], const Args &...args) { log<Level::Debug>(format, args...); }
+
+    template <size_t N, typename... Args>
+    inline void info(const char (&format)[N], const Args &...args) { log<Level::Info>(format, args...); }
+
+    template <size_t N, typename... Args>
+    inline void warn(const char (&format)[N], const Args &...args) { log<Level::Warn>(format, args...); }
+
+    template <size_t N, typename... Args>
+    inline void error(const char (&format)[N], const Args &...args) { log<Level::Error>(format, args...); }
+}
@@ -14,6 +14,8 @@ struct PacketHeader
     uint32_t seqID;       // 패킷 순서 (Loss 확인)
     uint32_t payloadCRC;  // 데이터 무결성 (깨짐 확인)
     uint32_t count;       // 이 패킷에 들어있는 Target 개수
+    uint32_t traceId;     // 지연 추적 id (시뮬레이터 틱, 0이면 없음)
+    uint64_t traceOriginUs; // 지연 추적 발생 시각 (system_clock epoch us)
 };
 
 enum recvPacketType : uint8_t
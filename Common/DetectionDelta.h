@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// MFR → LC 탐지 정보 v2 (0x24): 키프레임 + 델타
+//
+// 헤더 (15 byte, 리틀 엔디안)
+//   [cmd 0x24][version 2][flags][radarId u32][frameSeq u16][keySeq u16][numTargets u16][numMissiles u16]
+//   flags & FLAG_TRACE 이면 헤더 바로 뒤에 지연 추적 [traceId u32][traceOriginUs u64] (Common/Trace.h)
+//
+// 키프레임 (flags & FLAG_KEYFRAME): v1(0x22)과 같은 전체 레코드(MfrToLcTargetInfo / MfrToLcMissileInfo)를 나열.
+// 델타 프레임: keySeq 키프레임을 기준으로 레코드마다
+//   [ref varint] 0이면 키프레임에 없는 신규 접촉 → 전체 레코드,
+//                n이면 키프레임의 n-1 번째 레코드 → [field mask u8] + 바뀐 필드만
+//   위치/속도/탐지 시각은 키프레임 값과의 차이를 zigzag varint로, 각도는 f64 원본, 우선순위/격추는 u8.
+// 이번 프레임에 없는 키프레임 접촉은 레코드를 보내지 않는다(= 미탐지).
+namespace detection_v2
+{
+    constexpr uint8_t COMMAND = 0x24;
+    constexpr uint8_t VERSION = 2;
+    constexpr uint8_t FLAG_KEYFRAME = 0x01;
+    constexpr uint8_t FLAG_TRACE = 0x02;
+    constexpr size_t HEADER_SIZE = 15;
+
+    constexpr size_t TARGET_RECORD_SIZE = 58;  // MfrToLcTargetInfo
+    constexpr size_t MISSILE_RECORD_SIZE = 57; // MfrToLcMissileInfo
+
+    enum TargetField : uint8_t
+    {
+        TARGET_POS = 0x01,
+        TARGET_SPEED = 0x02,
+        TARGET_ANGLE1 = 0x04,
+        TARGET_ANGLE2 = 0x08,
+        TARGET_DETECT_TIME = 0x10,
+        TARGET_PRIORITY = 0x20,
+        TARGET_HIT = 0x40,
+    };
+
+    enum MissileField : uint8_t
+    {
+        MISSILE_POS = 0x01,
+        MISSILE_SPEED = 0x02,
+        MISSILE_ANGLE = 0x04,
+        MISSILE_DETECT_TIME = 0x08,
+        MISSILE_INTERCEPT_TIME = 0x10,
+        MISSILE_HIT = 0x20,
+    };
+
+    inline uint64_t zigzag(int64_t v)
+    {
+        return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+    }
+
+    inline int64_t unzigzag(uint64_t v)
+    {
+        return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+    }
+
+    // LEB128 방식 (7bit 단위, 최대 10 byte)
+    template <typename Buffer>
+    inline void putVarint(Buffer &out, uint64_t v)
+    {
+        while (v >= 0x80)
+        {
+            out.push_back(static_cast<typename Buffer::value_type>((v & 0x7F) | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<typename Buffer::value_type>(v));
+    }
+
+    // 범위를 넘거나 10 byte를 넘으면 false
+    inline bool getVarint(const uint8_t *&p, const uint8_t *end, uint64_t &v)
+    {
+        v = 0;
+        for (int shift = 0; shift < 70 && p < end; shift += 7)
+        {
+            const uint8_t byte = *p++;
+            v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,250 @@
+#include "Geodesy.h"
+
+#include <cmath>
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define GEO_X86_AVX2 1
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define GEO_AARCH64_NEON 1
+#endif
+
+namespace geo
+{
+    namespace
+    {
+        constexpr double INV_360 = 1.0 / 360.0;
+        constexpr double HALF_DEG_TO_RAD = 0.5 * DEG_TO_RAD;
+
+        // cos(x) 테일러 계수 (x²에 대한 Horner), |x| <= π/2(위도 범위)에서 오차 1e-16 이하
+        constexpr double COS_COEF[] = {
+            1.0,
+            -1.0 / 2.0,
+            1.0 / 24.0,
+            -1.0 / 720.0,
+            1.0 / 40320.0,
+            -1.0 / 3628800.0,
+            1.0 / 479001600.0,
+            -1.0 / 87178291200.0,
+            1.0 / 20922789888000.0,
+            -1.0 / 6402373705728000.0,
+            1.0 / 2432902008176640000.0,
+            -1.0 / 1124000727777607680000.0,
+        };
+        constexpr int COS_TERMS = sizeof(COS_COEF) / sizeof(COS_COEF[0]);
+
+        // 분기 없는 다항식 cos, SIMD 커널과 같은 연산 순서
+        inline double cosLat(double x)
+        {
+            const double y = x * x;
+            double p = COS_COEF[COS_TERMS - 1];
+            for (int k = COS_TERMS - 2; k >= 0; --k)
+            {
+                p = p * y + COS_COEF[k];
+            }
+            return p;
+        }
+
+        inline double wrapLon(double dLon)
+        {
+            return dLon - 360.0 * std::nearbyint(dLon * INV_360);
+        }
+
+        void enuOffsetScalar(const Position &origin, const double *lat, const double *lon, const double *alt, std::size_t n,
+                             double *east, double *north, double *up, double *distSq)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double c = cosLat((lat[i] + origin.lat) * HALF_DEG_TO_RAD);
+                const double e = wrapLon(lon[i] - origin.lon) * METERS_PER_DEG_LAT * c;
+                const double nn = (lat[i] - origin.lat) * METERS_PER_DEG_LAT;
+                const double u = alt[i] - origin.alt;
+
+                east[i] = e;
+                north[i] = nn;
+                up[i] = u;
+                if (distSq)
+                {
+                    distSq[i] = e * e + nn * nn + u * u;
+                }
+            }
+        }
+
+#if defined(GEO_X86_AVX2)
+        __attribute__((target("avx2"))) void enuOffsetAvx2(const Position &origin, const double *lat, const double *lon, const double *alt, std::size_t n,
+                                                           double *east, double *north, double *up, double *distSq)
+        {
+            const __m256d oLat = _mm256_set1_pd(origin.lat);
+            const __m256d oLon = _mm256_set1_pd(origin.lon);
+            const __m256d oAlt = _mm256_set1_pd(origin.alt);
+            const __m256d inv360 = _mm256_set1_pd(INV_360);
+            const __m256d full360 = _mm256_set1_pd(360.0);
+            const __m256d halfDegToRad = _mm256_set1_pd(HALF_DEG_TO_RAD);
+            const __m256d metersPerDeg = _mm256_set1_pd(METERS_PER_DEG_LAT);
+
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                const __m256d la = _mm256_loadu_pd(lat + i);
+                const __m256d lo = _mm256_loadu_pd(lon + i);
+                const __m256d al = _mm256_loadu_pd(alt + i);
+
+                // cos(평균 위도)
+                const __m256d x = _mm256_mul_pd(_mm256_add_pd(la, oLat), halfDegToRad);
+                const __m256d y = _mm256_mul_pd(x, x);
+                __m256d c = _mm256_set1_pd(COS_COEF[COS_TERMS - 1]);
+                for (int k = COS_TERMS - 2; k >= 0; --k)
+                {
+                    c = _mm256_add_pd(_mm256_mul_pd(c, y), _mm256_set1_pd(COS_COEF[k]));
+                }
+
+                __m256d dLon = _mm256_sub_pd(lo, oLon);
+                const __m256d turns = _mm256_round_pd(_mm256_mul_pd(dLon, inv360), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                dLon = _mm256_sub_pd(dLon, _mm256_mul_pd(full360, turns));
+
+                const __m256d e = _mm256_mul_pd(_mm256_mul_pd(dLon, metersPerDeg), c);
+                const __m256d nn = _mm256_mul_pd(_mm256_sub_pd(la, oLat), metersPerDeg);
+                const __m256d u = _mm256_sub_pd(al, oAlt);
+
+                _mm256_storeu_pd(east + i, e);
+                _mm256_storeu_pd(north + i, nn);
+                _mm256_storeu_pd(up + i, u);
+                if (distSq)
+                {
+                    const __m256d d = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(e, e), _mm256_mul_pd(nn, nn)), _mm256_mul_pd(u, u));
+                    _mm256_storeu_pd(distSq + i, d);
+                }
+            }
+
+            enuOffsetScalar(origin, lat + i, lon + i, alt + i, n - i, east + i, north + i, up + i, distSq ? distSq + i : nullptr);
+        }
+#endif
+
+#if defined(GEO_AARCH64_NEON)
+        void enuOffsetNeon(const Position &origin, const double *lat, const double *lon, const double *alt, std::size_t n,
+                           double *east, double *north, double *up, double *distSq)
+        {
+            const float64x2_t oLat = vdupq_n_f64(origin.lat);
+            const float64x2_t oLon = vdupq_n_f64(origin.lon);
+            const float64x2_t oAlt = vdupq_n_f64(origin.alt);
+            const float64x2_t inv360 = vdupq_n_f64(INV_360);
+            const float64x2_t full360 = vdupq_n_f64(360.0);
+            const float64x2_t halfDegToRad = vdupq_n_f64(HALF_DEG_TO_RAD);
+            const float64x2_t metersPerDeg = vdupq_n_f64(METERS_PER_DEG_LAT);
+
+            std::size_t i = 0;
+            for (; i + 2 <= n; i += 2)
+            {
+                const float64x2_t la = vld1q_f64(lat + i);
+                const float64x2_t lo = vld1q_f64(lon + i);
+                const float64x2_t al = vld1q_f64(alt + i);
+
+                // cos(평균 위도)
+                const float64x2_t x = vmulq_f64(vaddq_f64(la, oLat), halfDegToRad);
+                const float64x2_t y = vmulq_f64(x, x);
+                float64x2_t c = vdupq_n_f64(COS_COEF[COS_TERMS - 1]);
+                for (int k = COS_TERMS - 2; k >= 0; --k)
+                {
+                    c = vaddq_f64(vmulq_f64(c, y), vdupq_n_f64(COS_COEF[k]));
+                }
+
+                float64x2_t dLon = vsubq_f64(lo, oLon);
+                const float64x2_t turns = vrndnq_f64(vmulq_f64(dLon, inv360));
+                dLon = vsubq_f64(dLon, vmulq_f64(full360, turns));
+
+                const float64x2_t e = vmulq_f64(vmulq_f64(dLon, metersPerDeg), c);
+                const float64x2_t nn = vmulq_f64(vsubq_f64(la, oLat), metersPerDeg);
+                const float64x2_t u = vsubq_f64(al, oAlt);
+
+                vst1q_f64(east + i, e);
+                vst1q_f64(north + i, nn);
+                vst1q_f64(up + i, u);
+                if (distSq)
+                {
+                    const float64x2_t d = vaddq_f64(vaddq_f64(vmulq_f64(e, e), vmulq_f64(nn, nn)), vmulq_f64(u, u));
+                    vst1q_f64(distSq + i, d);
+                }
+            }
+
+            enuOffsetScalar(origin, lat + i, lon + i, alt + i, n - i, east + i, north + i, up + i, distSq ? distSq + i : nullptr);
+        }
+#endif
+
+        using EnuKernel = void (*)(const Position &, const double *, const double *, const double *, std::size_t,
+                                   double *, double *, double *, double *);
+
+        EnuKernel resolveKernel()
+        {
+#if defined(GEO_X86_AVX2)
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return enuOffsetAvx2;
+            }
+#elif defined(GEO_AARCH64_NEON)
+            return enuOffsetNeon;
+#endif
+            return enuOffsetScalar;
+        }
+
+        EnuKernel kernel()
+        {
+            static const EnuKernel enu = resolveKernel();
+            return enu;
+        }
+    }
+
+    double metersPerDegLon(double latDeg)
+    {
+        return METERS_PER_DEG_LAT * std::cos(latDeg * DEG_TO_RAD);
+    }
+
+    Enu enuOffset(const Position &origin, double lat, double lon, double alt)
+    {
+        Enu enu;
+        enuOffsetScalar(origin, &lat, &lon, &alt, 1, &enu.east, &enu.north, &enu.up, nullptr);
+        return enu;
+    }
+
+    double haversineDistance(const Position &origin, double lat, double lon, double alt)
+    {
+        const double originLatRad = origin.lat * DEG_TO_RAD;
+        const double latRad = lat * DEG_TO_RAD;
+
+        const double sinHalfDeltaLat = std::sin((lat - origin.lat) * HALF_DEG_TO_RAD);
+        const double sinHalfDeltaLon = std::sin(wrapLon(lon - origin.lon) * HALF_DEG_TO_RAD);
+
+        const double a = sinHalfDeltaLat * sinHalfDeltaLat + std::cos(originLatRad) * std::cos(latRad) * sinHalfDeltaLon * sinHalfDeltaLon;
+        const double c = 2.0 * std::asin(std::sqrt(std::min(a, 1.0)));
+
+        const double horizontal = EARTH_RADIUS_M * c;
+        const double vertical = alt - origin.alt;
+        return std::sqrt(horizontal * horizontal + vertical * vertical);
+    }
+
+    double initialBearing(const Position &origin, double lat, double lon)
+    {
+        const double originLatRad = origin.lat * DEG_TO_RAD;
+        const double latRad = lat * DEG_TO_RAD;
+        const double deltaLonRad = wrapLon(lon - origin.lon) * DEG_TO_RAD;
+
+        const double y = std::sin(deltaLonRad) * std::cos(latRad);
+        const double x = std::cos(originLatRad) * std::sin(latRad) - std::sin(originLatRad) * std::cos(latRad) * std::cos(deltaLonRad);
+        const double theta = std::atan2(y, x) * RAD_TO_DEG;
+
+        return std::fmod(theta + 360.0, 360.0);
+    }
+
+    double flatBearing(const Enu &enu)
+    {
+        const double theta = std::atan2(enu.east, enu.north) * RAD_TO_DEG;
+        return theta < 0.0 ? theta + 360.0 : theta;
+    }
+
+    void enuOffsetBatch(const Position &origin, const double *lat, const double *lon, const double *alt, std::size_t n,
+                        double *east, double *north, double *up, double *distSq)
+    {
+        kernel()(origin, lat, lon, alt, n, east, north, up, distSq);
+    }
+}
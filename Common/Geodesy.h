@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+
+// 위도/경도 ↔ 미터 변환 공용 모듈 (MFR, LC, Simulator 공용)
+// 모든 컴포넌트가 같은 상수를 쓰도록 지구 모델 상수는 여기서만 정의한다.
+namespace geo
+{
+    constexpr double PI = 3.14159265358979323846;
+    constexpr double DEG_TO_RAD = PI / 180.0;
+    constexpr double RAD_TO_DEG = 180.0 / PI;
+
+    constexpr double METERS_PER_DEG_LAT = 111320.0;                   // 위도 1도당 거리 (m)
+    constexpr double EARTH_RADIUS_M = METERS_PER_DEG_LAT * RAD_TO_DEG; // 평면 근사와 Haversine이 같은 구를 쓰도록 유도
+    constexpr double KMH_TO_MPS = 1000.0 / 3600.0;
+    constexpr double COORD_SCALE = 1e7; // 패킷 위도/경도 정수 스케일
+
+    struct Position
+    {
+        double lat; // deg
+        double lon; // deg
+        double alt; // m
+    };
+
+    // 기준점 기준 동/북/상 오프셋 (m)
+    struct Enu
+    {
+        double east;
+        double north;
+        double up;
+    };
+
+    // 해당 위도에서 경도 1도당 거리 (m)
+    double metersPerDegLon(double latDeg);
+
+    // 평균 위도 기준 평면(등장방형) 근사, 경도 ±180 경계 보정
+    Enu enuOffset(const Position &origin, double lat, double lon, double alt);
+
+    // 대권 거리(수평) + 고도차의 3차원 거리 (m)
+    double haversineDistance(const Position &origin, double lat, double lon, double alt);
+
+    // 대권 초기 방위각 (deg, 진북 기준 0~360)
+    double initialBearing(const Position &origin, double lat, double lon);
+
+    // 평면 오프셋의 방위각 (deg, 진북 기준 0~360)
+    double flatBearing(const Enu &enu);
+
+    // ---- 배치 (SoA 배열) ----
+    // enuOffsetBatch: x86은 실행 시 AVX2 지원 여부로, aarch64는 NEON으로 처리하며 그 외(ARMv7 등)는 스칼라 루프.
+    // 모든 경로가 같은 다항식 cos와 연산 순서를 쓰므로 스칼라 enuOffset과 반올림 오차 범위에서 일치한다.
+    // distSq가 nullptr이 아니면 east² + north² + up² 도 함께 기록한다.
+    // 정밀 계산(haversineDistance, initialBearing)은 사전 필터를 통과한 소수 항목에만 스칼라로 사용한다.
+    void enuOffsetBatch(const Position &origin, const double *lat, const double *lon, const double *alt, std::size_t n,
+                        double *east, double *north, double *up, double *distSq = nullptr);
+}
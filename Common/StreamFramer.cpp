@@ -0,0 +1,227 @@
+#include "StreamFramer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace stream
+{
+    namespace
+    {
+        uint32_t readLength(const uint8_t *p)
+        {
+            return static_cast<uint32_t>(p[0]) |
+                   (static_cast<uint32_t>(p[1]) << 8) |
+                   (static_cast<uint32_t>(p[2]) << 16) |
+                   (static_cast<uint32_t>(p[3]) << 24);
+        }
+    }
+
+    bool sendFrame(int fd, const void *data, size_t len)
+    {
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        uint8_t prefix[LENGTH_PREFIX_SIZE] = {
+            static_cast<uint8_t>(len),
+            static_cast<uint8_t>(len >> 8),
+            static_cast<uint8_t>(len >> 16),
+            static_cast<uint8_t>(len >> 24),
+        };
+
+        iovec iov[2];
+        iov[0].iov_base = prefix;
+        iov[0].iov_len = sizeof(prefix);
+        iov[1].iov_base = const_cast<void *>(data);
+        iov[1].iov_len = len;
+
+        msghdr msg{};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = 2;
+
+        size_t remaining = sizeof(prefix) + len;
+        while (remaining > 0)
+        {
+            const ssize_t sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+            if (sent < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+
+            remaining -= static_cast<size_t>(sent);
+
+            // 보낸 만큼 iovec 앞으로 이동
+            size_t skip = static_cast<size_t>(sent);
+            while (skip > 0 && msg.msg_iovlen > 0)
+            {
+                if (skip >= msg.msg_iov->iov_len)
+                {
+                    skip -= msg.msg_iov->iov_len;
+                    ++msg.msg_iov;
+                    --msg.msg_iovlen;
+                }
+                else
+                {
+                    msg.msg_iov->iov_base = static_cast<uint8_t *>(msg.msg_iov->iov_base) + skip;
+                    msg.msg_iov->iov_len -= skip;
+                    skip = 0;
+                }
+            }
+        }
+        return true;
+    }
+
+    SendQueue::Status SendQueue::push(int fd, const void *data, size_t len)
+    {
+        if (pendingBytes() + LENGTH_PREFIX_SIZE + len > maxBytes_)
+        {
+            return Status::Full;
+        }
+
+        // 보낸 앞부분이 절반을 넘으면 당겨서 버퍼가 계속 자라지 않게 함
+        if (head_ > 0 && head_ * 2 >= buffer_.size())
+        {
+            buffer_.erase(buffer_.begin(), buffer_.begin() + static_cast<std::ptrdiff_t>(head_));
+            head_ = 0;
+        }
+
+        const uint8_t prefix[LENGTH_PREFIX_SIZE] = {
+            static_cast<uint8_t>(len),
+            static_cast<uint8_t>(len >> 8),
+            static_cast<uint8_t>(len >> 16),
+            static_cast<uint8_t>(len >> 24),
+        };
+        buffer_.insert(buffer_.end(), prefix, prefix + sizeof(prefix));
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + len);
+        return flush(fd);
+    }
+
+    SendQueue::Status SendQueue::flush(int fd)
+    {
+        while (pendingBytes() > 0)
+        {
+            const ssize_t sent = send(fd, buffer_.data() + head_, pendingBytes(), MSG_NOSIGNAL);
+            if (sent < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                {
+                    return Status::Ok; // 송신 버퍼가 참, EPOLLOUT에서 이어서
+                }
+                return Status::Error;
+            }
+            head_ += static_cast<size_t>(sent);
+        }
+        clear();
+        return Status::Ok;
+    }
+
+    void SendQueue::clear()
+    {
+        buffer_.clear();
+        head_ = 0;
+    }
+
+    StreamFramer::StreamFramer(size_t bufferSize, size_t maxFrameSize)
+        : buffer_(bufferSize), maxFrameSize_(maxFrameSize)
+    {
+    }
+
+    void StreamFramer::reserveTail(size_t need)
+    {
+        if (buffer_.size() - tail_ >= need)
+        {
+            return;
+        }
+
+        // 남은 미완성 프레임을 앞으로 당겨 공간 확보 (완성 프레임은 이미 넘겼으므로 최대 한 프레임 분량)
+        const size_t pending = tail_ - head_;
+        if (head_ > 0)
+        {
+            std::memmove(buffer_.data(), buffer_.data() + head_, pending);
+            head_ = 0;
+            tail_ = pending;
+        }
+
+        if (buffer_.size() - tail_ < need)
+        {
+            buffer_.resize(tail_ + need);
+        }
+    }
+
+    StreamFramer::Status StreamFramer::fill(int fd)
+    {
+        // 최소 버퍼의 1/4은 비워 두고 recv
+        reserveTail(buffer_.size() / 4);
+
+        ssize_t len;
+        do
+        {
+            len = recv(fd, buffer_.data() + tail_, buffer_.size() - tail_, 0);
+        } while (len < 0 && errno == EINTR);
+
+        if (len == 0)
+        {
+            return Status::Closed;
+        }
+        if (len < 0)
+        {
+            // 논블로킹 소켓에서 읽을 것이 없으면 오류가 아님
+            return (errno == EAGAIN || errno == EWOULDBLOCK) ? Status::Ok : Status::Error;
+        }
+
+        tail_ += static_cast<size_t>(len);
+        return Status::Ok;
+    }
+
+    void StreamFramer::append(const void *data, size_t len)
+    {
+        reserveTail(len);
+        std::memcpy(buffer_.data() + tail_, data, len);
+        tail_ += len;
+    }
+
+    bool StreamFramer::next(const uint8_t *&frame, size_t &len, Status &status)
+    {
+        const size_t pending = tail_ - head_;
+        if (pending < LENGTH_PREFIX_SIZE)
+        {
+            return false;
+        }
+
+        const uint32_t frameLen = readLength(buffer_.data() + head_);
+        if (frameLen > maxFrameSize_)
+        {
+            status = Status::Oversize;
+            head_ = tail_ = 0;
+            return false;
+        }
+
+        if (pending < LENGTH_PREFIX_SIZE + frameLen)
+        {
+            // 큰 프레임은 다음 recv 전에 들어갈 자리를 미리 확보
+            reserveTail(LENGTH_PREFIX_SIZE + frameLen - pending);
+            return false;
+        }
+
+        frame = buffer_.data() + head_ + LENGTH_PREFIX_SIZE;
+        len = frameLen;
+        head_ += LENGTH_PREFIX_SIZE + frameLen;
+        if (head_ == tail_)
+        {
+            head_ = tail_ = 0;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// TCP 스트림 프레이밍 (MFR ↔ LC, ECC ↔ LC 공용)
+//
+// 프레임: [length u32 리틀 엔디안][payload length byte]
+// recv 한 번에 여러 프레임이 붙어 오거나 한 프레임이 나뉘어 와도 수신 버퍼에서 재조립하고,
+// 완성된 프레임은 복사 없이 버퍼 안의 포인터로 넘긴다.
+namespace stream
+{
+    constexpr size_t LENGTH_PREFIX_SIZE = 4;
+    constexpr size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+    constexpr size_t DEFAULT_MAX_FRAME_SIZE = 1024 * 1024;
+    constexpr size_t DEFAULT_MAX_QUEUE_BYTES = 4 * 1024 * 1024;
+
+    // 길이 접두 + payload를 한 번의 sendmsg로 전송 (부분 전송은 이어서 보냄, 블로킹 소켓용)
+    bool sendFrame(int fd, const void *data, size_t len);
+
+    // 논블로킹 소켓 송신 큐 (리액터용)
+    // 보낼 수 있는 만큼 바로 보내고 나머지는 쌓아 두었다가 EPOLLOUT 때 flush로 이어서 보냄
+    // 상대가 읽지 않아 maxBytes를 넘으면 Full → 호출 측에서 연결을 끊는다
+    class SendQueue
+    {
+    public:
+        enum class Status
+        {
+            Ok,    // 전송 완료 또는 큐에 보관 (pendingBytes()로 구분)
+            Full,  // 최대 크기 초과, 프레임은 넣지 않음
+            Error, // send 실패
+        };
+
+        explicit SendQueue(size_t maxBytes = DEFAULT_MAX_QUEUE_BYTES) : maxBytes_(maxBytes) {}
+
+        // 프레임(길이 접두 포함)을 뒤에 붙이고 전송 시도
+        Status push(int fd, const void *data, size_t len);
+        // 남은 데이터 전송 시도
+        Status flush(int fd);
+
+        size_t pendingBytes() const { return buffer_.size() - head_; }
+        void clear();
+
+    private:
+        std::vector<uint8_t> buffer_;
+        size_t head_ = 0; // 보내지 않은 첫 byte
+        size_t maxBytes_;
+    };
+
+    class StreamFramer
+    {
+    public:
+        enum class Status
+        {
+            Ok,       // 수신 성공 (완성 프레임이 없을 수도 있음)
+            Closed,   // 상대가 연결 종료
+            Error,    // recv 실패
+            Oversize, // 최대 크기를 넘는 길이 → 동기화 불가, 연결을 끊어야 함
+        };
+
+        explicit StreamFramer(size_t bufferSize = DEFAULT_BUFFER_SIZE, size_t maxFrameSize = DEFAULT_MAX_FRAME_SIZE);
+
+        // recv 한 번 후 완성된 프레임마다 onFrame(const uint8_t *data, size_t len) 호출
+        // data는 다음 receive/feed 호출 전까지만 유효
+        template <typename OnFrame>
+        Status receive(int fd, OnFrame &&onFrame)
+        {
+            const Status status = fill(fd);
+            if (status != Status::Ok)
+            {
+                return status;
+            }
+            return drain(onFrame);
+        }
+
+        // 이미 받은 바이트를 넣고 완성된 프레임 처리 (소켓 없이 재조립만 필요할 때)
+        template <typename OnFrame>
+        Status feed(const void *data, size_t len, OnFrame &&onFrame)
+        {
+            append(data, len);
+            return drain(onFrame);
+        }
+
+        size_t pendingBytes() const { return tail_ - head_; }
+
+    private:
+        std::vector<uint8_t> buffer_;
+        size_t head_ = 0; // 처리 안 된 첫 byte
+        size_t tail_ = 0; // 다음 수신 위치
+        size_t maxFrameSize_;
+
+        Status fill(int fd);
+        void append(const void *data, size_t len);
+        void reserveTail(size_t need);
+
+        // 완성 프레임이 있으면 꺼내고 true, Oversize면 status 설정
+        bool next(const uint8_t *&frame, size_t &len, Status &status);
+
+        template <typename OnFrame>
+        Status drain(OnFrame &onFrame)
+        {
+            const uint8_t *frame;
+            size_t len;
+            Status status = Status::Ok;
+            while (next(frame, len, status))
+            {
+                onFrame(frame, len);
+            }
+            return status;
+        }
+    };
+}
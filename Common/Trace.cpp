@@ -0,0 +1,86 @@
+#include "Trace.h"
+#include "AsyncLog.h"
+
+#include <csignal>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <pthread.h>
+#include <thread>
+#include <vector>
+
+namespace trace
+{
+    namespace
+    {
+        struct Stage
+        {
+            const char *name;
+            std::unique_ptr<LatencyHistogram> histogram;
+        };
+
+        // 등록은 드물고(단계당 한 번) 기록은 참조로 하므로 목록만 잠금
+        std::mutex &registryMutex()
+        {
+            static std::mutex m;
+            return m;
+        }
+
+        std::vector<Stage> &registry()
+        {
+            static std::vector<Stage> stages;
+            return stages;
+        }
+    }
+
+    LatencyHistogram &stage(const char *name)
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        auto &stages = registry();
+        for (auto &s : stages)
+        {
+            if (std::strcmp(s.name, name) == 0)
+                return *s.histogram;
+        }
+        stages.push_back(Stage{name, std::make_unique<LatencyHistogram>()});
+        return *stages.back().histogram;
+    }
+
+    void dump()
+    {
+        std::lock_guard<std::mutex> lock(registryMutex());
+        for (const auto &s : registry())
+        {
+            const LatencyHistogram::Summary sum = s.histogram->summary();
+            asynclog::info("[trace] {} n={} mean={}us p50={}us p90={}us p99={}us p99.9={}us max={}us skewed={}",
+                           s.name, sum.count, sum.meanUs, sum.p50Us, sum.p90Us, sum.p99Us, sum.p999Us, sum.maxUs,
+                           sum.skewed);
+        }
+    }
+
+    bool installDumpSignal()
+    {
+        // 이후 만들어지는 스레드에 상속되도록 호출 스레드에서 막고, 전용 스레드가 sigwait로 받음
+        sigset_t set;
+        sigemptyset(&set);
+        sigaddset(&set, SIGUSR1);
+        if (pthread_sigmask(SIG_BLOCK, &set, nullptr) != 0)
+        {
+            asynclog::error("[trace] SIGUSR1 차단 실패");
+            return false;
+        }
+
+        std::thread([set]()
+                    {
+            while (true)
+            {
+                int sig = 0;
+                if (sigwait(&set, &sig) == 0 && sig == SIGUSR1)
+                {
+                    dump();
+                }
+            } })
+            .detach();
+        return true;
+    }
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// 종단 간 지연 추적 (Simulator → MFR → LC → ECC)
+//
+// - 시뮬레이터가 틱마다 trace id와 발생 시각(system_clock epoch us)을 정해 배치 헤더에 싣고,
+//   MFR 탐지 보고(0x24), LC 상태 응답(0x56)/푸시(0x57)가 가장 최근에 반영한 값을 그대로 이어 붙인다.
+// - 각 홉은 수신(ingress)/송신(egress) 시점에 "지금 - 발생 시각"을 단계별 히스토그램에 기록한다.
+// - 프로세스(장비) 간 비교라 system_clock 기준이며 시각 동기를 전제로 한다. 음수(시계 어긋남)는 0으로 기록하고 따로 센다.
+//
+// 이 헤더만으로 쓸 수 있는 부분(Context, LatencyHistogram)은 플랫폼 독립 (ECC에서도 사용)
+namespace trace
+{
+    struct Context
+    {
+        uint32_t id = 0;       // 0이면 추적 정보 없음
+        uint64_t originUs = 0; // 발생 시각 (system_clock epoch us)
+
+        explicit operator bool() const { return id != 0; }
+    };
+
+    // 패킷에 싣는 크기: [id u32][originUs u64]
+    constexpr size_t WIRE_SIZE = 12;
+
+    inline uint64_t nowUs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                         std::chrono::system_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    // HDR 방식 로그-선형 히스토그램 (us 단위, 버킷 상대 오차 1/32 이하)
+    // - 64 미만은 1us 단위, 그 위는 2배 구간마다 32칸
+    // - 기록은 relaxed 원자 카운터만 사용 (여러 스레드에서 잠금 없이 기록 가능)
+    class LatencyHistogram
+    {
+    public:
+        static constexpr unsigned HALF_BITS = 5;
+        static constexpr size_t HALF = size_t(1) << HALF_BITS; // 32
+        static constexpr size_t BUCKET_COUNT = (64 - HALF_BITS) * HALF + HALF;
+
+        struct Summary
+        {
+            uint64_t count;
+            uint64_t skewed; // 발생 시각이 미래였던 표본 (시계 어긋남)
+            uint64_t meanUs;
+            uint64_t p50Us;
+            uint64_t p90Us;
+            uint64_t p99Us;
+            uint64_t p999Us;
+            uint64_t maxUs;
+        };
+
+        void record(uint64_t us)
+        {
+            buckets_[bucketIndex(us)].fetch_add(1, std::memory_order_relaxed);
+            count_.fetch_add(1, std::memory_order_relaxed);
+            sum_.fetch_add(us, std::memory_order_relaxed);
+            uint64_t prev = max_.load(std::memory_order_relaxed);
+            while (us > prev && !max_.compare_exchange_weak(prev, us, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        // 발생 시각 기준 경과 시간 기록 (추적 정보가 없으면 무시)
+        void recordSince(const Context &ctx, uint64_t nowUsValue = nowUs())
+        {
+            if (!ctx)
+                return;
+            if (nowUsValue < ctx.originUs)
+            {
+                skewed_.fetch_add(1, std::memory_order_relaxed);
+                record(0);
+                return;
+            }
+            record(nowUsValue - ctx.originUs);
+        }
+
+        // 기록과 동시에 호출해도 되지만 그 순간의 값은 근사치
+        Summary summary() const
+        {
+            Summary s{};
+            s.count = count_.load(std::memory_order_relaxed);
+            s.skewed = skewed_.load(std::memory_order_relaxed);
+            s.maxUs = max_.load(std::memory_order_relaxed);
+            s.meanUs = s.count ? sum_.load(std::memory_order_relaxed) / s.count : 0;
+            if (s.count == 0)
+                return s;
+
+            const double quantiles[] = {0.50, 0.90, 0.99, 0.999};
+            uint64_t *outs[] = {&s.p50Us, &s.p90Us, &s.p99Us, &s.p999Us};
+            size_t q = 0;
+            uint64_t seen = 0;
+            for (size_t i = 0; i < BUCKET_COUNT && q < 4; ++i)
+            {
+                seen += buckets_[i].load(std::memory_order_relaxed);
+                while (q < 4 && seen >= static_cast<uint64_t>(quantiles[q] * static_cast<double>(s.count)) && seen > 0)
+                {
+                    *outs[q++] = bucketValue(i);
+                }
+            }
+            for (; q < 4; ++q)
+                *outs[q] = s.maxUs;
+            return s;
+        }
+
+        void reset()
+        {
+            for (auto &b : buckets_)
+                b.store(0, std::memory_order_relaxed);
+            count_.store(0, std::memory_order_relaxed);
+            skewed_.store(0, std::memory_order_relaxed);
+            sum_.store(0, std::memory_order_relaxed);
+            max_.store(0, std::memory_order_relaxed);
+        }
+
+        static size_t bucketIndex(uint64_t v)
+        {
+            if (v < 2 * HALF)
+                return static_cast<size_t>(v);
+            const unsigned shift = msb(v) - HALF_BITS; // v >> shift 가 [HALF, 2*HALF)
+            return shift * HALF + static_cast<size_t>(v >> shift);
+        }
+
+        // 버킷 하한값
+        static uint64_t bucketValue(size_t index)
+        {
+            if (index < 2 * HALF)
+                return index;
+            const unsigned shift = static_cast<unsigned>(index / HALF - 1);
+            return static_cast<uint64_t>(index % HALF + HALF) << shift;
+        }
+
+    private:
+        static unsigned msb(uint64_t v)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanReverse64(&index, v);
+            return static_cast<unsigned>(index);
+#else
+            return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#endif
+        }
+
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets_{};
+        std::atomic<uint64_t> count_{0};
+        std::atomic<uint64_t> skewed_{0};
+        std::atomic<uint64_t> sum_{0};
+        std::atomic<uint64_t> max_{0};
+    };
+
+    // 이름으로 등록된 단계별 히스토그램 (프로세스 전역, 처음 호출 때 생성, 해제하지 않음)
+    // 호출부에서 static 참조로 받아 두고 쓴다: static auto &h = trace::stage("mfr.egress");
+    LatencyHistogram &stage(const char *name);
+
+    // 등록된 모든 단계를 로그로 출력
+    void dump();
+
+    // SIGUSR1을 받으면 dump() (다른 스레드를 만들기 전에 main에서 호출해야 모든 스레드에 시그널이 막힘)
+    bool installDumpSignal();
+}
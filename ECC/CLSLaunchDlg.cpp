@@ -40,6 +40,10 @@ BOOL CLSLaunchDlg::OnInitDialog()
 		m_comboTargetID.AddString(str);
 	}
 
+	// ✅ 전체 교전 항목 (표적 목록 뒤에 추가)
+	if (!m_targetList.empty())
+		m_comboTargetID.AddString(_T("ALL"));
+
 	// ✅ 초기 선택을 첫 번째 항목("0000")으로 설정
 	m_comboTargetID.SetCurSel(0);
 
@@ -65,14 +69,16 @@ void CLSLaunchDlg::OnBnClickedButtonLsLaunch()
 	{
 		CString str;
 		m_comboTargetID.GetLBText(sel, str);
-		m_selectedTargetID = _ttoi(str);
+		const bool engageAll = (str == _T("ALL"));
+		m_selectedTargetID = engageAll ? 0 : _ttoi(str);
 
 		if (m_parent)
 		{
-			m_parent->SetGoalTargetId(m_selectedTargetID);
+			if (!engageAll)
+				m_parent->SetGoalTargetId(m_selectedTargetID);
 			m_parent->sendMissileLaunch(
 				m_lsId,
-				m_selectedTargetID
+				engageAll ? ENGAGE_ALL_TARGET_ID : static_cast<unsigned int>(m_selectedTargetID)
 			);
 			//std::cout << "[발사 요청] 발사대 ID=" << m_lsId << ", 표적 ID=" << m_selectedTargetID << "\n";
 		}
@@ -25,6 +25,10 @@ protected:
 
 	DECLARE_MESSAGE_MAP()
 
+public:
+	// LC에서 전체 교전(일제 사격)으로 처리하는 표적 ID
+	static constexpr unsigned int ENGAGE_ALL_TARGET_ID = 0xFFFFFFFFu;
+
 private:
 	CComboBox m_comboTargetID;                     // 콤보박스 컨트롤
 	std::vector<TargetStatus> m_targetList;        // 표적 리스트
@@ -61,6 +61,8 @@ bool loadConfig(const std::string &filepath, ConfigCommon &config) {
           std::cerr << "[readIniConfig] LC SendPort 변환 실패: " << value
                     << std::endl;
         }
+      } else if (key == "StatusPush") {
+        config.LCStatusPush = (value == "1" || toLower(value) == "true");
       }
     } else if (currentSection == "MAP") {
       if (key == "SendIP") {
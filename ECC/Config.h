@@ -6,6 +6,7 @@
 struct ConfigCommon {
   std::string LCSendIP;
   int LCSendPort = 0;  // Launch Controller IP and Port
+  bool LCStatusPush = false;  // true: LC  Ǫ(0x57) , false: 100ms (0x01)
 
   std::string MAPSendIP;
   int MAPSendPort = 0;  // Map Server IP and Port
@@ -3,6 +3,7 @@
 #include "Deserializer.h"
 #include <cstring>
 #include <iostream>
+#include <type_traits>
 bool DeserializeRadarModeAck(const uint8_t* data, size_t len, RadarModeChangeAck& out)
 {
     if (len < sizeof(RadarModeChangeAck)) return false;
@@ -35,7 +36,8 @@ bool DeserializeStatusResponse(
     std::vector<LCStatus>& lcs,
     std::vector<LSStatus>& lss,
     std::vector<TargetStatus>& targets,
-    std::vector<MissileStatus>& missiles
+    std::vector<MissileStatus>& missiles,
+    StatusTrace* trace
 )
 {
 
@@ -55,10 +57,23 @@ bool DeserializeStatusResponse(
     uint8_t lcCount = data[offset++];
     uint8_t lsCount = data[offset++];
 
-    // target/missile count
-    if (len < offset + 2) return false;
-    uint8_t targetCount = data[offset++];
-    uint8_t missileCount = data[offset++];
+    // target/missile count (0x51: u8, 0x56: u16)
+    size_t targetCount = 0;
+    size_t missileCount = 0;
+    if (data[0] == static_cast<uint8_t>(CommandType::STATUS_RESPONSE_V2)) {
+        if (len < offset + 4) return false;
+        uint16_t count16;
+        std::memcpy(&count16, data + offset, 2);
+        targetCount = count16;
+        std::memcpy(&count16, data + offset + 2, 2);
+        missileCount = count16;
+        offset += 4;
+    }
+    else {
+        if (len < offset + 2) return false;
+        targetCount = data[offset++];
+        missileCount = data[offset++];
+    }
 
     // RadarStatus
     radars.clear();
@@ -96,7 +111,7 @@ bool DeserializeStatusResponse(
     // MissileStatus
     missiles.clear();
     missiles.reserve(missileCount);
-    for (uint8_t i = 0; i < missileCount; ++i) {
+    for (size_t i = 0; i < missileCount; ++i) {
         if (len < offset + sizeof(MissileStatus)) return false;
         MissileStatus missile;
         std::memcpy(&missile, data + offset, sizeof(MissileStatus));
@@ -107,7 +122,7 @@ bool DeserializeStatusResponse(
     // TargetStatus
     targets.clear();
     targets.reserve(targetCount);
-    for (uint8_t i = 0; i < targetCount; ++i) {
+    for (size_t i = 0; i < targetCount; ++i) {
         if (len < offset + sizeof(TargetStatus)) return false;
         TargetStatus target;
         std::memcpy(&target, data + offset, sizeof(TargetStatus));
@@ -115,6 +130,16 @@ bool DeserializeStatusResponse(
         offset += sizeof(TargetStatus);
     }
 
+    // 지연 추적 (0x56만, [id u32][originUs u64])
+    if (data[0] == static_cast<uint8_t>(CommandType::STATUS_RESPONSE_V2)) {
+        if (len < offset + StatusTrace::WIRE_SIZE) return false;
+        if (trace) {
+            std::memcpy(&trace->id, data + offset, 4);
+            std::memcpy(&trace->originUs, data + offset + 4, 8);
+        }
+        offset += StatusTrace::WIRE_SIZE;
+    }
+
     return true;
  //   size_t offset = 0;
 
@@ -157,3 +182,69 @@ bool DeserializeStatusResponse(
  //   return true;
 }
 
+
+bool DeserializeStatusDelta(const uint8_t* data, size_t len, StatusDelta& out)
+{
+    size_t offset = 0;
+
+    // CommandType(1) + CommandLength(4)
+    if (len < offset + 5) return false;
+    offset += 5;
+
+    // flags, version, baseVersion
+    if (len < offset + 9) return false;
+    out.flags = data[offset++];
+    std::memcpy(&out.version, data + offset, 4);
+    std::memcpy(&out.baseVersion, data + offset + 4, 4);
+    offset += 8;
+
+    out.trace = StatusTrace{};
+    if (out.flags & StatusDelta::FLAG_TRACE) {
+        if (len < offset + StatusTrace::WIRE_SIZE) return false;
+        std::memcpy(&out.trace.id, data + offset, 4);
+        std::memcpy(&out.trace.originUs, data + offset + 4, 8);
+        offset += StatusTrace::WIRE_SIZE;
+    }
+
+    // 단일 레코드: flags에 비트가 있을 때만 존재
+    auto readUnit = [&](auto& vec, uint8_t flag) -> bool {
+        using Item = typename std::remove_reference_t<decltype(vec)>::value_type;
+        vec.clear();
+        if (!(out.flags & flag)) return true;
+        if (len < offset + sizeof(Item)) return false;
+        Item item;
+        std::memcpy(&item, data + offset, sizeof(Item));
+        vec.push_back(item);
+        offset += sizeof(Item);
+        return true;
+    };
+
+    // [u16 개수][레코드...][u16 개수][id u32...]
+    auto readTable = [&](auto& upserts, std::vector<uint32_t>& removed) -> bool {
+        using Item = typename std::remove_reference_t<decltype(upserts)>::value_type;
+        uint16_t count;
+
+        if (len < offset + 2) return false;
+        std::memcpy(&count, data + offset, 2);
+        offset += 2;
+        if (len < offset + static_cast<size_t>(count) * sizeof(Item)) return false;
+        upserts.resize(count);
+        if (count > 0) std::memcpy(upserts.data(), data + offset, count * sizeof(Item));
+        offset += count * sizeof(Item);
+
+        if (len < offset + 2) return false;
+        std::memcpy(&count, data + offset, 2);
+        offset += 2;
+        if (len < offset + static_cast<size_t>(count) * 4) return false;
+        removed.resize(count);
+        if (count > 0) std::memcpy(removed.data(), data + offset, count * 4);
+        offset += count * 4;
+        return true;
+    };
+
+    return readUnit(out.radars, StatusDelta::FLAG_RADAR) &&
+        readUnit(out.lss, StatusDelta::FLAG_LS) &&
+        readUnit(out.lcs, StatusDelta::FLAG_LC) &&
+        readTable(out.missileUpserts, out.missileRemoved) &&
+        readTable(out.targetUpserts, out.targetRemoved);
+}
@@ -10,12 +10,15 @@ bool DeserializeRadarModeAck(const uint8_t* data, size_t len, RadarModeChangeAck
 bool DeserializeLSModeAck(const uint8_t* data, size_t len, LSModeChangeAck& out);
 bool DeserializeMissileAck(const uint8_t* data, size_t len, MissileLaunchAck& out);
 bool DeserializeLSMoveAck(const uint8_t* data, size_t len, LSMoveAck& out);
-//   ޽ Ľ Լ
+//   ޽ Ľ Լ (v2     trace , nullptr̸ ǳʶ)
 bool DeserializeStatusResponse(
     const uint8_t* data, size_t len,
     std::vector<RadarStatus>& radars,
     std::vector<LCStatus>& lcs,
     std::vector<LSStatus>& lss,
     std::vector<TargetStatus>& targets,
-    std::vector<MissileStatus>& missiles
-);
\ No newline at end of file
+    std::vector<MissileStatus>& missiles,
+    StatusTrace* trace = nullptr
+);
+//  Ǫ(0x57) Ľ Լ
+bool DeserializeStatusDelta(const uint8_t* data, size_t len, StatusDelta& out);
\ No newline at end of file
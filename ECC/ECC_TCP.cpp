@@ -74,7 +74,21 @@ void ECC_TCP::send(const char* data, int len)
 {
     if (m_sock != INVALID_SOCKET)
     {
-        ::send(m_sock, data, len, 0);
+        // LC 스트림 프레임: [length u32 LE][payload]
+        char prefix[FRAME_PREFIX_SIZE] = {
+            static_cast<char>(len & 0xFF),
+            static_cast<char>((len >> 8) & 0xFF),
+            static_cast<char>((len >> 16) & 0xFF),
+            static_cast<char>((len >> 24) & 0xFF),
+        };
+        WSABUF bufs[2];
+        bufs[0].buf = prefix;
+        bufs[0].len = FRAME_PREFIX_SIZE;
+        bufs[1].buf = const_cast<char*>(data);
+        bufs[1].len = static_cast<ULONG>(len);
+
+        DWORD sent = 0;
+        WSASend(m_sock, bufs, 2, &sent, 0, nullptr, nullptr);
     }
 }
 
@@ -100,46 +114,45 @@ unsigned __stdcall ECC_TCP::recvThread(void* arg) {
         // 1. 수신된 데이터 누적
         buffer.insert(buffer.end(), tempBuf, tempBuf + len);
 
-        // 2. 가능한 만큼 완전한 메시지를 처리
+        // 2. 가능한 만큼 완전한 프레임을 처리 ([length u32][payload])
         while (true)
         {
-            if (buffer.size() < 5)
+            if (buffer.size() < FRAME_PREFIX_SIZE)
             {
-                std::cout << "buffer.size() < 5  " << "\n";
-                break;  // 최소 헤더(1+4) 미만이면 break
+                break;
             }
 
-            // 싱크 맞추기
-            if (buffer[0] != 0x51)
+            uint32_t frameLen;
+            std::memcpy(&frameLen, &buffer[0], FRAME_PREFIX_SIZE);
+            if (frameLen > MAX_FRAME_SIZE)
             {
-                std::cout << "buffer[0] != 0x51" << "\n";
-                buffer.erase(buffer.begin());
-                continue;
+                std::cout << "[WARN] Invalid frame length. Dropping receive buffer.\n";
+                buffer.clear();
+                break;
             }
 
-            // 메시지 길이 확인
-            uint32_t payloadSize;
-            std::memcpy(&payloadSize, &buffer[1], 4);
-            size_t totalMsgSize = 1 + 4 + payloadSize;
-
-            // 전체 메시지가 도착하지 않았다면 대기
-            if (buffer.size() < totalMsgSize)
+            // 전체 프레임이 도착하지 않았다면 대기
+            size_t totalFrameSize = FRAME_PREFIX_SIZE + frameLen;
+            if (buffer.size() < totalFrameSize)
             {
-                std::cout << "buffer.size() < totalMsgSize" << "\n";
                 break;
-            }             
+            }
 
-            // 헤더 다음 3바이트 (radar/lc/ls flag) 검증
-            if (totalMsgSize < 8 ||  // 1+4+3보다 작다면 구조 자체가 이상함
-                buffer[5] != 0x01 || buffer[6] != 0x01 || buffer[7] != 0x01) {
+            // 메시지 헤더(0x51/0x56 + 길이) 다음 3바이트 (radar/lc/ls flag) 검증
+            // 상태 푸시(0x57)는 해당 자리가 flags/version이라 검사하지 않음
+            const uint8_t* frame = buffer.data() + FRAME_PREFIX_SIZE;
+            const bool isFullStatus = frameLen >= 8 && (frame[0] == 0x51 || frame[0] == 0x56);
+            const bool isStatusDelta = frameLen >= 14 && frame[0] == 0x57;
+            if (!isStatusDelta && (!isFullStatus ||
+                frame[5] != 0x01 || frame[6] != 0x01 || frame[7] != 0x01)) {
                 std::cout << "[WARN] Invalid radar/lc/ls header flags. Dropping message.\n";
-                buffer.erase(buffer.begin(), buffer.begin() + totalMsgSize);
+                buffer.erase(buffer.begin(), buffer.begin() + totalFrameSize);
                 continue;
             }
 
             // 메시지 유효, 처리
-            const uint8_t* msgData = buffer.data();
-            size_t msgLen = totalMsgSize;
+            const uint8_t* msgData = frame;
+            size_t msgLen = frameLen;
 
             std::cout << "[RECV] MsgLen: " << msgLen << " | Data: ";
             for (size_t i = 0; i < msgLen; ++i) {
@@ -154,7 +167,8 @@ unsigned __stdcall ECC_TCP::recvThread(void* arg) {
                 self->m_receiver->receive(msgLen, reinterpret_cast<const char*>(msgData));
             }
 
-            if (self->map_tcp)
+            // 지도 화면은 전체 상태(0x51)만 해석하므로 푸시 변경분은 넘기지 않음
+            if (self->map_tcp && isFullStatus)
             {
                 std::cout << "self->map_tc" << "\n";
                 //self->map_tcp->send(reinterpret_cast<const char*>(msgData), msgLen);
@@ -162,7 +176,7 @@ unsigned __stdcall ECC_TCP::recvThread(void* arg) {
             }
 
             // 처리한 메시지를 버퍼에서 제거
-            buffer.erase(buffer.begin(), buffer.begin() + totalMsgSize);
+            buffer.erase(buffer.begin(), buffer.begin() + totalFrameSize);
         }
     }
 
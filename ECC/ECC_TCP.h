@@ -4,6 +4,7 @@
 #include <process.h> 
 #include "MAP_TCP.h"
 #include <memory>
+#include <cstdint>
 
 class ECC_TCP {
 public:
@@ -17,6 +18,9 @@ public:
     void registerReceiver(IReceiver* receiver);
 
 private:
+    static constexpr int FRAME_PREFIX_SIZE = 4;            // LC 스트림 프레임 길이 접두
+    static constexpr uint32_t MAX_FRAME_SIZE = 1024 * 1024;
+
     SOCKET m_sock = INVALID_SOCKET;
     IReceiver* m_receiver = nullptr;
     bool m_bRunning = false;
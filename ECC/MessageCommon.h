@@ -8,11 +8,14 @@ enum class CommandType : uint8_t {
     LS_MODE_CHANGE = 0x03,
     MISSILE_LAUNCH = 0x04,
 	LS_MOVE = 0x05,
+	STATUS_SUBSCRIBE = 0x06, //  Ǫ  /  Ȯ
 	STATUS_RESPONSE = 0x51, //   ޽
 	RADAR_MODE_CHANGE_ACK = 0x52, // ̴   
 	LS_MODE_CHANGE_ACK = 0x53, // ߻   
 	MISSILE_LAUNCH_ACK = 0x54, // ź ߻ 
-	LS_MOVE_ACK = 0x55 // ߻ ̵ 
+	LS_MOVE_ACK = 0x55, // ߻ ̵ 
+	STATUS_RESPONSE_V2 = 0x56, //   v2 (ǥ/̻  u16)
+	STATUS_DELTA = 0x57 //  Ǫ (Ű Ǵ )
 };
 
 struct Pos2D {
@@ -2,11 +2,77 @@
 #include "pch.h"
 #include "PacketParser.h"
 #include "Deserializer.h"
+#include "../Common/Trace.h"
 #include <iostream>
 #include <iomanip>
+#include <cstdio>
 #include <cstring>
+#include <map>
 #include <stdexcept>
 
+//  Ǫ(0x57)   :    ü 
+// Parse  忡 ȣȴ
+namespace
+{
+    struct StatusPushState {
+        uint32_t version = 0; // 0̸ Ű 
+        std::vector<RadarStatus> radars;
+        std::vector<LCStatus> lcs;
+        std::vector<LSStatus> lss;
+        std::map<uint32_t, MissileStatus> missiles;
+        std::map<uint32_t, TargetStatus> targets;
+    };
+
+    StatusPushState g_pushState;
+
+    // ߻ ð(ùķ)  ,  忡 ϰ   
+    trace::LatencyHistogram g_parseLatency;
+    trace::LatencyHistogram g_displayLatency;
+
+    trace::Context ToContext(const StatusTrace& t)
+    {
+        return trace::Context{ t.id, t.originUs };
+    }
+
+    ParsedStatusResponse ApplyStatusDelta(const StatusDelta& delta)
+    {
+        StatusPushState& st = g_pushState;
+        ParsedStatusResponse result;
+
+        const bool keyframe = (delta.flags & StatusDelta::FLAG_KEYFRAME) != 0;
+        if (!keyframe && (st.version == 0 || delta.baseVersion != st.version)) {
+            // ߰  ħ  ŰӺ ٽ ޴´
+            st.version = 0;
+            result.resyncRequired = true;
+            return result;
+        }
+
+        if (keyframe) {
+            st.missiles.clear();
+            st.targets.clear();
+        }
+        if (!delta.radars.empty()) st.radars = delta.radars;
+        if (!delta.lss.empty()) st.lss = delta.lss;
+        if (!delta.lcs.empty()) st.lcs = delta.lcs;
+
+        for (const auto& m : delta.missileUpserts) st.missiles[m.id] = m;
+        for (uint32_t id : delta.missileRemoved) st.missiles.erase(id);
+        for (const auto& t : delta.targetUpserts) st.targets[t.id] = t;
+        for (uint32_t id : delta.targetRemoved) st.targets.erase(id);
+        st.version = delta.version;
+
+        result.radarList = st.radars;
+        result.lcList = st.lcs;
+        result.lsList = st.lss;
+        result.missileList.reserve(st.missiles.size());
+        for (const auto& kv : st.missiles) result.missileList.push_back(kv.second);
+        result.targetList.reserve(st.targets.size());
+        for (const auto& kv : st.targets) result.targetList.push_back(kv.second);
+        result.pushVersion = delta.version;
+        return result;
+    }
+}
+
 static void DebugPrintHex(const char* buffer, size_t length)
 {
 #ifdef _DEBUG //  忡   ǰ 
@@ -31,6 +97,29 @@ static void DebugPrintHex(const char* buffer, size_t length)
 #endif
 }
 
+void PacketParser::RecordDisplayed(const StatusTrace& trace)
+{
+    g_displayLatency.recordSince(ToContext(trace));
+}
+
+std::string PacketParser::LatencySummary()
+{
+    std::string text;
+    auto append = [&](const char* name, const trace::LatencyHistogram& h) {
+        const auto s = h.summary();
+        char line[256];
+        std::snprintf(line, sizeof(line),
+            "[trace] %s n=%llu mean=%lluus p50=%lluus p90=%lluus p99=%lluus p99.9=%lluus max=%lluus skewed=%llu\n",
+            name, (unsigned long long)s.count, (unsigned long long)s.meanUs, (unsigned long long)s.p50Us,
+            (unsigned long long)s.p90Us, (unsigned long long)s.p99Us, (unsigned long long)s.p999Us,
+            (unsigned long long)s.maxUs, (unsigned long long)s.skewed);
+        text += line;
+    };
+    append("ecc.parse", g_parseLatency);
+    append("ecc.display", g_displayLatency);
+    return text;
+}
+
 ParsedPacket PacketParser::Parse(const char* buffer, size_t length)
 {
     DebugPrintHex(buffer, length);
@@ -44,15 +133,17 @@ ParsedPacket PacketParser::Parse(const char* buffer, size_t length)
 
     switch (type)
     {
-    case CommandType::STATUS_RESPONSE: {
+    case CommandType::STATUS_RESPONSE:
+    case CommandType::STATUS_RESPONSE_V2: {
         std::vector<RadarStatus> radars;
         std::vector<LCStatus> lcs;
         std::vector<LSStatus> lss;
         std::vector<TargetStatus> targets;
         std::vector<MissileStatus> missiles;
 
+        StatusTrace statusTrace;
         bool ok = DeserializeStatusResponse(
-            data, length, radars, lcs, lss, targets, missiles
+            data, length, radars, lcs, lss, targets, missiles, &statusTrace
         );
 
         if (!ok) {
@@ -65,7 +156,21 @@ ParsedPacket PacketParser::Parse(const char* buffer, size_t length)
 		result.lsList = std::move(lss);
         result.targetList = std::move(targets);
         result.missileList = std::move(missiles);
+        result.trace = statusTrace;
+
+        g_parseLatency.recordSince(ToContext(statusTrace));
+        return result;
+    }
+
+    case CommandType::STATUS_DELTA: {
+        StatusDelta delta;
+        if (!DeserializeStatusDelta(data, length, delta)) {
+            throw std::runtime_error("Failed to deserialize StatusDelta");
+        }
+        ParsedStatusResponse result = ApplyStatusDelta(delta);
+        result.trace = delta.trace;
 
+        g_parseLatency.recordSince(ToContext(delta.trace));
         return result;
     }
 
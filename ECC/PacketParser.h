@@ -1,8 +1,14 @@
 #pragma once
 #include <cstddef>
+#include <string>
 #include "ParsedPacket.h"
 
 class PacketParser {
 public:
     static ParsedPacket Parse(const char* buffer, size_t length);
+
+    // 지연 추적: 상태 화면 반영 시각 기록 (Parse 시각은 Parse 안에서 기록)
+    static void RecordDisplayed(const StatusTrace& trace);
+    // 구간별 지연 요약 (발생 시각 기준 ecc.parse / ecc.display)
+    static std::string LatencySummary();
 };
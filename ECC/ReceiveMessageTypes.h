@@ -23,10 +23,49 @@ struct StatusHeader {
 #pragma pack(pop)
 
 //    ü ؼ 
+//    (LC   v2  /  Ǫ FLAG_TRACE), id 0̸ 
+struct StatusTrace {
+    static constexpr size_t WIRE_SIZE = 12; // [id u32][originUs u64]
+
+    uint32_t id = 0;
+    uint64_t originUs = 0; // ùķ ߻ ð (system_clock epoch us)
+};
+
 struct ParsedStatusResponse {
     std::vector<RadarStatus> radarList;
     std::vector<LCStatus> lcList;
     std::vector<LSStatus> lsList;
     std::vector<TargetStatus> targetList;
     std::vector<MissileStatus> missileList;
+
+    //  Ǫ(0x57) ŵ :   (LC ack),  ̸ 0
+    uint32_t pushVersion = 0;
+    //    ʾ    (0) û ʿ,   
+    bool resyncRequired = false;
+    //  ° ݿ  ֱ Ž   
+    StatusTrace trace;
+};
+
+//  Ǫ(0x57)  
+// [0x57][len u32][flags u8][version u32][baseVersion u32][trace (FLAG_TRACE)][MFR][LS][LC]
+// [missile upsert u16][MissileStatus...][missile removed u16][id u32...]
+// [target upsert u16][TargetStatus...][target removed u16][id u32...]
+struct StatusDelta {
+    static constexpr uint8_t FLAG_KEYFRAME = 0x01;
+    static constexpr uint8_t FLAG_RADAR = 0x02;
+    static constexpr uint8_t FLAG_LS = 0x04;
+    static constexpr uint8_t FLAG_LC = 0x08;
+    static constexpr uint8_t FLAG_TRACE = 0x10;
+
+    uint8_t flags = 0;
+    uint32_t version = 0;
+    uint32_t baseVersion = 0;
+    std::vector<RadarStatus> radars; // flags ش Ʈ   1
+    std::vector<LSStatus> lss;
+    std::vector<LCStatus> lcs;
+    std::vector<MissileStatus> missileUpserts;
+    std::vector<uint32_t> missileRemoved;
+    std::vector<TargetStatus> targetUpserts;
+    std::vector<uint32_t> targetRemoved;
+    StatusTrace trace;
 };
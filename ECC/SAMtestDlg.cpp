@@ -183,7 +183,16 @@ BOOL CSAMtestDlg::OnInitDialog()
 	m_tcp->registerReceiver(this);
 	m_tcp->startReceiving();
 
-	SetTimer(TIMER_ID_REQUEST, 100, nullptr);
+	// 푸시 모드면 구독만 하고 LC가 변경분을 보내줌, 아니면 주기적 상태 요청
+	m_statusPush = config.LCStatusPush;
+	if (m_statusPush)
+	{
+		sendStatusSubscribe(0);
+	}
+	else
+	{
+		SetTimer(TIMER_ID_REQUEST, 100, nullptr);
+	}
 
 	return TRUE;
 }
@@ -266,6 +275,17 @@ void CSAMtestDlg::receive(int len, const char* packet)
 
 			if constexpr (std::is_same_v<T, ParsedStatusResponse>)
 			{
+				// 푸시 기준 버전 불일치 → 키프레임 재요청, 이번 화면 갱신은 건너뜀
+				if (msg.resyncRequired)
+				{
+					sendStatusSubscribe(0);
+					return;
+				}
+				if (msg.pushVersion != 0)
+				{
+					sendStatusSubscribe(msg.pushVersion);
+				}
+
 				static bool printed = false;
 				if (!printed)
 				{
@@ -292,6 +312,7 @@ void CSAMtestDlg::receive(int len, const char* packet)
 				m_targetDlg.SetTargetList(msg.targetList);
 
 				m_targetListDlg.SetTargetList(msg.targetList);
+				PacketParser::RecordDisplayed(msg.trace);
 
 				if (!msg.missileList.empty() && goalTargetId != -1)
 				{
@@ -333,6 +354,13 @@ void CSAMtestDlg::sendStatusRequest()
 	m_tcp->send(reinterpret_cast<const char*>(data.data()), static_cast<int>(data.size()));
 }
 
+void CSAMtestDlg::sendStatusSubscribe(uint32_t ack_version)
+{
+	StatusSubscribe msg{ CommandType::STATUS_SUBSCRIBE, ack_version };
+	auto data = SerializeStatusSubscribe(msg);
+	m_tcp->send(reinterpret_cast<const char*>(data.data()), static_cast<int>(data.size()));
+}
+
 void CSAMtestDlg::sendRadarModeChange(unsigned int radar_id, uint8_t mode, uint8_t priority_select, unsigned int target_id) 
 {
 	RadarModeChange msg{ CommandType::RADAR_MODE_CHANGE, radar_id, mode, priority_select, target_id };
@@ -380,4 +408,7 @@ void CSAMtestDlg::OnDestroy()
 	{
 		m_tcp->stop();  // 수신 스레드 종료
 	}
+
+	// 구간별 지연 (시뮬레이터 발생 시각 기준)
+	std::cout << PacketParser::LatencySummary();
 }
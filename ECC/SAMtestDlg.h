@@ -32,11 +32,13 @@ private:
 	//std::vector<uint8_t> m_receiveBuffer;
 	//CMockTrack m_mockTrack;
 	int goalTargetId = -1;
+	bool m_statusPush = false;  // LC 상태 푸시 구독 모드
 
 public:
 	CSAMtestDlg(CWnd* pParent = nullptr);
 	//void init(ECC_TCP* tcp);  // ❓ 외부에서 주입한다면 여전히 포인터일 수도 있음
 	void sendStatusRequest();
+	void sendStatusSubscribe(uint32_t ack_version);
 	void sendRadarModeChange(unsigned int radar_id, uint8_t mode, uint8_t priority_select, unsigned int target_id);
 	void sendLSModeChange(unsigned int ls_id, uint8_t mode);
 	void sendMissileLaunch(unsigned int ls_id, unsigned int target_id);
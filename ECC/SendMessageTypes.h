@@ -36,5 +36,10 @@ struct LSMove {
 	unsigned int ls_id;
 	Pos2D position;  // 16 byte (x + y)
 };
+// [0x06]  Ǫ  /  Ȯ ? 5 byte
+struct StatusSubscribe {
+	CommandType commandType = CommandType::STATUS_SUBSCRIBE;
+	uint32_t ack_version; //   Ǫ , 0̸  (Ű û)
+};
 
 #pragma pack(pop)
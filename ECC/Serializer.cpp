@@ -36,3 +36,10 @@ std::vector<uint8_t> SerializeStatusRequest(const StatusRequest& msg)
     std::memcpy(buffer.data(), &msg, sizeof(StatusRequest));
     return buffer;
 }
+
+std::vector<uint8_t> SerializeStatusSubscribe(const StatusSubscribe& msg)
+{
+    std::vector<uint8_t> buffer(sizeof(StatusSubscribe));
+    std::memcpy(buffer.data(), &msg, sizeof(StatusSubscribe));
+    return buffer;
+}
@@ -9,4 +9,5 @@ std::vector<uint8_t> SerializeRadarModeChange(const RadarModeChange& msg);
 std::vector<uint8_t> SerializeLSModeChange(const LSModeChange& msg);
 std::vector<uint8_t> SerializeMissileLaunch(const MissileLaunch& msg);
 std::vector<uint8_t> SerializeStatusRequest(const StatusRequest& msg);
-std::vector<uint8_t> SerializeLSMove(const LSMove& msg);
\ No newline at end of file
+std::vector<uint8_t> SerializeLSMove(const LSMove& msg);
+std::vector<uint8_t> SerializeStatusSubscribe(const StatusSubscribe& msg);
\ No newline at end of file
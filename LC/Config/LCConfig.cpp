@@ -70,6 +70,18 @@ bool loadConfig(const std::string &filepath, ConfigCommon &config)
             {
                 config.ECCRecvPort = std::stoi(value);
             }
+            else if (key == "StatusVersion")
+            {
+                config.ECCStatusVersion = std::stoi(value);
+            }
+            else if (key == "PushIntervalMs")
+            {
+                config.ECCPushIntervalMs = std::stoi(value);
+            }
+            else if (key == "KeyframeInterval")
+            {
+                config.ECCKeyframeInterval = std::stoi(value);
+            }
         }
         else if (currentSection == "MFR")
         {
@@ -81,6 +93,14 @@ bool loadConfig(const std::string &filepath, ConfigCommon &config)
             {
                 config.MFRRecvPort = std::stoi(value);
             }
+            else if (key == "StatusPollMs")
+            {
+                config.MFRStatusPollMs = std::stoi(value);
+            }
+            else if (key == "LockedStatusPollMs")
+            {
+                config.MFRLockedStatusPollMs = std::stoi(value);
+            }
         }
         else if (currentSection == "LS")
         {
@@ -96,6 +116,62 @@ bool loadConfig(const std::string &filepath, ConfigCommon &config)
             {
                 config.LSSendPort = std::stoi(value);
             }
+            else if (key == "StatusPollMs")
+            {
+                config.LSStatusPollMs = std::stoi(value);
+            }
+        }
+        else if (currentSection == "Reactor")
+        {
+            if (key == "Cpu")
+            {
+                config.ReactorCpu = std::stoi(value);
+            }
+            else if (key == "TickMs")
+            {
+                config.ReactorTickMs = std::stoi(value);
+            }
+        }
+        else if (currentSection == "Log")
+        {
+            if (key == "Parser")
+            {
+                config.LogParser = (value == "1" || toLower(value) == "true");
+            }
+            else if (key == "File")
+            {
+                config.LogFile = value;
+            }
+        }
+        else if (currentSection == "Capture")
+        {
+            if (key == "Dir")
+            {
+                config.CaptureDir = value;
+            }
+            else if (key == "SegmentMB")
+            {
+                config.CaptureSegmentMB = std::stoi(value);
+            }
+        }
+        else if (currentSection == "Track")
+        {
+            if (key == "Alpha")
+            {
+                config.TrackAlpha = std::stod(value);
+            }
+            else if (key == "Beta")
+            {
+                config.TrackBeta = std::stod(value);
+            }
+            else if (key == "MaxPredictMs")
+            {
+                config.TrackMaxPredictMs = std::stoi(value);
+            }
+            else if (key == "ResetMs")
+            {
+                config.TrackResetMs = std::stoi(value);
+            }
         }
         else
         {
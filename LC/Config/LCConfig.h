@@ -8,13 +8,33 @@ struct ConfigCommon
 {
     std::string ECCRecvIP;
     int ECCRecvPort = 0; // ECC Receive Port
+    int ECCStatusVersion = 1; // 상태 응답 포맷 (1: 0x51, 2: 0x56 개수 u16)
+    int ECCPushIntervalMs = 100; // 구독한 ECC에 상태 푸시(0x57) 주기 (0: 푸시 안 함)
+    int ECCKeyframeInterval = 50; // 푸시 몇 번마다 전체 상태(키프레임)를 보낼지
 
     std::string MFRRecvIP; // MFR Receive IP
     int MFRRecvPort = 0;
+    int MFRStatusPollMs = 1000;       // MFR 상태 폴링(0x11) 주기
+    int MFRLockedStatusPollMs = 100;  // 표적 잠금 중 MFR 상태 폴링 주기
 
     std::string LSSendIP;
     int LSRecvPort = 0;
     int LSSendPort = 0;
+    int LSStatusPollMs = 1000; // LS 상태 폴링(0x34) 주기
+
+    int ReactorCpu = -1; // 리액터 스레드 고정 코어 (-1: 고정 안 함)
+    int ReactorTickMs = 10; // 타이머 휠 tick
+
+    bool LogParser = false; // 수신 메시지 파싱 내용 출력
+    std::string LogFile;    // 비동기 로그 출력 파일 (비면 콘솔)
+
+    std::string CaptureDir;    // 수신 프레임 캡처 디렉터리 (비면 캡처 안 함)
+    int CaptureSegmentMB = 64; // 캡처 세그먼트 파일 크기
+
+    double TrackAlpha = 0.5;       // 추적 필터 위치 이득
+    double TrackBeta = 0.2;        // 추적 필터 속도 이득
+    int TrackMaxPredictMs = 2000;  // 마지막 보고 이후 외삽 상한
+    int TrackResetMs = 5000;       // 보고 간격이 이보다 길면 트랙 재시작
 };
 
 // 공백 제거 및 문자열 처리 유틸 함수 선언
@@ -0,0 +1,399 @@
+#include "FrameCapture.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace capture
+{
+    namespace
+    {
+        constexpr size_t USED_BYTES_OFFSET = 8;
+        constexpr size_t INDEX_OFFSET = 16;
+        constexpr size_t CREATED_OFFSET = 24;
+
+        bool makeDir(const std::string &path)
+        {
+            if (mkdir(path.c_str(), 0755) == 0 || errno == EEXIST)
+            {
+                return true;
+            }
+            std::cerr << "[capture] 디렉터리 생성 실패: " << path << " (" << std::strerror(errno) << ")\n";
+            return false;
+        }
+
+        std::string segmentPath(const std::string &sessionDir, uint32_t index)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "/seg-%06u.lccap", index);
+            return sessionDir + name;
+        }
+    }
+
+    uint64_t monotonicNs()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    // ---------------------------------------------------------------- 캡처
+
+    FrameWriter::~FrameWriter()
+    {
+        close();
+    }
+
+    bool FrameWriter::open(const std::string &dir, size_t segmentBytes)
+    {
+        close();
+        segmentBytes_ = std::max(segmentBytes, SEGMENT_HEADER_SIZE + RECORD_HEADER_SIZE);
+        if (!makeDir(dir))
+        {
+            return false;
+        }
+
+        // 세션 디렉터리: 시작 시각 (같은 초에 다시 열면 _1, _2 ...)
+        char stamp[32];
+        const std::time_t now = std::time(nullptr);
+        std::tm tm{};
+        localtime_r(&now, &tm);
+        std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &tm);
+
+        std::string session = dir + "/" + stamp;
+        for (int suffix = 1; mkdir(session.c_str(), 0755) != 0; ++suffix)
+        {
+            if (errno != EEXIST || suffix > 100)
+            {
+                std::cerr << "[capture] 세션 디렉터리 생성 실패: " << session << " (" << std::strerror(errno) << ")\n";
+                return false;
+            }
+            session = dir + "/" + stamp + "_" + std::to_string(suffix);
+        }
+
+        sessionDir_ = session;
+        segmentIndex_ = 0;
+        frames_ = 0;
+        return openSegment(0);
+    }
+
+    bool FrameWriter::append(SenderType sender, const uint8_t *data, size_t len)
+    {
+        if (base_ == nullptr || len > UINT32_MAX)
+        {
+            return false;
+        }
+
+        const size_t need = RECORD_HEADER_SIZE + len;
+        if (used_ + need > mapped_)
+        {
+            closeSegment();
+            ++segmentIndex_;
+            if (!openSegment(need))
+            {
+                return false;
+            }
+        }
+
+        uint8_t *p = base_ + used_;
+        const uint64_t ts = monotonicNs();
+        const uint32_t len32 = static_cast<uint32_t>(len);
+        std::memcpy(p, &ts, 8);
+        p[8] = static_cast<uint8_t>(sender);
+        std::memcpy(p + 9, &len32, 4);
+        if (len > 0)
+        {
+            std::memcpy(p + RECORD_HEADER_SIZE, data, len);
+        }
+
+        // 레코드를 다 쓴 뒤에 유효 길이 갱신
+        used_ += need;
+        const uint64_t used64 = used_;
+        std::memcpy(base_ + USED_BYTES_OFFSET, &used64, 8);
+        ++frames_;
+        return true;
+    }
+
+    void FrameWriter::close()
+    {
+        closeSegment();
+    }
+
+    bool FrameWriter::openSegment(size_t minBytes)
+    {
+        const size_t size = std::max(segmentBytes_, SEGMENT_HEADER_SIZE + minBytes);
+        const std::string path = segmentPath(sessionDir_, segmentIndex_);
+
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0)
+        {
+            std::cerr << "[capture] 세그먼트 열기 실패: " << path << " (" << std::strerror(errno) << ")\n";
+            return false;
+        }
+        if (ftruncate(fd_, static_cast<off_t>(size)) != 0)
+        {
+            std::cerr << "[capture] 세그먼트 크기 설정 실패: " << path << " (" << std::strerror(errno) << ")\n";
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+
+        void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mem == MAP_FAILED)
+        {
+            std::cerr << "[capture] 세그먼트 mmap 실패: " << path << " (" << std::strerror(errno) << ")\n";
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+
+        base_ = static_cast<uint8_t *>(mem);
+        mapped_ = size;
+        used_ = SEGMENT_HEADER_SIZE;
+
+        const uint64_t used64 = used_;
+        const uint64_t createdUs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                                                             std::chrono::system_clock::now().time_since_epoch())
+                                                             .count());
+        std::memset(base_, 0, SEGMENT_HEADER_SIZE);
+        std::memcpy(base_, MAGIC, sizeof(MAGIC));
+        std::memcpy(base_ + USED_BYTES_OFFSET, &used64, 8);
+        std::memcpy(base_ + INDEX_OFFSET, &segmentIndex_, 4);
+        std::memcpy(base_ + CREATED_OFFSET, &createdUs, 8);
+        return true;
+    }
+
+    void FrameWriter::closeSegment()
+    {
+        if (base_ == nullptr)
+        {
+            return;
+        }
+        munmap(base_, mapped_);
+        base_ = nullptr;
+
+        // 남은 공간을 잘라 실제 기록 크기만 남김
+        if (ftruncate(fd_, static_cast<off_t>(used_)) != 0)
+        {
+            std::cerr << "[capture] 세그먼트 정리 실패 (" << std::strerror(errno) << ")\n";
+        }
+        ::close(fd_);
+        fd_ = -1;
+        mapped_ = 0;
+        used_ = 0;
+    }
+
+    // ---------------------------------------------------------------- 읽기
+
+    FrameReader::~FrameReader()
+    {
+        closeSegment();
+    }
+
+    bool FrameReader::open(const std::string &sessionDir)
+    {
+        closeSegment();
+        segments_.clear();
+        nextSegment_ = 0;
+        corrupt_ = false;
+
+        DIR *dir = opendir(sessionDir.c_str());
+        if (dir == nullptr)
+        {
+            std::cerr << "[capture] 세션 디렉터리 열기 실패: " << sessionDir << " (" << std::strerror(errno) << ")\n";
+            return false;
+        }
+        while (const dirent *entry = readdir(dir))
+        {
+            const std::string name = entry->d_name;
+            if (name.size() > 10 && name.compare(0, 4, "seg-") == 0 &&
+                name.compare(name.size() - 6, 6, ".lccap") == 0)
+            {
+                segments_.push_back(sessionDir + "/" + name);
+            }
+        }
+        closedir(dir);
+
+        // seg-%06u 이름이라 사전순 = 기록 순서
+        std::sort(segments_.begin(), segments_.end());
+        if (segments_.empty())
+        {
+            std::cerr << "[capture] 세그먼트가 없습니다: " << sessionDir << "\n";
+            return false;
+        }
+        return true;
+    }
+
+    bool FrameReader::next(Frame &out)
+    {
+        while (base_ == nullptr || offset_ >= used_)
+        {
+            closeSegment();
+            if (nextSegment_ >= segments_.size())
+            {
+                return false;
+            }
+            if (!openSegment(segments_[nextSegment_++]))
+            {
+                return fail(0);
+            }
+        }
+
+        if (used_ - offset_ < RECORD_HEADER_SIZE)
+        {
+            std::cerr << "[capture] 레코드 헤더 손상 (segment " << nextSegment_ - 1 << ", offset " << offset_ << ")\n";
+            return fail(offset_);
+        }
+
+        const uint8_t *p = base_ + offset_;
+        uint32_t len;
+        std::memcpy(&out.monoNs, p, 8);
+        out.sender = static_cast<SenderType>(p[8]);
+        std::memcpy(&len, p + 9, 4);
+        if (used_ - offset_ - RECORD_HEADER_SIZE < len)
+        {
+            std::cerr << "[capture] 레코드 길이 손상 (segment " << nextSegment_ - 1 << ", offset " << offset_ << ")\n";
+            return fail(offset_);
+        }
+
+        out.data = p + RECORD_HEADER_SIZE;
+        out.size = len;
+        offset_ += RECORD_HEADER_SIZE + len;
+        return true;
+    }
+
+    bool FrameReader::openSegment(const std::string &path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            std::cerr << "[capture] 세그먼트 열기 실패: " << path << " (" << std::strerror(errno) << ")\n";
+            return false;
+        }
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < SEGMENT_HEADER_SIZE)
+        {
+            std::cerr << "[capture] 세그먼트 크기 오류: " << path << "\n";
+            ::close(fd);
+            return false;
+        }
+
+        const size_t size = static_cast<size_t>(st.st_size);
+        void *mem = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mem == MAP_FAILED)
+        {
+            std::cerr << "[capture] 세그먼트 mmap 실패: " << path << " (" << std::strerror(errno) << ")\n";
+            return false;
+        }
+
+        base_ = static_cast<const uint8_t *>(mem);
+        mapped_ = size;
+
+        uint64_t used64;
+        std::memcpy(&used64, base_ + USED_BYTES_OFFSET, 8);
+        if (std::memcmp(base_, MAGIC, sizeof(MAGIC)) != 0 || used64 < SEGMENT_HEADER_SIZE || used64 > size)
+        {
+            std::cerr << "[capture] 세그먼트 헤더 오류: " << path << "\n";
+            closeSegment();
+            return false;
+        }
+
+        used_ = static_cast<size_t>(used64);
+        offset_ = SEGMENT_HEADER_SIZE;
+        return true;
+    }
+
+    bool FrameReader::fail(size_t offset)
+    {
+        corrupt_ = true;
+        corruptSegment_ = nextSegment_ - 1;
+        corruptOffset_ = offset;
+        closeSegment();
+        nextSegment_ = segments_.size(); // 손상 이후는 읽지 않음
+        return false;
+    }
+
+    void FrameReader::closeSegment()
+    {
+        if (base_ != nullptr)
+        {
+            munmap(const_cast<uint8_t *>(base_), mapped_);
+        }
+        base_ = nullptr;
+        mapped_ = 0;
+        used_ = 0;
+        offset_ = 0;
+    }
+
+    // ---------------------------------------------------------------- 재생
+
+    bool replay(const std::string &sessionDir, double speed, const std::function<void(const Frame &)> &onFrame,
+                ReplayStats &stats)
+    {
+        stats = ReplayStats{};
+
+        FrameReader reader;
+        if (!reader.open(sessionDir))
+        {
+            return false;
+        }
+
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point start = Clock::now();
+        uint64_t firstNs = 0;
+        uint64_t lastNs = 0;
+
+        Frame frame;
+        while (reader.next(frame))
+        {
+            if (stats.frames == 0)
+            {
+                firstNs = frame.monoNs;
+            }
+            lastNs = std::max(lastNs, frame.monoNs);
+
+            if (speed > 0.0)
+            {
+                // 녹화 간격 / speed 만큼 벌려서 넘김 (누적 기준이라 처리 지연이 쌓이지 않음)
+                const double offsetNs = static_cast<double>(frame.monoNs - std::min(frame.monoNs, firstNs)) / speed;
+                const Clock::time_point due = start + std::chrono::nanoseconds(static_cast<int64_t>(offsetNs));
+                const Clock::time_point now = Clock::now();
+                if (now < due)
+                {
+                    std::this_thread::sleep_until(due);
+                }
+                else
+                {
+                    const uint64_t lag = static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(now - due).count());
+                    stats.maxLagNs = std::max(stats.maxLagNs, lag);
+                }
+            }
+
+            onFrame(frame);
+            ++stats.frames;
+            stats.bytes += frame.size;
+        }
+
+        stats.recordedNs = lastNs - firstNs;
+        stats.wallNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+        stats.corrupt = reader.corrupt();
+        stats.corruptSegment = reader.corruptSegment();
+        stats.corruptOffset = reader.corruptOffset();
+        return !stats.corrupt;
+    }
+}
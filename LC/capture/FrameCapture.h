@@ -0,0 +1,126 @@
+#pragma once
+
+#include "SenderType.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// LC 수신 프레임 캡처 / 재생
+//
+// 캡처 세션은 디렉터리 하나 (<dir>/<YYYYmmdd_HHMMSS>/seg-000000.lccap, seg-000001.lccap ...)
+// 세그먼트 파일은 segmentBytes 크기로 만들어 mmap 후 순서대로 덧붙이고, 가득 차면 다음 세그먼트로 교체
+//
+// 세그먼트: [헤더 32 byte][레코드...]
+//   헤더  : [magic "LCCAP001"][usedBytes u64][index u32][reserved u32][createdUnixUs u64]
+//   레코드: [monoNs u64][sender u8][len u32][frame len byte]   (리틀 엔디안, 정렬 없음)
+// - usedBytes는 레코드마다 갱신 → 프로세스가 죽어도 기록된 레코드까지는 읽을 수 있음
+// - monoNs는 CLOCK_MONOTONIC (재생 시 간격 복원용, 세션 안에서만 의미 있음)
+// - frame은 파서에 넘기는 그대로: TCP는 길이 접두를 뗀 payload, UDP는 데이터그램 전체
+namespace capture
+{
+    constexpr char MAGIC[8] = {'L', 'C', 'C', 'A', 'P', '0', '0', '1'};
+    constexpr size_t SEGMENT_HEADER_SIZE = 32;
+    constexpr size_t RECORD_HEADER_SIZE = 8 + 1 + 4;
+    constexpr size_t DEFAULT_SEGMENT_BYTES = 64u * 1024 * 1024;
+
+    uint64_t monotonicNs();
+
+    struct Frame
+    {
+        uint64_t monoNs;
+        SenderType sender;
+        const uint8_t *data; // 다음 next() 호출 전까지만 유효
+        size_t size;
+    };
+
+    // 리액터 스레드에서만 호출 (동기화 없음)
+    class FrameWriter
+    {
+    public:
+        FrameWriter() = default;
+        ~FrameWriter();
+
+        FrameWriter(const FrameWriter &) = delete;
+        FrameWriter &operator=(const FrameWriter &) = delete;
+
+        // dir 아래 새 세션 디렉터리를 만들고 첫 세그먼트를 연다
+        bool open(const std::string &dir, size_t segmentBytes = DEFAULT_SEGMENT_BYTES);
+        bool append(SenderType sender, const uint8_t *data, size_t len);
+        // 마지막 세그먼트를 실제 기록 크기로 줄이고 닫음
+        void close();
+
+        bool isOpen() const { return base_ != nullptr; }
+        const std::string &sessionDir() const { return sessionDir_; }
+        uint64_t frames() const { return frames_; }
+
+    private:
+        size_t segmentBytes_ = DEFAULT_SEGMENT_BYTES;
+        std::string sessionDir_;
+        uint32_t segmentIndex_ = 0;
+        int fd_ = -1;
+        uint8_t *base_ = nullptr;
+        size_t mapped_ = 0;
+        size_t used_ = 0;
+        uint64_t frames_ = 0;
+
+        bool openSegment(size_t minBytes);
+        void closeSegment();
+    };
+
+    // 세션 디렉터리의 세그먼트를 이름 순서대로 읽음
+    class FrameReader
+    {
+    public:
+        FrameReader() = default;
+        ~FrameReader();
+
+        FrameReader(const FrameReader &) = delete;
+        FrameReader &operator=(const FrameReader &) = delete;
+
+        bool open(const std::string &sessionDir);
+        // 다음 프레임, 끝이거나 손상된 레코드를 만나면 false (둘은 corrupt()로 구분)
+        bool next(Frame &out);
+
+        size_t segmentCount() const { return segments_.size(); }
+
+        // next()가 끝이 아니라 손상된 세그먼트/레코드에서 멈췄으면 true, 위치는 세그먼트 번호와 파일 안 offset
+        bool corrupt() const { return corrupt_; }
+        size_t corruptSegment() const { return corruptSegment_; }
+        size_t corruptOffset() const { return corruptOffset_; }
+
+    private:
+        std::vector<std::string> segments_;
+        size_t nextSegment_ = 0;
+        const uint8_t *base_ = nullptr;
+        size_t mapped_ = 0;
+        size_t used_ = 0;
+        size_t offset_ = 0;
+        bool corrupt_ = false;
+        size_t corruptSegment_ = 0;
+        size_t corruptOffset_ = 0;
+
+        bool openSegment(const std::string &path);
+        void closeSegment();
+        bool fail(size_t offset);
+    };
+
+    struct ReplayStats
+    {
+        uint64_t frames = 0;
+        uint64_t bytes = 0;
+        uint64_t recordedNs = 0; // 첫 프레임 ~ 마지막 프레임 (녹화 시간)
+        uint64_t wallNs = 0;     // 재생에 걸린 시간
+        uint64_t maxLagNs = 0;   // 예정 시각보다 늦게 넘긴 최대 지연 (speed > 0일 때)
+        bool corrupt = false;    // 손상된 레코드에서 멈춤 (아래 위치 이후는 재생 안 됨)
+        size_t corruptSegment = 0;
+        size_t corruptOffset = 0;
+    };
+
+    // speed: 1 = 녹화 속도, N = N배속, 0 이하 = 대기 없이 최대 속도
+    // 세션을 열 수 없거나 중간에 손상된 레코드를 만나면 false (후자는 stats.corrupt와 위치, 그 전까지의 통계 기록)
+    bool replay(const std::string &sessionDir, double speed, const std::function<void(const Frame &)> &onFrame,
+                ReplayStats &stats);
+}
@@ -10,6 +10,7 @@ enum class CommandType : uint8_t {
     SET_LAUNCHER_MODE_ECC_TO_LC   = 0x03,
     FIRE_COMMAND_ECC_TO_LC        = 0x04,
     MOVE_COMMAND_ECC_TO_LC        = 0x05,
+    STATUS_SUBSCRIBE_ECC_TO_LC    = 0x06, // 상태 푸시 구독 + 수신 확인 (0이면 키프레임 요청)
 
     // LC → MFR
     STATUS_REQUEST_LC_TO_MFR      = 0x11,
@@ -20,6 +21,7 @@ enum class CommandType : uint8_t {
     STATUS_RESPONSE_MFR_TO_LC     = 0x21,
     DETECTION_MFR_TO_LC           = 0x22,
     POSITION_REQUEST_MFR_TO_LC    = 0x23,
+    DETECTION_V2_MFR_TO_LC        = 0x24, // 키프레임 + 델타, 파싱 후 DETECTION_MFR_TO_LC로 전달
 
     //LC -> LS
     LAUNCH_COMMAND_LC_TO_LS       = 0x31,
@@ -31,7 +33,9 @@ enum class CommandType : uint8_t {
     // LS_STATUS_RESPONSE_LS_TO_LC     = 0x42 // LC → LS: 발사대 상태 응답(이동 완료 등)
 
     //LC-> ECC
-    STATUS_RESPONSE_LC_TO_ECC         = 0x51 // 상태 전송 (LC 전체 상태)
+    STATUS_RESPONSE_LC_TO_ECC         = 0x51, // 상태 전송 (LC 전체 상태)
+    STATUS_RESPONSE_V2_LC_TO_ECC      = 0x56, // 상태 전송 v2 (표적/미사일 개수 u16)
+    STATUS_DELTA_LC_TO_ECC            = 0x57  // 상태 푸시 (키프레임 또는 변경분)
     // RADAR_RESPONSE_LC_TO_ECC          = 0x52,  // 레이더 모드 변경 응답 등
     // LAUNCHER_RESPONSE_LC_TO_ECC       = 0x53,  // 발사대 모드 변경 응답 등
     // FIRE_RESPONSE_LC_TO_ECC           = 0x54,  // 유도탄 발사 명령 응답
@@ -2,13 +2,28 @@
 
 #include "CommandType.h"
 #include "SenderType.h"
+#include "Trace.h"
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 #include <variant>
 #include <string>
 
 namespace Common {
 
+// 다른 곳(파서 arena 등)에 있는 레코드 배열을 가리키는 읽기 전용 목록 (소유하지 않음)
+template <typename T>
+struct RecordView {
+    const T* ptr = nullptr;
+    size_t count = 0;
+
+    const T* begin() const { return ptr; }
+    const T* end() const { return ptr + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const T& operator[](size_t i) const { return ptr[i]; }
+};
+
 // 내부 열거형: 발사대 동작 모드
 enum class OperationMode : uint8_t {
     WAR_MODE = 0,
@@ -53,6 +68,11 @@ struct MoveCommand {
     long long posY;
 };
 
+// [0x06] ECC → LC: 상태 푸시 구독 / 수신 확인
+struct StatusSubscribe {
+    uint32_t ackVersion; // 마지막으로 적용한 푸시 버전, 0이면 키프레임 요청
+};
+
 // [0x21] MFR → LC: 상태 보고
 struct RadarStatus {
     unsigned int radarId;
@@ -94,8 +114,11 @@ struct RadarDetection {
     };
 
     unsigned int radarId;
-    std::vector<Target> targets;
-    std::vector<Missile> missiles;
+    // MessageParser arena를 가리킴 → 같은 파서의 다음 parse() 전까지만 유효
+    RecordView<Target> targets;
+    RecordView<Missile> missiles;
+    // 0x24 FLAG_TRACE로 실려 온 지연 추적 정보 (없으면 id 0)
+    trace::Context trace;
 
     // [미사용] 향후 메시지 로그 전송 용도 (256 bytes)
     // std::string message;
@@ -151,6 +174,7 @@ struct CommonMessage {
         LauncherModeCommand,     
         FireCommand,
         MoveCommand,
+        StatusSubscribe,
         RadarStatus,
         RadarDetection,
         LaunchCommand,
@@ -1,9 +1,14 @@
 // IReceiverCallback.h
 #pragma once
 #include "CommonMessage.h"
+#include "SenderType.h"
+#include <cstddef>
+#include <cstdint>
 
 class IReceiverCallback {
 public:
     virtual ~IReceiverCallback() = default;
     virtual void onMessage(const Common::CommonMessage& msg) = 0;
+    // 파싱 전 원본 프레임 (캡처용, 기본은 무시)
+    virtual void onRawFrame(SenderType /*from*/, const uint8_t* /*data*/, size_t /*len*/) {}
 };
\ No newline at end of file
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ID(T::id) 기준 밀집 슬롯 맵
+// - 값은 연속 배열(dense)에 저장: 순회/직렬화는 vector와 동일
+// - ID → 슬롯은 선형 탐사 해시, 슬롯 → dense 위치는 간접 참조라서 삭제(swap-remove) 후에도 Handle 유지
+// - 조회/삽입/삭제 O(1), 모든 저장소가 평탄한 vector라 SystemStatus 복사(StatusStore 발행) 비용이 작다
+template <typename T>
+class IdSlotMap
+{
+public:
+    static constexpr uint32_t INVALID = 0xFFFFFFFFu;
+
+    struct Handle
+    {
+        uint32_t slot = INVALID;
+        uint32_t generation = 0;
+
+        bool valid() const { return slot != INVALID; }
+    };
+
+    size_t size() const { return dense_.size(); }
+    bool empty() const { return dense_.empty(); }
+
+    T *begin() { return dense_.data(); }
+    T *end() { return dense_.data() + dense_.size(); }
+    const T *begin() const { return dense_.data(); }
+    const T *end() const { return dense_.data() + dense_.size(); }
+
+    // dense 순서 (삭제 시 마지막 항목이 빈자리로 이동)
+    T &operator[](size_t i) { return dense_[i]; }
+    const T &operator[](size_t i) const { return dense_[i]; }
+
+    T *find(unsigned int id)
+    {
+        const uint32_t slot = lookup(id);
+        return slot == INVALID ? nullptr : &dense_[slots_[slot].dense];
+    }
+
+    const T *find(unsigned int id) const
+    {
+        const uint32_t slot = lookup(id);
+        return slot == INVALID ? nullptr : &dense_[slots_[slot].dense];
+    }
+
+    Handle handleOf(unsigned int id) const
+    {
+        const uint32_t slot = lookup(id);
+        return slot == INVALID ? Handle{} : Handle{slot, slots_[slot].generation};
+    }
+
+    // 삭제되었거나 재사용된 슬롯이면 nullptr
+    T *get(Handle h)
+    {
+        return isLive(h) ? &dense_[slots_[h.slot].dense] : nullptr;
+    }
+
+    const T *get(Handle h) const
+    {
+        return isLive(h) ? &dense_[slots_[h.slot].dense] : nullptr;
+    }
+
+    // 있으면 덮어쓰고 없으면 추가, 이번 sweep 주기에 갱신된 것으로 표시
+    Handle upsert(const T &value)
+    {
+        uint32_t slot = lookup(value.id);
+        if (slot != INVALID)
+        {
+            const uint32_t d = slots_[slot].dense;
+            dense_[d] = value;
+            stamp_[d] = epoch_;
+            return Handle{slot, slots_[slot].generation};
+        }
+
+        slot = allocSlot();
+        slots_[slot].dense = static_cast<uint32_t>(dense_.size());
+        dense_.push_back(value);
+        denseSlot_.push_back(slot);
+        stamp_.push_back(epoch_);
+        indexInsert(value.id, slot);
+        return Handle{slot, slots_[slot].generation};
+    }
+
+    bool erase(unsigned int id)
+    {
+        const uint32_t slot = lookup(id);
+        if (slot == INVALID)
+        {
+            return false;
+        }
+        indexErase(id);
+        removeDense(slots_[slot].dense);
+        return true;
+    }
+
+    bool erase(Handle h)
+    {
+        return isLive(h) && erase(dense_[slots_[h.slot].dense].id);
+    }
+
+    template <typename Pred>
+    size_t eraseIf(Pred pred)
+    {
+        size_t removed = 0;
+        for (size_t i = dense_.size(); i-- > 0;)
+        {
+            if (pred(dense_[i]))
+            {
+                indexErase(dense_[i].id);
+                removeDense(static_cast<uint32_t>(i));
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    // 전체 보고를 반영할 때: beginSweep() → upsert(...) 반복 → endSweep()으로 이번에 없던 항목 삭제
+    void beginSweep() { ++epoch_; }
+
+    size_t endSweep()
+    {
+        const uint32_t epoch = epoch_;
+        size_t removed = 0;
+        for (size_t i = dense_.size(); i-- > 0;)
+        {
+            if (stamp_[i] != epoch)
+            {
+                indexErase(dense_[i].id);
+                removeDense(static_cast<uint32_t>(i));
+                ++removed;
+            }
+        }
+        return removed;
+    }
+
+    void clear()
+    {
+        for (uint32_t slot : denseSlot_)
+        {
+            freeSlot(slot);
+        }
+        dense_.clear();
+        denseSlot_.clear();
+        stamp_.clear();
+        index_.assign(index_.size(), IndexEntry{});
+    }
+
+private:
+    struct Slot
+    {
+        uint32_t dense = INVALID; // 사용 중이면 dense 위치, 비어 있으면 다음 빈 슬롯
+        uint32_t generation = 0;
+    };
+
+    struct IndexEntry
+    {
+        unsigned int id = 0;
+        uint32_t slot = INVALID; // INVALID면 빈 칸
+    };
+
+    std::vector<T> dense_;
+    std::vector<uint32_t> denseSlot_; // dense 위치 → 슬롯
+    std::vector<uint32_t> stamp_;     // dense 위치 → 마지막 갱신 sweep 주기
+    std::vector<Slot> slots_;
+    std::vector<IndexEntry> index_;   // 2의 거듭제곱 크기, 부하율 1/2 이하
+    uint32_t freeHead_ = INVALID;
+    uint32_t epoch_ = 0;
+
+    static size_t hash(unsigned int id)
+    {
+        // 연속 ID가 고르게 퍼지도록 곱셈 해시
+        return static_cast<size_t>(static_cast<uint32_t>(id) * 2654435761u);
+    }
+
+    bool isLive(Handle h) const
+    {
+        return h.slot < slots_.size() && slots_[h.slot].generation == h.generation && slots_[h.slot].dense < dense_.size() &&
+               denseSlot_[slots_[h.slot].dense] == h.slot;
+    }
+
+    uint32_t lookup(unsigned int id) const
+    {
+        if (index_.empty())
+        {
+            return INVALID;
+        }
+        const size_t mask = index_.size() - 1;
+        for (size_t i = hash(id) & mask;; i = (i + 1) & mask)
+        {
+            const IndexEntry &e = index_[i];
+            if (e.slot == INVALID)
+            {
+                return INVALID;
+            }
+            if (e.id == id)
+            {
+                return e.slot;
+            }
+        }
+    }
+
+    void indexInsert(unsigned int id, uint32_t slot)
+    {
+        if ((dense_.size() * 2) > index_.size())
+        {
+            rehash(index_.empty() ? 16 : index_.size() * 2);
+        }
+        const size_t mask = index_.size() - 1;
+        size_t i = hash(id) & mask;
+        while (index_[i].slot != INVALID)
+        {
+            i = (i + 1) & mask;
+        }
+        index_[i] = IndexEntry{id, slot};
+    }
+
+    // 선형 탐사 역방향 이동 삭제 (묘비 없음)
+    void indexErase(unsigned int id)
+    {
+        const size_t mask = index_.size() - 1;
+        size_t i = hash(id) & mask;
+        while (index_[i].id != id || index_[i].slot == INVALID)
+        {
+            i = (i + 1) & mask;
+        }
+
+        size_t hole = i;
+        for (size_t j = (hole + 1) & mask; index_[j].slot != INVALID; j = (j + 1) & mask)
+        {
+            const size_t home = hash(index_[j].id) & mask;
+            // home이 (hole, j] 밖이면 hole로 당겨도 탐사 경로가 유지된다
+            const bool inRange = hole <= j ? (hole < home && home <= j) : (hole < home || home <= j);
+            if (!inRange)
+            {
+                index_[hole] = index_[j];
+                hole = j;
+            }
+        }
+        index_[hole] = IndexEntry{};
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<IndexEntry> old;
+        old.swap(index_);
+        index_.assign(capacity, IndexEntry{});
+        const size_t mask = capacity - 1;
+        for (const IndexEntry &e : old)
+        {
+            if (e.slot == INVALID)
+            {
+                continue;
+            }
+            size_t i = hash(e.id) & mask;
+            while (index_[i].slot != INVALID)
+            {
+                i = (i + 1) & mask;
+            }
+            index_[i] = e;
+        }
+    }
+
+    uint32_t allocSlot()
+    {
+        if (freeHead_ != INVALID)
+        {
+            const uint32_t slot = freeHead_;
+            freeHead_ = slots_[slot].dense;
+            return slot;
+        }
+        slots_.push_back(Slot{});
+        return static_cast<uint32_t>(slots_.size() - 1);
+    }
+
+    void freeSlot(uint32_t slot)
+    {
+        ++slots_[slot].generation;
+        slots_[slot].dense = freeHead_;
+        freeHead_ = slot;
+    }
+
+    // 마지막 항목을 빈자리로 옮기는 O(1) 삭제
+    void removeDense(uint32_t d)
+    {
+        freeSlot(denseSlot_[d]);
+
+        const uint32_t last = static_cast<uint32_t>(dense_.size() - 1);
+        if (d != last)
+        {
+            dense_[d] = dense_[last];
+            denseSlot_[d] = denseSlot_[last];
+            stamp_[d] = stamp_[last];
+            slots_[denseSlot_[d]].dense = d;
+        }
+        dense_.pop_back();
+        denseSlot_.pop_back();
+        stamp_.pop_back();
+    }
+};
@@ -1,15 +1,25 @@
 #include "MessageParser.h"
 #include "SystemStatus.h"
+#include "DetectionDelta.h"
 #include <iostream>
 #include <cstring>
 #include <vector>
 #include <iomanip>
+#include <atomic>
 #include <arpa/inet.h>
 
 namespace {
 
 using namespace Common;
 
+using Arena = MessageParser::DetectionArena;
+
+std::atomic<bool> logEnabled{false};
+
+bool logOn() {
+    return logEnabled.load(std::memory_order_relaxed);
+}
+
 unsigned long be64toh(const uint8_t* data) {
     unsigned long val = 0;
     for (int i = 0; i < 8; ++i)
@@ -25,29 +35,24 @@ uint32_t be32toh(const uint8_t* data) {
            (static_cast<uint32_t>(data[3]));
 }
 
-CommonMessage parsePositionRequest(const std::vector<uint8_t>& data, SenderType sender) {
-    CommonMessage msg;
-
-    // 최소 1바이트(commandType) 확인
-    if (data.size() < 1) {
-        msg.ok = false;
-        return msg;
-    }
+//0x01
+void parseStatusRequest(ByteSpan, CommonMessage& msg, Arena&) {
+    msg.ok = true;
+}
 
-    msg.sender = sender;
-    msg.commandType = CommandType::POSITION_REQUEST_MFR_TO_LC;
+//0x23
+void parsePositionRequest(ByteSpan, CommonMessage& msg, Arena&) {
     msg.payload = std::monostate{};  // payload 없음
     msg.ok = true;
-
-    return msg;
 }
 
-CommonMessage parseRadarCommand(const std::vector<uint8_t>& data, CommonMessage& msg) {
+//0x02
+void parseRadarCommand(ByteSpan data, CommonMessage& msg, Arena&) {
     RadarModeCommand rc;
 
     if (data.size() < 11) {
         msg.ok = false;
-        return msg;
+        return;
     }
 
     std::memcpy(&rc.radarId, &data[1], 4);             // [1~4]
@@ -56,22 +61,23 @@ CommonMessage parseRadarCommand(const std::vector<uint8_t>& data, CommonMessage&
     std::memcpy(&rc.targetId, &data[7], 4);            // [7~10]
     rc.priority_select = rc.flag;                      // 이름 통일용 (구조체 유지 목적)
 
-    std::cout << "[RadarCommand] radarId (mfrId): " << rc.radarId << "\n";
-    std::cout << "[RadarCommand] radarMode: " << static_cast<int>(rc.radarMode) << "\n";
-    std::cout << "[RadarCommand] priority_select: " << static_cast<int>(rc.priority_select) << "\n";
-    std::cout << "[RadarCommand] targetId: " << rc.targetId << "\n";
+    if (logOn()) {
+        std::cout << "[RadarCommand] radarId (mfrId): " << rc.radarId << "\n";
+        std::cout << "[RadarCommand] radarMode: " << static_cast<int>(rc.radarMode) << "\n";
+        std::cout << "[RadarCommand] priority_select: " << static_cast<int>(rc.priority_select) << "\n";
+        std::cout << "[RadarCommand] targetId: " << rc.targetId << "\n";
+    }
 
     msg.payload = rc;
-    msg.commandType = static_cast<CommandType>(data[0]);
     msg.ok = true;
-    return msg;
 }
 
-CommonMessage parseLSStatus(const std::vector<uint8_t>& data, CommonMessage& msg) {
-    // if (data.size() < 34) {  // 1 (cmd) + 33
-    //     msg.ok = false;
-    //     return msg;
-    // }
+//0x41
+void parseLSStatus(ByteSpan data, CommonMessage& msg, Arena&) {
+    if (data.size() < 42) {  // 1 (cmd) + 41
+        msg.ok = false;
+        return;
+    }
 
     LSReport ls;
     ls.lsId  = be32toh(&data[1]);
@@ -85,69 +91,63 @@ CommonMessage parseLSStatus(const std::vector<uint8_t>& data, CommonMessage& msg
     ls.speed = be32toh(&data[37]);                     // 위치 주의: 기존 29 → 37
     ls.mode  = static_cast<OperationMode>(data[41]);   // 위치 주의: 기존 33 → 41
 
-    // LSReport 디버깅
-    // {
-    //     std::cout << "LSReport 디버깅:" << std::endl;
-    //     std::cout << "  lsId  : " << ls.lsId << std::endl;
-    //     std::cout << "  posX  : " << std::hex << ls.posX << std::endl;
-    //     std::cout << "  posY  : " << std::hex << ls.posY << std::endl;
-    //     std::cout << "  angle : " << std::dec << ls.angle << std::endl;
-    //     std::cout << "  speed : " << std::dec << ls.speed << std::endl; // 10진수로 출력
-    //     std::cout << "  mode  : " << static_cast<int>(ls.mode) << std::endl;                
-    // }
+    if (logOn()) {
+        std::cout << "[LSReport] lsId: " << ls.lsId
+                  << ", pos: (" << ls.posX << ", " << ls.posY << ", " << ls.height << ")"
+                  << ", angle: " << ls.launchAngle
+                  << ", speed: " << ls.speed
+                  << ", mode: " << static_cast<int>(ls.mode) << "\n";
+    }
 
     msg.payload = ls;
-    msg.commandType = static_cast<CommandType>(data[0]);
     msg.ok = true;
-    return msg;
 }
 
-
-CommonMessage parseLauncherCommand(const std::vector<uint8_t>& data, CommonMessage& msg) {
+//0x03
+void parseLauncherCommand(ByteSpan data, CommonMessage& msg, Arena&) {
     if (data.size() < 6) { // cmd(1) + lsId(4) + lsMode(1)
         msg.ok = false;
-        return msg;
+        return;
     }
 
     Common::LauncherCommand lc;
-    msg.commandType = static_cast<CommandType>(data[0]);  
-
     std::memcpy(&lc.lsId, &data[1], 4);     // 4바이트 launcherId
     lc.lsMode = data[5];                    // 1바이트 mode
 
-    // ✅ 로그 출력
-    std::cout << "[LauncherCommand] lsId: " << lc.lsId
-              << ", lsMode: " << static_cast<int>(lc.lsMode) << "\n";
+    if (logOn()) {
+        std::cout << "[LauncherCommand] lsId: " << lc.lsId
+                  << ", lsMode: " << static_cast<int>(lc.lsMode) << "\n";
+    }
 
     msg.payload = lc;
     msg.ok = true;
-    return msg;
 }
 
-CommonMessage parseFireCommand(const std::vector<uint8_t>& data, CommonMessage& msg) {
-    if (data.size() < 8) { // 1 (commandType) + 4 (lsId) + 4 (targetId) = 최소 9이지만 targetId는 중첩된 걸로 4만 계산
+//0x04
+void parseFireCommand(ByteSpan data, CommonMessage& msg, Arena&) {
+    if (data.size() < 9) { // 1 (commandType) + 4 (lsId) + 4 (targetId)
         msg.ok = false;
-        return msg;
+        return;
     }
 
     FireCommand fc;
     std::memcpy(&fc.lsId, &data[1], 4);
     std::memcpy(&fc.targetId, &data[5], 4);
 
-    std::cout << "[FireCommand] lsId: " << fc.lsId << "\n";
-    std::cout << "[FireCommand] targetId: " << fc.targetId << "\n";
+    if (logOn()) {
+        std::cout << "[FireCommand] lsId: " << fc.lsId << "\n";
+        std::cout << "[FireCommand] targetId: " << fc.targetId << "\n";
+    }
 
     msg.payload = fc;
-    msg.commandType = static_cast<CommandType>(data[0]);
     msg.ok = true;
-    return msg;
 }
 
 //0x05 -> 0x31
-CommonMessage parseMoveCommand(const std::vector<uint8_t>& data, CommonMessage& msg) {
-    if (data.size() < 18) {
+void parseMoveCommand(ByteSpan data, CommonMessage& msg, Arena&) {
+    if (data.size() < 21) { // cmd(1) + lsId(4) + posX(8) + posY(8)
         msg.ok = false;
-        return msg;
+        return;
     }
 
     MoveCommand mv;
@@ -155,45 +155,256 @@ CommonMessage parseMoveCommand(const std::vector<uint8_t>& data, CommonMessage&
     std::memcpy(&mv.posX, &data[5], 8);         // ✅ X 위치
     std::memcpy(&mv.posY, &data[13], 8);        // ✅ Y 위치
 
+    if (logOn()) {
+        std::cout << std::dec;
+        std::cout << "발사대 이동 명령 송신\n" ;
+        std::cout << "lsId: " << mv.lsId << ", posX: " << mv.posX << ", posY: " << mv.posY << "\n";
+    }
+
     msg.payload = mv;
-    msg.commandType = static_cast<CommandType>(data[0]);
     msg.ok = true;
-    std::cout << std::dec;
-    std::cout << "발사대 이동 명령 송신\n" ;
-    std::cout << "lsId: " << mv.lsId << ", posX: " << mv.posX << ", posY: " << mv.posY << "\n";
-
-    return msg;
 }
 
-CommonMessage parseRadarStatus(const std::vector<uint8_t>& data, SenderType sender) {
-    CommonMessage msg;
-    if (data.size() < 37) { // 4+8+8+8+1+8+4+4 = 최소 45, 넉넉히 잡아도 37 이상
+//0x06
+void parseStatusSubscribe(ByteSpan data, CommonMessage& msg, Arena&) {
+    if (data.size() < 5) { // cmd(1) + ackVersion(4)
         msg.ok = false;
-        return msg;
+        return;
     }
 
-    msg.sender = sender;
-    msg.commandType = CommandType::STATUS_RESPONSE_MFR_TO_LC;
+    StatusSubscribe sub;
+    std::memcpy(&sub.ackVersion, &data[1], 4);
+
+    msg.payload = sub;
+    msg.ok = true;
+}
+
+//0x21
+void parseRadarStatus(ByteSpan data, CommonMessage& msg, Arena&) {
+    if (data.size() < 38) { // cmd(1) + 4+8+8+8+1+8
+        msg.ok = false;
+        return;
+    }
 
     RadarStatus rs;
     std::memcpy(&rs.radarId,       &data[1], 4);
     std::memcpy(&rs.posX,          &data[5], 8);
     std::memcpy(&rs.posY,          &data[13], 8);
-    std::memcpy(&rs.height,        &data[21], 8);  
+    std::memcpy(&rs.height,        &data[21], 8);
     rs.radarMode     = data[29];
     std::memcpy(&rs.radarAngle,    &data[30], 8);
 
     msg.payload = rs;
     msg.ok = true;
-    return msg;
 }
 
-//0x22
-CommonMessage parseRadarDetection(const std::vector<uint8_t>& data, SenderType sender) {
-    CommonMessage msg;
-    msg.sender = sender;
-    msg.commandType = CommandType::DETECTION_MFR_TO_LC;
+RadarDetection::Target readTargetRecord(const uint8_t* p) {
+    RadarDetection::Target t;
+    std::memcpy(&t.id,         p,      4);
+    std::memcpy(&t.posX,       p + 4,  8);
+    std::memcpy(&t.posY,       p + 12, 8);
+    std::memcpy(&t.altitude,   p + 20, 8);
+    std::memcpy(&t.speed,      p + 28, 4);
+    std::memcpy(&t.angle1,     p + 32, 8);  // 기존 angle → angle1
+    std::memcpy(&t.angle2,     p + 40, 8);  // 새로 추가된 angle2
+    std::memcpy(&t.detectTime, p + 48, 8);
+    t.priority = p[56];
+    t.hit = p[57];
+    return t;
+}
+
+RadarDetection::Missile readMissileRecord(const uint8_t* p) {
+    RadarDetection::Missile m;
+    std::memcpy(&m.id,           p,      4);
+    std::memcpy(&m.posX,         p + 4,  8);
+    std::memcpy(&m.posY,         p + 12, 8);
+    std::memcpy(&m.altitude,     p + 20, 8);
+    std::memcpy(&m.speed,        p + 28, 4);
+    std::memcpy(&m.angle,        p + 32, 8);
+    std::memcpy(&m.detectTime,   p + 40, 8);
+    std::memcpy(&m.interceptTime,p + 48, 8);
+    m.hit = p[56];
+    return m;
+}
+
+// 키프레임 값 + zigzag varint 차이
+template <typename T>
+bool applyDelta(const uint8_t*& p, const uint8_t* end, T& value) {
+    uint64_t raw;
+    if (!detection_v2::getVarint(p, end, raw))
+        return false;
+    value = static_cast<T>(static_cast<int64_t>(value) + detection_v2::unzigzag(raw));
+    return true;
+}
+
+template <typename T>
+bool readRaw(const uint8_t*& p, const uint8_t* end, T& value) {
+    if (static_cast<size_t>(end - p) < sizeof(T))
+        return false;
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return true;
+}
+
+bool readTargetDelta(const uint8_t*& p, const uint8_t* end, RadarDetection::Target& t) {
+    using namespace detection_v2;
+    uint8_t mask;
+    if (!readRaw(p, end, mask))
+        return false;
+    if ((mask & TARGET_POS) &&
+        !(applyDelta(p, end, t.posX) && applyDelta(p, end, t.posY) && applyDelta(p, end, t.altitude)))
+        return false;
+    if ((mask & TARGET_SPEED) && !applyDelta(p, end, t.speed))
+        return false;
+    if ((mask & TARGET_ANGLE1) && !readRaw(p, end, t.angle1))
+        return false;
+    if ((mask & TARGET_ANGLE2) && !readRaw(p, end, t.angle2))
+        return false;
+    if ((mask & TARGET_DETECT_TIME) && !applyDelta(p, end, t.detectTime))
+        return false;
+    if ((mask & TARGET_PRIORITY) && !readRaw(p, end, t.priority))
+        return false;
+    if (mask & TARGET_HIT) {
+        uint8_t hit;
+        if (!readRaw(p, end, hit))
+            return false;
+        t.hit = hit != 0;
+    }
+    return true;
+}
+
+bool readMissileDelta(const uint8_t*& p, const uint8_t* end, RadarDetection::Missile& m) {
+    using namespace detection_v2;
+    uint8_t mask;
+    if (!readRaw(p, end, mask))
+        return false;
+    if ((mask & MISSILE_POS) &&
+        !(applyDelta(p, end, m.posX) && applyDelta(p, end, m.posY) && applyDelta(p, end, m.altitude)))
+        return false;
+    if ((mask & MISSILE_SPEED) && !applyDelta(p, end, m.speed))
+        return false;
+    if ((mask & MISSILE_ANGLE) && !readRaw(p, end, m.angle))
+        return false;
+    if ((mask & MISSILE_DETECT_TIME) && !applyDelta(p, end, m.detectTime))
+        return false;
+    if ((mask & MISSILE_INTERCEPT_TIME) && !applyDelta(p, end, m.interceptTime))
+        return false;
+    if (mask & MISSILE_HIT) {
+        uint8_t hit;
+        if (!readRaw(p, end, hit))
+            return false;
+        m.hit = hit != 0;
+    }
+    return true;
+}
+
+// arena에 풀어 둔 목록을 payload로 연결
+void publishDetection(RadarDetection& det, CommonMessage& msg, const Arena& arena) {
+    det.targets = RecordView<RadarDetection::Target>{arena.targets.data(), arena.targets.size()};
+    det.missiles = RecordView<RadarDetection::Missile>{arena.missiles.data(), arena.missiles.size()};
+    msg.commandType = CommandType::DETECTION_MFR_TO_LC;  // 0x24도 0x22와 같은 RadarDetection으로 전달
+    msg.payload = det;
     msg.ok = true;
+}
+
+//0x24 (키프레임 + 델타) → 0x22와 같은 RadarDetection으로 복원
+void parseRadarDetectionV2(ByteSpan data, CommonMessage& msg, Arena& arena) {
+    msg.ok = false;
+
+    if (data.size() < detection_v2::HEADER_SIZE || data[1] != detection_v2::VERSION) {
+        std::cerr << "[Parser] 0x24 헤더 오류 (size " << data.size() << ")\n";
+        return;
+    }
+
+    RadarDetection det;
+    const bool keyframe = (data[2] & detection_v2::FLAG_KEYFRAME) != 0;
+    uint16_t keySeq, numTargets, numMissiles;
+    std::memcpy(&det.radarId, &data[3], 4);
+    std::memcpy(&keySeq, &data[9], 2);
+    std::memcpy(&numTargets, &data[11], 2);
+    std::memcpy(&numMissiles, &data[13], 2);
+
+    const uint8_t* p = data.data() + detection_v2::HEADER_SIZE;
+    const uint8_t* end = data.data() + data.size();
+
+    if (data[2] & detection_v2::FLAG_TRACE) {
+        if (static_cast<size_t>(end - p) < trace::WIRE_SIZE) {
+            std::cerr << "[Parser] 0x24 추적 정보 길이 부족\n";
+            return;
+        }
+        std::memcpy(&det.trace.id, p, 4);
+        std::memcpy(&det.trace.originUs, p + 4, 8);
+        p += trace::WIRE_SIZE;
+    }
+
+    arena.targets.clear();
+    arena.missiles.clear();
+    Arena::Keyframe& key = arena.keyframes[det.radarId];
+
+    if (keyframe) {
+        const size_t need = numTargets * detection_v2::TARGET_RECORD_SIZE + numMissiles * detection_v2::MISSILE_RECORD_SIZE;
+        if (static_cast<size_t>(end - p) < need) {
+            std::cerr << "[Parser] 0x24 키프레임 길이 부족\n";
+            return;
+        }
+        for (uint16_t i = 0; i < numTargets; ++i, p += detection_v2::TARGET_RECORD_SIZE)
+            arena.targets.push_back(readTargetRecord(p));
+        for (uint16_t i = 0; i < numMissiles; ++i, p += detection_v2::MISSILE_RECORD_SIZE)
+            arena.missiles.push_back(readMissileRecord(p));
+
+        key.keySeq = keySeq;
+        key.targets.assign(arena.targets.begin(), arena.targets.end());
+        key.missiles.assign(arena.missiles.begin(), arena.missiles.end());
+    } else {
+        if (key.keySeq != keySeq || (key.targets.empty() && key.missiles.empty())) {
+            // 키프레임 유실: 다음 키프레임까지 델타는 버린다
+            std::cerr << "[Parser] 0x24 키프레임 불일치 (radar " << det.radarId << ", keySeq " << keySeq << ")\n";
+            return;
+        }
+
+        for (uint16_t i = 0; i < numTargets; ++i) {
+            uint64_t ref;
+            if (!detection_v2::getVarint(p, end, ref) || ref > key.targets.size())
+                return;
+            if (ref == 0) {
+                if (static_cast<size_t>(end - p) < detection_v2::TARGET_RECORD_SIZE)
+                    return;
+                arena.targets.push_back(readTargetRecord(p));
+                p += detection_v2::TARGET_RECORD_SIZE;
+                continue;
+            }
+            RadarDetection::Target t = key.targets[ref - 1];
+            if (!readTargetDelta(p, end, t))
+                return;
+            arena.targets.push_back(t);
+        }
+        for (uint16_t i = 0; i < numMissiles; ++i) {
+            uint64_t ref;
+            if (!detection_v2::getVarint(p, end, ref) || ref > key.missiles.size())
+                return;
+            if (ref == 0) {
+                if (static_cast<size_t>(end - p) < detection_v2::MISSILE_RECORD_SIZE)
+                    return;
+                arena.missiles.push_back(readMissileRecord(p));
+                p += detection_v2::MISSILE_RECORD_SIZE;
+                continue;
+            }
+            RadarDetection::Missile m = key.missiles[ref - 1];
+            if (!readMissileDelta(p, end, m))
+                return;
+            arena.missiles.push_back(m);
+        }
+    }
+
+    publishDetection(det, msg, arena);
+}
+
+//0x22
+void parseRadarDetection(ByteSpan data, CommonMessage& msg, Arena& arena) {
+    if (data.size() < 7) { // cmd(1) + radarId(4) + numTargets(1) + numMissiles(1)
+        msg.ok = false;
+        return;
+    }
 
     RadarDetection det;
 
@@ -207,179 +418,129 @@ CommonMessage parseRadarDetection(const std::vector<uint8_t>& data, SenderType s
     uint8_t numTargets = data[offset++];
     uint8_t numMissiles = data[offset++];
 
-    // std::cout << "[Parser] CommandType: " << static_cast<int>(msg.commandType) << "\n";
-    // std::cout << "[Parser] Radar ID: " << det.radarId << "\n";
-    // std::cout << "[Parser] Number of Targets: " << static_cast<int>(numTargets) << "\n";
-    // std::cout << "[Parser] Number of Missiles: " << static_cast<int>(numMissiles) << "\n";
-
-    std::cout << std::dec; // 10진수 출력 설정
-
-    // ✅ Target 파싱 (50바이트씩)
-    for (int i = 0; i < numTargets && offset + 58 <= data.size(); ++i) {
-        RadarDetection::Target t;
-        std::memcpy(&t.id,         &data[offset],      4);
-        std::memcpy(&t.posX,       &data[offset + 4],  8);
-        std::memcpy(&t.posY,       &data[offset + 12], 8);
-        std::memcpy(&t.altitude,   &data[offset + 20], 8);
-        std::memcpy(&t.speed,      &data[offset + 28], 4);
-        std::memcpy(&t.angle1,     &data[offset + 32], 8);  // 기존 angle → angle1
-        std::memcpy(&t.angle2,     &data[offset + 40], 8);  // 새로 추가된 angle2
-        std::memcpy(&t.detectTime, &data[offset + 48], 8);
-        t.priority = data[offset + 56];
-        t.hit = data[offset + 57];
-        det.targets.push_back(t);
-        offset += 58;
+    // 잘린 목록을 그대로 넘기면 빠진 표적이 sweep에서 삭제되므로 전체를 버린다
+    const size_t need = offset + numTargets * detection_v2::TARGET_RECORD_SIZE + numMissiles * detection_v2::MISSILE_RECORD_SIZE;
+    if (data.size() < need) {
+        std::cerr << "[Parser] 0x22 길이 부족 (size " << data.size() << ", need " << need << ")\n";
+        msg.ok = false;
+        return;
+    }
+
+    arena.targets.clear();
+    arena.missiles.clear();
+
+    // ✅ Target 파싱 (58바이트씩)
+    for (int i = 0; i < numTargets; ++i) {
+        arena.targets.push_back(readTargetRecord(&data[offset]));
+        offset += detection_v2::TARGET_RECORD_SIZE;
     }
 
     // ✅ Missile 파싱 (57바이트씩)
-    for (int i = 0; i < numMissiles && offset + 57 <= data.size(); ++i) {
-        RadarDetection::Missile m;
-        std::memcpy(&m.id,           &data[offset],      4);
-        std::memcpy(&m.posX,         &data[offset + 4],  8);
-        std::memcpy(&m.posY,         &data[offset + 12], 8);
-        std::memcpy(&m.altitude,     &data[offset + 20], 8);
-        std::memcpy(&m.speed,        &data[offset + 28], 4);
-        std::memcpy(&m.angle,        &data[offset + 32], 8);
-        std::memcpy(&m.detectTime,   &data[offset + 40], 8);
-        std::memcpy(&m.interceptTime,&data[offset + 48], 8);
-        m.hit = data[offset + 56];
-        det.missiles.push_back(m);
-        offset += 57;
+    for (int i = 0; i < numMissiles; ++i) {
+        arena.missiles.push_back(readMissileRecord(&data[offset]));
+        offset += detection_v2::MISSILE_RECORD_SIZE;
     }
-    //
 
-    for (size_t i = 0; i < det.targets.size(); ++i) {
-        std::cout << "[Target#" << i << "] angle1: " << det.targets[i].angle1
-                  << ", angle2: " << det.targets[i].angle2 << std::endl;
+    if (logOn()) {
+        std::cout << std::dec; // 10진수 출력 설정
+        for (size_t i = 0; i < arena.targets.size(); ++i) {
+            std::cout << "[Target#" << i << "] angle1: " << arena.targets[i].angle1
+                      << ", angle2: " << arena.targets[i].angle2 << std::endl;
+        }
     }
-    
-    msg.payload = det;
-    return msg;
+
+    publishDetection(det, msg, arena);
 }
- 
 
+// 명령 바이트 → 파싱 함수 (송신자별 256칸, 빈 칸은 미지원 명령)
+using ParseFn = void (*)(ByteSpan, CommonMessage&, Arena&);
+
+struct ParseTable {
+    ParseFn fn[256];
+};
+
+constexpr ParseTable makeEccTable() {
+    ParseTable t{};
+    t.fn[static_cast<uint8_t>(CommandType::STATUS_REQUEST_ECC_TO_LC)] = parseStatusRequest;
+    t.fn[static_cast<uint8_t>(CommandType::SET_RADAR_MODE_ECC_TO_LC)] = parseRadarCommand;
+    t.fn[static_cast<uint8_t>(CommandType::SET_LAUNCHER_MODE_ECC_TO_LC)] = parseLauncherCommand;
+    t.fn[static_cast<uint8_t>(CommandType::FIRE_COMMAND_ECC_TO_LC)] = parseFireCommand;
+    t.fn[static_cast<uint8_t>(CommandType::MOVE_COMMAND_ECC_TO_LC)] = parseMoveCommand;
+    t.fn[static_cast<uint8_t>(CommandType::STATUS_SUBSCRIBE_ECC_TO_LC)] = parseStatusSubscribe;
+    return t;
+}
 
-} // anonymous namespace
+constexpr ParseTable makeMfrTable() {
+    ParseTable t{};
+    t.fn[static_cast<uint8_t>(CommandType::STATUS_RESPONSE_MFR_TO_LC)] = parseRadarStatus;   // 0x21
+    t.fn[static_cast<uint8_t>(CommandType::DETECTION_MFR_TO_LC)] = parseRadarDetection;      // 0x22
+    t.fn[static_cast<uint8_t>(CommandType::POSITION_REQUEST_MFR_TO_LC)] = parsePositionRequest; // 0x23
+    t.fn[static_cast<uint8_t>(CommandType::DETECTION_V2_MFR_TO_LC)] = parseRadarDetectionV2; // 0x24
+    return t;
+}
 
-namespace Common {
+constexpr ParseTable makeLsTable() {
+    ParseTable t{};
+    t.fn[static_cast<uint8_t>(CommandType::LS_STATUS_UPDATE_LS_TO_LC)] = parseLSStatus;      // 0x41
+    return t;
+}
 
-CommonMessage MessageParser::parse(const std::vector<uint8_t>& data, SenderType sender) {
-    CommonMessage msg;
-    msg.sender = sender;
+constexpr ParseTable ECC_TABLE = makeEccTable();
+constexpr ParseTable MFR_TABLE = makeMfrTable();
+constexpr ParseTable LS_TABLE = makeLsTable();
 
-    if (data.empty()) {
-        std::cerr << "[Parser] 데이터가 비어 있음\n";
-        msg.ok = false;
-        return msg;
-    }
-    // debug
-    /*
-    for (size_t i = 0; i < data.size(); ++i) {
-        std::cout << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(data[i]) << " ";
-    }
-    */
-
-    uint8_t cmd = data[0];
-
-    if (sender == SenderType::ECC) {
-        msg.commandType = static_cast<CommandType>(cmd);
-
-        switch (msg.commandType) {
-        case CommandType::STATUS_REQUEST_ECC_TO_LC:
-            msg.ok = true;
-            break;
-        case CommandType::SET_RADAR_MODE_ECC_TO_LC:
-            return parseRadarCommand(data, msg);
-        case CommandType::SET_LAUNCHER_MODE_ECC_TO_LC:
-            return parseLauncherCommand(data, msg);
-        case CommandType::FIRE_COMMAND_ECC_TO_LC:
-            return parseFireCommand(data, msg);
-        case CommandType::MOVE_COMMAND_ECC_TO_LC:
-            return parseMoveCommand(data, msg);
-        default:
-            std::cerr << "[Parser] 알 수 없는 ECC commandType: " << static_cast<int>(cmd) << "\n";
-            msg.ok = false;
-            break;
-        }
+const ParseTable* tableFor(SenderType sender) {
+    switch (sender) {
+    case SenderType::ECC: return &ECC_TABLE;
+    case SenderType::MFR: return &MFR_TABLE;
+    case SenderType::LS: return &LS_TABLE;
+    default: return nullptr;
     }
+}
 
-    if (sender == SenderType::MFR) {
-        msg.commandType = static_cast<CommandType>(cmd);
-        switch (msg.commandType) {
-            //0x21
-        case CommandType::STATUS_RESPONSE_MFR_TO_LC: {
-            // data를 hex로 출력
-            // std::cout << "[STATUS_RESPONSE_MFR_TO_LC] data (hex): ";
-            // for (size_t i = 0; i < data.size(); ++i) {
-            //     std::cout << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(data[i]) << " ";
-            // }
-            // std::cout << std::dec << std::endl;
-            return parseRadarStatus(data, sender);
-        }
-            //0x22
-        case CommandType::DETECTION_MFR_TO_LC:
-            return parseRadarDetection(data, sender);
-            //0x23
-        case CommandType::POSITION_REQUEST_MFR_TO_LC:
-            return parsePositionRequest(data, sender);
-        default:
-            std::cerr << "[Parser] Unknown MFR commandType: " << static_cast<int>(cmd) << "\n";
-            msg.ok = false;
-            return msg;
-        }
+const char* senderName(SenderType sender) {
+    switch (sender) {
+    case SenderType::ECC: return "ECC";
+    case SenderType::MFR: return "MFR";
+    case SenderType::LS: return "LS";
+    default: return "Unknown";
     }
+}
 
+} // anonymous namespace
 
-    //0x41
-    if (sender == SenderType::LS) {
-        msg.commandType = static_cast<CommandType>(cmd);
+namespace Common {
 
-        switch (msg.commandType) {
-        case CommandType::LS_STATUS_UPDATE_LS_TO_LC: {
-            return parseLSStatus(data, msg);  // 예: LS가 상태 갱신 전송
-        }
-        // case CommandType::LS_STATUS_RESPONSE_LS_TO_LC:
-        //     return parseLSStatus(data, msg);  // 예: LS가 이동 완료 등 응답
-        default:
-            std::cerr << "[Parser] 알 수 없는 LS → LC commandType: "
-                    << static_cast<int>(cmd) << "\n";
-            msg.ok = false;
-            break;
-        }
-    }
+void MessageParser::setLogging(bool enabled) {
+    logEnabled.store(enabled, std::memory_order_relaxed);
+}
 
-    return msg;
+bool MessageParser::logging() {
+    return logOn();
 }
-//0x23 
 
-CommonMessage parseMoveCommandLS(const std::vector<uint8_t>& data, CommonMessage& msg) {
-    if (data.size() < 1 + 4 + 8 + 8) {
+CommonMessage MessageParser::parse(ByteSpan data, SenderType sender) {
+    CommonMessage msg;
+    msg.sender = sender;
+
+    if (data.empty()) {
+        std::cerr << "[Parser] 데이터가 비어 있음\n";
         msg.ok = false;
         return msg;
     }
-    MoveCommand mv;
-    std::memcpy(&mv.lsId, &data[1], 4);
-    std::memcpy(&mv.posX, &data[5], 8);
-    std::memcpy(&mv.posY, &data[13], 8);
-    msg.payload = mv;
-    msg.commandType = static_cast<CommandType>(data[0]);
 
-    msg.ok = true;
-    return msg;
-}
+    const uint8_t cmd = data[0];
+    msg.commandType = static_cast<CommandType>(cmd);
 
-CommonMessage parseModeChangeCommand(const std::vector<uint8_t>& data, CommonMessage& msg) {
-    if (data.size() < 1 + 4 + 1) {
+    const ParseTable* table = tableFor(sender);
+    ParseFn fn = table ? table->fn[cmd] : nullptr;
+    if (fn == nullptr) {
+        std::cerr << "[Parser] 알 수 없는 " << senderName(sender) << " commandType: " << static_cast<int>(cmd) << "\n";
         msg.ok = false;
         return msg;
     }
-    LauncherModeCommand mc;
-    std::memcpy(&mc.launcherId, &data[1], 4);
-    mc.newMode = static_cast<OperationMode>(data[5]);
 
-    msg.payload = mc;  // ✅ 이것도 variant에 포함된 타입이어야 함
-    msg.commandType = static_cast<CommandType>(data[0]);
-    msg.ok = true;
+    fn(data, msg, arena_);
     return msg;
 }
 
@@ -5,13 +5,55 @@
 #include "CommonMessage.h"
 #include "SenderType.h"
 #include <vector>
+#include <cstddef>
 #include <cstdint>
+#include <unordered_map>
 
 namespace Common {
 
+// 수신 버퍼를 복사 없이 가리키는 읽기 전용 바이트 구간 (C++17이라 std::span 대신)
+class ByteSpan {
+public:
+    ByteSpan() = default;
+    ByteSpan(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+    ByteSpan(const std::vector<uint8_t>& v) : data_(v.data()), size_(v.size()) {}
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const uint8_t& operator[](size_t i) const { return data_[i]; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+// 수신 메시지 파서 (송신자별 명령 바이트 → 파싱 함수 테이블)
+// - 탐지 목록은 파서가 가진 arena에 풀어 RadarDetection이 가리키게 한다 (다음 parse() 전까지 유효)
+// - 연결(수신 스레드)마다 하나씩 두고 같은 스레드에서만 사용
 class MessageParser {
 public:
-    static CommonMessage parse(const std::vector<uint8_t>& raw, SenderType sender);
+    // 탐지 레코드 재사용 버퍼 + 0x24 키프레임 캐시 (레이더별)
+    struct DetectionArena {
+        struct Keyframe {
+            uint16_t keySeq = 0;
+            std::vector<RadarDetection::Target> targets;
+            std::vector<RadarDetection::Missile> missiles;
+        };
+
+        std::vector<RadarDetection::Target> targets;
+        std::vector<RadarDetection::Missile> missiles;
+        std::unordered_map<unsigned int, Keyframe> keyframes;
+    };
+
+    CommonMessage parse(ByteSpan raw, SenderType sender);
+
+    // 파싱 내용 출력 (기본 꺼짐, LC.ini [Log] Parser)
+    static void setLogging(bool enabled);
+    static bool logging();
+
+private:
+    DetectionArena arena_;
 };
 
 }
@@ -1,4 +1,6 @@
 #include "Serializer.h"
+#include "StatusRecordWriter.h"
+#include <algorithm>
 #include <cstring>
 
 #include <iostream>
@@ -6,81 +8,99 @@
 namespace Common
 {
 
-    // 0x01 상태 전송 -> 0x51로 보냄
-    std::vector<uint8_t> Serializer::serializeStatusResponse(const SystemStatus &status)
+    namespace
     {
-        std::vector<uint8_t> buf;
+        constexpr size_t STATUS_V1_HEADER_SIZE = 10; // cmd + len(4) + radar/lc/ls + 개수 u8 x2
+        constexpr size_t STATUS_V2_HEADER_SIZE = 12; // 개수 u16 x2
+
+        size_t statusCountLimit(int version)
+        {
+            return version == Serializer::STATUS_V2 ? 0xFFFF : 0xFF;
+        }
+    }
+
+    size_t Serializer::statusResponseSize(const SystemStatus &status, int version)
+    {
+        const size_t limit = statusCountLimit(version);
+        const size_t numTargets = std::min(status.targets.size(), limit);
+        const size_t numMissiles = std::min(status.missiles.size(), limit);
+        return (version == STATUS_V2 ? STATUS_V2_HEADER_SIZE + trace::WIRE_SIZE : STATUS_V1_HEADER_SIZE) +
+               status_record::MFR_SIZE + status_record::LS_SIZE + status_record::LC_SIZE +
+               numMissiles * status_record::MISSILE_SIZE + numTargets * status_record::TARGET_SIZE;
+    }
+
+    // 0x01 상태 전송 -> 0x51(v1) / 0x56(v2)로 보냄
+    size_t Serializer::writeStatusResponse(const SystemStatus &status, uint8_t *out, size_t capacity, int version)
+    {
+        const size_t total = statusResponseSize(status, version);
+        if (out == nullptr || capacity < total)
+        {
+            return 0;
+        }
+
+        const size_t limit = statusCountLimit(version);
+        const size_t numTargets = std::min(status.targets.size(), limit);
+        const size_t numMissiles = std::min(status.missiles.size(), limit);
+
+        status_record::Cursor c{out};
+
+        // 1. 명령 타입 + payload 크기 (전체 - 명령 타입(1) - 길이 필드(4))
+        c.putByte(static_cast<uint8_t>(version == STATUS_V2 ? CommandType::STATUS_RESPONSE_V2_LC_TO_ECC
+                                                            : CommandType::STATUS_RESPONSE_LC_TO_ECC));
+        c.put(static_cast<uint32_t>(total - 5));
 
-        // 1. 명령 타입 (1바이트)
-        buf.push_back(static_cast<uint8_t>(CommandType::STATUS_RESPONSE_LC_TO_ECC)); // 0x51
-
-        // 2. 사이즈 자리 확보용 (4바이트 dummy) → 나중에 overwrite
-        buf.resize(buf.size() + 4, 0);
-
-        // 3. 기본 시스템 플래그 및 개수
-        buf.push_back(1); // radar
-        buf.push_back(1); // lc
-        buf.push_back(1); // ls
-        buf.push_back(static_cast<uint8_t>(status.targets.size()));
-        buf.push_back(static_cast<uint8_t>(status.missiles.size()));
-
-        // 4. MFR 정보 (id, 위치, 고도, 모드, 각도)
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.mfr.mfrId), reinterpret_cast<const uint8_t *>(&status.mfr.mfrId) + 4);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.mfr.position.x), reinterpret_cast<const uint8_t *>(&status.mfr.position.x) + 8);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.mfr.position.y), reinterpret_cast<const uint8_t *>(&status.mfr.position.y) + 8);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.mfr.height), reinterpret_cast<const uint8_t *>(&status.mfr.height) + 8);
-        buf.push_back(static_cast<uint8_t>(status.mfr.mode));
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.mfr.degree), reinterpret_cast<const uint8_t *>(&status.mfr.degree) + 8);
-
-        // 5. LS 정보
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.ls.launchSystemId), reinterpret_cast<const uint8_t *>(&status.ls.launchSystemId) + 4);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.ls.position.x), reinterpret_cast<const uint8_t *>(&status.ls.position.x) + 8);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.ls.position.y), reinterpret_cast<const uint8_t *>(&status.ls.position.y) + 8);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.ls.height), reinterpret_cast<const uint8_t *>(&status.ls.height) + 8);
-        buf.push_back(static_cast<uint8_t>(status.ls.mode));
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.ls.launchAngle), reinterpret_cast<const uint8_t *>(&status.ls.launchAngle) + 8);
-
-        // 6. LC 정보
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.lc.LCId), reinterpret_cast<const uint8_t *>(&status.lc.LCId) + 4);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.lc.position.x), reinterpret_cast<const uint8_t *>(&status.lc.position.x) + 8);
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.lc.position.y), reinterpret_cast<const uint8_t *>(&status.lc.position.y) + 8);
-
-        long long dummyHeight = 15;
-        buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&dummyHeight), reinterpret_cast<const uint8_t *>(&dummyHeight) + sizeof(long long));
-
-        // 7. Missile 정보
-        for (const auto &m : status.missiles)
+        // 2. 기본 시스템 플래그 및 개수
+        c.putByte(1); // radar
+        c.putByte(1); // lc
+        c.putByte(1); // ls
+        if (version == STATUS_V2)
         {
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&m.id), reinterpret_cast<const uint8_t *>(&m.id) + 4);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&m.posX), reinterpret_cast<const uint8_t *>(&m.posX) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&m.posY), reinterpret_cast<const uint8_t *>(&m.posY) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&m.altitude), reinterpret_cast<const uint8_t *>(&m.altitude) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&m.speed), reinterpret_cast<const uint8_t *>(&m.speed) + 4);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&m.angle), reinterpret_cast<const uint8_t *>(&m.angle) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&status.lc.calculated_time), reinterpret_cast<const uint8_t *>(&status.lc.calculated_time) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&m.interceptTime), reinterpret_cast<const uint8_t *>(&m.interceptTime) + 8);
-            buf.push_back(static_cast<uint8_t>(m.hit));
+            c.put(static_cast<uint16_t>(numTargets));
+            c.put(static_cast<uint16_t>(numMissiles));
+        }
+        else
+        {
+            c.putByte(static_cast<uint8_t>(numTargets));
+            c.putByte(static_cast<uint8_t>(numMissiles));
+        }
+
+        // 3. MFR / LS / LC 정보
+        status_record::writeMfr(c, status.mfr);
+        status_record::writeLs(c, status.ls);
+        status_record::writeLc(c, status.lc);
+
+        // 4. Missile 정보
+        for (size_t i = 0; i < numMissiles; ++i)
+        {
+            status_record::writeMissile(c, status.missiles[i], status.lc.calculated_time);
+        }
+
+        // 5. Target 정보
+        for (size_t i = 0; i < numTargets; ++i)
+        {
+            status_record::writeTarget(c, status.targets[i]);
         }
 
-        // 8. Target 정보
-        for (const auto &t : status.targets)
+        // 6. 지연 추적 (v2만)
+        if (version == STATUS_V2)
         {
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.id), reinterpret_cast<const uint8_t *>(&t.id) + 4);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.posX), reinterpret_cast<const uint8_t *>(&t.posX) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.posY), reinterpret_cast<const uint8_t *>(&t.posY) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.altitude), reinterpret_cast<const uint8_t *>(&t.altitude) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.speed), reinterpret_cast<const uint8_t *>(&t.speed) + 4);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.angle1), reinterpret_cast<const uint8_t *>(&t.angle1) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.angle2), reinterpret_cast<const uint8_t *>(&t.angle2) + 8);
-            buf.insert(buf.end(), reinterpret_cast<const uint8_t *>(&t.detectTime), reinterpret_cast<const uint8_t *>(&t.detectTime) + 8);
-            buf.push_back(t.priority);
-            buf.push_back(static_cast<uint8_t>(t.hit));
+            c.put(status.trace.id);
+            c.put(status.trace.originUs);
         }
 
-        // 9. 전체 payload 크기 계산 후 2~5바이트(1-indexed) 위치에 삽입
-        uint32_t payloadSize = static_cast<uint32_t>(buf.size() - 5); // 전체 - 명령 타입(1) - 길이 필드(4)
-        std::memcpy(&buf[1], &payloadSize, sizeof(uint32_t));         // 1~4번 인덱스에 크기 기록
+        return static_cast<size_t>(c.p - out);
+    }
+
+    void Serializer::serializeStatusResponse(const SystemStatus &status, std::vector<uint8_t> &out, int version)
+    {
+        out.resize(statusResponseSize(status, version));
+        writeStatusResponse(status, out.data(), out.size(), version);
+    }
 
+    std::vector<uint8_t> Serializer::serializeStatusResponse(const SystemStatus &status)
+    {
+        std::vector<uint8_t> buf;
+        serializeStatusResponse(status, buf, STATUS_V1);
         return buf;
     }
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "SystemStatus.h"
 #include "CommonMessage.h"
+#include <cstddef>
 #include <vector>
 #include <string>
 
@@ -8,6 +9,20 @@ namespace Common {
 
 class Serializer {
 public:
+    // 상태 응답 포맷
+    //   v1 (0x51): 헤더 10 byte, 표적/미사일 개수 u8 (255개 초과분은 잘라서 보냄)
+    //   v2 (0x56): 헤더 12 byte, 표적/미사일 개수 u16 (리틀 엔디안), 레코드 배치는 v1과 동일
+    //              끝에 지연 추적 [traceId u32][traceOriginUs u64] (추적 정보가 없으면 0)
+    static constexpr int STATUS_V1 = 1;
+    static constexpr int STATUS_V2 = 2;
+
+    // 정확한 패킷 크기 (바이트)
+    static size_t statusResponseSize(const SystemStatus& status, int version = STATUS_V1);
+    // out에 직접 기록하고 기록한 바이트 수 반환, capacity가 부족하면 아무것도 쓰지 않고 0
+    static size_t writeStatusResponse(const SystemStatus& status, uint8_t* out, size_t capacity, int version = STATUS_V1);
+    // 호출 측 버퍼를 재사용 (용량이 모자랄 때만 재할당)
+    static void serializeStatusResponse(const SystemStatus& status, std::vector<uint8_t>& out, int version = STATUS_V1);
+
     // 공통 응답/명령 직렬화
     static std::vector<uint8_t> serializeStatusResponse(const SystemStatus& status);
     // static std::vector<uint8_t> serializeRadarResponse(unsigned radarId, uint8_t radarMode, bool ok, const std::string& msg);
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "SystemStatus.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// ECC 상태 메시지(0x51/0x56 전체, 0x57 델타)가 공유하는 레코드 배치
+// 필드는 호스트 바이트 순서 그대로 기록 (기존 포맷과 동일)
+namespace status_record
+{
+    constexpr size_t MFR_SIZE = 4 + 8 + 8 + 8 + 1 + 8;
+    constexpr size_t LS_SIZE = 4 + 8 + 8 + 8 + 1 + 8;
+    constexpr size_t LC_SIZE = 4 + 8 + 8 + 8;
+    constexpr size_t MISSILE_SIZE = 4 + 8 + 8 + 8 + 4 + 8 + 8 + 8 + 1;
+    constexpr size_t TARGET_SIZE = 4 + 8 + 8 + 8 + 4 + 8 + 8 + 8 + 1 + 1;
+
+    constexpr long long LC_DUMMY_HEIGHT = 15;
+
+    // 크기를 미리 확보한 버퍼에 순서대로 기록
+    struct Cursor
+    {
+        uint8_t *p;
+
+        template <typename T>
+        void put(const T &value)
+        {
+            std::memcpy(p, &value, sizeof(T));
+            p += sizeof(T);
+        }
+
+        void putByte(uint8_t value) { *p++ = value; }
+    };
+
+    inline void writeMfr(Cursor &c, const MFRStatus &mfr)
+    {
+        c.put(mfr.mfrId);
+        c.put(mfr.position.x);
+        c.put(mfr.position.y);
+        c.put(mfr.height);
+        c.putByte(static_cast<uint8_t>(mfr.mode));
+        c.put(mfr.degree);
+    }
+
+    inline void writeLs(Cursor &c, const LSStatus &ls)
+    {
+        c.put(ls.launchSystemId);
+        c.put(ls.position.x);
+        c.put(ls.position.y);
+        c.put(ls.height);
+        c.putByte(static_cast<uint8_t>(ls.mode));
+        c.put(ls.launchAngle);
+    }
+
+    inline void writeLc(Cursor &c, const LCStatus &lc)
+    {
+        c.put(lc.LCId);
+        c.put(lc.position.x);
+        c.put(lc.position.y);
+        c.put(LC_DUMMY_HEIGHT);
+    }
+
+    // 미사일 레코드의 예측 시각 자리는 LC 계산 시각(calculated_time)을 보낸다
+    inline void writeMissile(Cursor &c, const MissileStatus &m, unsigned long long calculatedTime)
+    {
+        c.put(m.id);
+        c.put(m.posX);
+        c.put(m.posY);
+        c.put(m.altitude);
+        c.put(m.speed);
+        c.put(m.angle);
+        c.put(calculatedTime);
+        c.put(m.interceptTime);
+        c.putByte(static_cast<uint8_t>(m.hit));
+    }
+
+    inline void writeTarget(Cursor &c, const TargetStatus &t)
+    {
+        c.put(t.id);
+        c.put(t.posX);
+        c.put(t.posY);
+        c.put(t.altitude);
+        c.put(t.speed);
+        c.put(t.angle1);
+        c.put(t.angle2);
+        c.put(t.detectTime);
+        c.putByte(t.priority);
+        c.putByte(static_cast<uint8_t>(t.hit));
+    }
+}
@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 #include <cstdint>
+#include "IdSlotMap.h"
+#include "Trace.h"
 
 struct Pos2D
 {
@@ -89,6 +91,7 @@ struct SystemStatus
     MFRStatus mfr;
     LSStatus ls;
     LCStatus lc;
-    std::vector<MissileStatus> missiles;
-    std::vector<TargetStatus> targets;
+    IdSlotMap<MissileStatus> missiles; // id 인덱스, 순회는 dense 순서
+    IdSlotMap<TargetStatus> targets;
+    trace::Context trace; // 마지막으로 반영한 MFR 탐지 보고의 지연 추적 정보
 };
@@ -4,11 +4,15 @@
 #include "MessageParser.h"
 #include "IReceiverCallback.h"
 #include "IReceiver.h"
+#include "StreamFramer.h"
+#include "Reactor.h"
 
 #include <iostream>
 #include <thread>
 #include <unistd.h>
 #include <arpa/inet.h>
+#include <sys/epoll.h>
+#include <cstring>
 
 TcpECC::TcpECC(const std::string& ip, int port)
     : ip_(ip), port_(port) {}
@@ -17,8 +21,10 @@ void TcpECC::setCallback(IReceiverCallback* cb) {
     callback_ = cb;
 }
 
-void TcpECC::start() {
-    int server_fd = socket(AF_INET, SOCK_STREAM, 0);
+void TcpECC::start(Reactor& reactor) {
+    reactor_ = &reactor;
+
+    int server_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
     if (server_fd < 0) {
         perror("[TcpECC] socket");
         return;
@@ -38,37 +44,107 @@ void TcpECC::start() {
         return;
     }
 
+    listen_fd_ = server_fd;
+    reactor.add(listen_fd_, EPOLLIN, [this](uint32_t) { onAccept(); });
     std::cout << "[TcpECC] 클라이언트 대기 중: " << ip_ << ":" << port_ << std::endl;
+}
 
-    std::thread([this, server_fd]() {
-        sockaddr_in client_addr{};
-        socklen_t len = sizeof(client_addr);
-        sock_fd_ = accept(server_fd, (sockaddr*)&client_addr, &len);
-        close(server_fd);
-
-        if (sock_fd_ < 0) {
+void TcpECC::onAccept() {
+    sockaddr_in client_addr{};
+    socklen_t len = sizeof(client_addr);
+    // 논블로킹: 읽지 않는 상대 때문에 리액터 스레드가 send에서 멈추지 않도록 송신은 큐로 처리
+    int fd = accept4(listen_fd_, (sockaddr*)&client_addr, &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
             perror("[TcpECC] accept");
-            return;
         }
+        return;
+    }
 
-        // std::cout << "[TcpECC] 클라이언트 연결됨" << std::endl;
-        receiveLoop();
-    }).detach();
-}
+    if (sock_fd_ >= 0) {
+        std::cout << "[TcpECC] 새 연결로 기존 연결 교체" << std::endl;
+        closeClient();
+    }
 
-void TcpECC::receiveLoop() {
-    while (true) {
-        uint8_t buffer[3072];
-        ssize_t len = recv(sock_fd_, buffer, sizeof(buffer), 0);
-        if (len <= 0) break;
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        sock_fd_ = fd;
+        sendQueue_.clear();
+        writeArmed_ = false;
+        sendFailed_ = false;
+    }
+    framer_ = stream::StreamFramer();
+    reactor_->add(fd, EPOLLIN | EPOLLRDHUP, [this](uint32_t events) {
+        if (events & EPOLLOUT) onWritable();
+        if (events & ~EPOLLOUT) onReadable();
+    });
 
-        std::vector<uint8_t> raw(buffer, buffer + len);
-        auto msg = Common::MessageParser::parse(raw, getSenderType());
+    // std::cout << "[TcpECC] 클라이언트 연결됨" << std::endl;
+}
 
+void TcpECC::onReadable() {
+    auto status = framer_.receive(sock_fd_, [&](const uint8_t* frame, size_t len) {
         if (callback_) {
-            callback_->onMessage(msg);
+            callback_->onRawFrame(getSenderType(), frame, len);
+        }
+        // 잘못된 프레임 하나가 리액터 스레드(LC 전체)를 멈추지 않도록 파싱/처리 예외는 여기서 끊음
+        try {
+            auto msg = parser_.parse(Common::ByteSpan(frame, len), getSenderType());
+            if (callback_) {
+                callback_->onMessage(msg);
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "[TcpECC] 메시지 처리 중 예외: " << e.what() << "\n";
         }
+    });
+
+    if (status == stream::StreamFramer::Status::Ok) return;
+
+    if (status == stream::StreamFramer::Status::Error) {
+        std::cerr << "[TcpECC] 수신 에러: " << strerror(errno) << " (errno=" << errno << ")\n";
+    } else if (status == stream::StreamFramer::Status::Oversize) {
+        std::cerr << "[TcpECC] 프레임 길이 오류, 연결 종료\n";
     }
+    closeClient();
+}
+
+void TcpECC::onWritable() {
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    if (sock_fd_ < 0 || sendFailed_) return;
+    updateSendState(sendQueue_.flush(sock_fd_));
+}
+
+// sendMutex_ 보유 상태에서 호출. 큐가 남으면 EPOLLOUT 등록, 비면 해제
+// 초과/에러면 shutdown만 하고 실제 종료는 이어지는 수신 이벤트(Closed)에서 closeClient로 처리
+void TcpECC::updateSendState(stream::SendQueue::Status status) {
+    if (status != stream::SendQueue::Status::Ok) {
+        if (status == stream::SendQueue::Status::Full) {
+            std::cerr << "[TcpECC] 송신 큐 초과 (" << sendQueue_.pendingBytes() << " 바이트 대기), 연결 종료\n";
+        } else {
+            std::cerr << "[TcpECC] 송신 에러: " << strerror(errno) << " (errno=" << errno << ")\n";
+        }
+        sendQueue_.clear();
+        sendFailed_ = true;
+        shutdown(sock_fd_, SHUT_RDWR);
+    }
+
+    const bool pending = sendQueue_.pendingBytes() > 0;
+    if (pending != writeArmed_) {
+        reactor_->modify(sock_fd_, EPOLLIN | EPOLLRDHUP | (pending ? EPOLLOUT : 0));
+        writeArmed_ = pending;
+    }
+}
+
+void TcpECC::closeClient() {
+    if (sock_fd_ < 0) return;
+    reactor_->remove(sock_fd_);
+
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    close(sock_fd_);
+    sock_fd_ = -1;
+    sendQueue_.clear();
+    writeArmed_ = false;
+    sendFailed_ = false;
 }
 
 SenderType TcpECC::getSenderType() const {
@@ -77,7 +153,7 @@ SenderType TcpECC::getSenderType() const {
 
 void TcpECC::handleReceived(const std::vector<uint8_t>& data, SenderType from) {
     if (callback_) {
-        auto msg = Common::MessageParser::parse(data, from);
+        auto msg = parser_.parse(data, from);
         callback_->onMessage(msg);
     }
 }
@@ -106,16 +182,22 @@ void TcpECC::sendRaw(const std::vector<uint8_t>& data, const std::string& prefix
     static int sendCounter = 0;
     sendCounter++;
 
-
-
-    ssize_t sent = send(sock_fd_, data.data(), data.size(), 0);
+    // 리액터 스레드에서 호출: 바로 못 보낸 나머지는 큐에 두고 EPOLLOUT에서 이어서 보냄
+    bool sent;
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        if (sock_fd_ < 0 || sendFailed_) return;
+        auto status = sendQueue_.push(sock_fd_, data.data(), data.size());
+        sent = status == stream::SendQueue::Status::Ok;
+        updateSendState(status);
+    }
 
     if (sendCounter % 10 != 0) {
         return;
     }
-    if (sent < 0) {
+    if (!sent) {
         std::cerr << prefix << " - 전송 실패 (errno=" << errno << ")\n";
     } else {
-        std::cout << prefix << " - " << sent << " 바이트 전송 완료\n";
+        std::cout << prefix << " - " << data.size() << " 바이트 전송 완료\n";
     }
 }
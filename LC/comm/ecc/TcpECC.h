@@ -5,7 +5,10 @@
 #include "SystemStatus.h"
 #include "SenderType.h"
 #include "CommonMessage.h"
+#include "MessageParser.h"
 #include "Serializer.h"
+#include "StreamFramer.h"
+#include <mutex>
 #include <vector>
 #include <string>
 #include <memory>
@@ -17,7 +20,7 @@ public:
     TcpECC(const std::string& ip, int port);
 
     void setCallback(IReceiverCallback* cb);
-    void start() override;
+    void start(Reactor& reactor) override;
     SenderType getSenderType() const override;
 
     // IStatusSender 인터페이스 구현
@@ -37,9 +40,22 @@ public:
 private:
     std::string ip_;
     int port_;
+    int listen_fd_ = -1;
     int sock_fd_ = -1;
+    std::mutex sendMutex_;  // 연결 교체/종료와 송신 큐 보호
+    stream::SendQueue sendQueue_;  // 상대가 늦게 읽을 때 남은 송신 데이터 (초과 시 연결 종료)
+    bool writeArmed_ = false;      // EPOLLOUT 등록 여부
+    bool sendFailed_ = false;      // 송신 실패로 종료 대기 중 (이후 송신은 버림)
     IReceiverCallback* callback_ = nullptr;
+    Reactor* reactor_ = nullptr;
 
-    void receiveLoop();
+    stream::StreamFramer framer_;
+    Common::MessageParser parser_;
+
+    void onAccept();
+    void onReadable();
+    void onWritable();
+    void updateSendState(stream::SendQueue::Status status);
+    void closeClient();
     void sendRaw(const std::vector<uint8_t>& data, const std::string& prefix);
 };
@@ -2,6 +2,7 @@
 #include "LCManager.h"
 #include "Serializer.h"
 #include "MessageParser.h"
+#include "Reactor.h"
 #include <iostream>
 #include <iostream>
 #include <unistd.h>
@@ -9,11 +10,12 @@
 #include <arpa/inet.h>
 #include "Serializer.h"  // serializeMessage 사용 시 필요
 #include <cstring>
+#include <sys/epoll.h>
 
 
 
 SerialLS::SerialLS(int localport, const std::string& ip, int port)
-    : localPort_(localport), lcIp_(ip), lcPort_(port), stop_(false) {
+    : localPort_(localport), lcIp_(ip), lcPort_(port) {
         std::cout << "[SerialLS] 생성자 호출됨, 로컬 포트: " << localPort_ << ", LC IP: " << lcIp_ << ", LC 포트: " << lcPort_ << std::endl;
     }
 
@@ -24,7 +26,7 @@ void SerialLS::setCallback(IReceiverCallback* cb) {
 
 void SerialLS::handleReceived(const std::vector<uint8_t>& data, SenderType from) {
     if (callback_) {
-        auto parsed = Common::MessageParser::parse(data, from);
+        auto parsed = parser_.parse(data, from);
         callback_->onMessage(parsed);
     } else {
         std::cerr << "[SerialLS] ⚠️ callback이 설정되지 않았습니다.\n";
@@ -36,8 +38,10 @@ void SerialLS::sendStatus(const Common::CommonMessage& msg) {
     sendRaw(data, "[SerialLS] CommonMessage 전송");
 }
 
-void SerialLS::start() {
-    sockfd_ = socket(AF_INET, SOCK_DGRAM, 0);
+void SerialLS::start(Reactor& reactor) {
+    reactor_ = &reactor;
+
+    sockfd_ = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
     if (sockfd_ < 0) {
         perror("[SerialLS] socket");
         return;
@@ -51,46 +55,57 @@ void SerialLS::start() {
     if (bind(sockfd_, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
         perror("[SerialLS] bind");
         close(sockfd_);
+        sockfd_ = -1;
         return;
     }
 
-    std::thread([this]() {
-        int recvCounter = 0;  // ✅ 쓰레드 안에서 선언된 로컬 카운터
-
-        while (!stop_) {
-            uint8_t buffer[3072];
-            sockaddr_in client_addr{};
-            socklen_t len = sizeof(client_addr);
-
-            ssize_t recv_len = recvfrom(sockfd_, buffer, sizeof(buffer), 0,
-                                        (sockaddr*)&client_addr, &len);
-            if (recv_len > 0) {
-                recvCounter++;  // ✅ 정상 수신 횟수 증가
-
-                if (recvCounter % 10 == 0) {
-                    std::cout << "[SerialLS] 수신 데이터 크기: " << recv_len << " 바이트\n";
-                }
-
-                std::vector<uint8_t> raw(buffer, buffer + recv_len);
-                try {
-                    auto msg = Common::MessageParser::parse(raw, getSenderType());
-                    if (callback_) {
-                        callback_->onMessage(msg);
-                    } else {
-                        std::cerr << "[SerialLS] ⚠️ 콜백이 설정되지 않았습니다.\n";
-                    }
-                } catch (const std::exception& e) {
-                    std::cerr << "[SerialLS] 파싱 실패: " << e.what() << "\n";
-                }
-            } else if (recv_len < 0) {
-                std::cerr << "[SerialLS] 수신 에러: " << strerror(errno) << "\n";
-                break;
+    reactor.add(sockfd_, EPOLLIN, [this](uint32_t) { onReadable(); });
+}
+
+void SerialLS::onReadable() {
+    while (true) {
+        uint8_t buffer[3072];
+        sockaddr_in client_addr{};
+        socklen_t len = sizeof(client_addr);
+
+        ssize_t recv_len = recvfrom(sockfd_, buffer, sizeof(buffer), MSG_DONTWAIT,
+                                    (sockaddr*)&client_addr, &len);
+        if (recv_len < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+                return;
             }
+            std::cerr << "[SerialLS] 수신 에러: " << strerror(errno) << "\n";
+            reactor_->remove(sockfd_);
+            close(sockfd_);
+            sockfd_ = -1;
+            return;
+        }
+        if (recv_len == 0) {
+            continue;
         }
 
-        close(sockfd_);
-    }).detach();
+        recvCounter_++;  // ✅ 정상 수신 횟수 증가
+        if (recvCounter_ % 10 == 0) {
+            std::cout << "[SerialLS] 수신 데이터 크기: " << recv_len << " 바이트\n";
+        }
+
+        if (callback_) {
+            callback_->onRawFrame(getSenderType(), buffer, static_cast<size_t>(recv_len));
+        }
+
+        try {
+            auto msg = parser_.parse(Common::ByteSpan(buffer, static_cast<size_t>(recv_len)), getSenderType());
+            if (callback_) {
+                callback_->onMessage(msg);
+            } else {
+                std::cerr << "[SerialLS] ⚠️ 콜백이 설정되지 않았습니다.\n";
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "[SerialLS] 파싱 실패: " << e.what() << "\n";
+        }
+    }
 }
+
 SenderType SerialLS::getSenderType() const {
     return SenderType::LS;
 }
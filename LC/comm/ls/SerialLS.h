@@ -12,6 +12,7 @@
 #include "SenderType.h"
 #include "SystemStatus.h"       // ✅ 이것이 반드시 필요
 #include "CommonMessage.h"
+#include "MessageParser.h"
 
 class SerialLS : public IReceiver, public IStatusSender{
 public:
@@ -19,7 +20,7 @@ public:
 
     void setCallback(IReceiverCallback* cb);  // ✅ LCManager → IReceiverCallback
 
-    void start() override;
+    void start(Reactor& reactor) override;
     SenderType getSenderType() const override;
 
     // IStatusSender 인터페이스 구현
@@ -35,11 +36,16 @@ public:
 
 private:
     IReceiverCallback* callback_ = nullptr;
-    int sockfd_;
+    int sockfd_ = -1;
     uint16_t localPort_;
     std::string lcIp_;
     uint16_t lcPort_;
-    std::atomic<bool> stop_;
+    Reactor* reactor_ = nullptr;
+    int recvCounter_ = 0;
+    Common::MessageParser parser_;
+
+    // 소켓에 쌓인 데이터그램을 모두 처리
+    void onReadable();
 
     void sendRaw(const std::vector<uint8_t>& data, const std::string& prefix);
 };
@@ -3,13 +3,14 @@
 #include "LCManager.h"
 #include "Serializer.h"
 #include "MessageParser.h"
-#include <iostream>
+#include "StreamFramer.h"
+#include "Reactor.h"
 #include <iostream>
 #include <unistd.h>
 #include <thread>
 #include <arpa/inet.h>
-#include "Serializer.h" // serializeMessage 사용 시 필요
 #include <cstring>
+#include <sys/epoll.h>
 
 TcpMFR::TcpMFR(const std::string &ip, int port)
     : ip_(ip), port_(port) {}
@@ -23,7 +24,7 @@ void TcpMFR::handleReceived(const std::vector<uint8_t> &data, SenderType from)
 {
     if (callback_)
     {
-        callback_->onMessage(Common::MessageParser::parse(data, from));
+        callback_->onMessage(parser_.parse(data, from));
     }
 }
 
@@ -33,11 +34,12 @@ void TcpMFR::sendStatus(const Common::CommonMessage &msg)
     sendRaw(data, "[TcpMFR] CommonMessage 전송");
 }
 
-void TcpMFR::start()
+void TcpMFR::start(Reactor &reactor)
 {
     std::cout << "[TcpMFR] start() 진입함" << std::endl;
+    reactor_ = &reactor;
 
-    int server_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int server_fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
     if (server_fd < 0)
     {
         perror("[TcpMFR] socket");
@@ -79,72 +81,147 @@ void TcpMFR::start()
         return;
     }
 
+    listen_fd_ = server_fd;
+    reactor.add(listen_fd_, EPOLLIN, [this](uint32_t)
+                { onAccept(); });
     std::cout << "[TcpMFR] 클라이언트 대기 중: " << ip_ << ":" << port_ << std::endl;
-    std::thread([this, server_fd]()
-                {
-        sockaddr_in client_addr{};
-        socklen_t len = sizeof(client_addr);
-        sock_fd_ = accept(server_fd, (sockaddr*)&client_addr, &len);
-        close(server_fd);
-
-        if (sock_fd_ < 0) {
-            perror("[TcpMFR] accept");
-            return;
-        }
-
-        std::cout << "[TcpMFR] 클라이언트 연결됨" << std::endl;
-        receiveLoop(); })
-        .detach();
-
-    // std::cout << "[TcpMFR] 클라이언트 연결됨" << std::endl;
-    // std::thread(&TcpMFR::receiveLoop, this).detach();   // 146420
 }
 
-void TcpMFR::receiveLoop()
+void TcpMFR::onAccept()
 {
-    std::cout << "[TcpMFR] receiveLoop() 진입\n";
+    sockaddr_in client_addr{};
+    socklen_t len = sizeof(client_addr);
+    // 논블로킹: 읽지 않는 상대 때문에 리액터 스레드가 send에서 멈추지 않도록 송신은 큐로 처리
+    int fd = accept4(listen_fd_, (sockaddr *)&client_addr, &len, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            perror("[TcpMFR] accept");
+        }
+        return;
+    }
 
-    while (true)
+    if (sock_fd_ >= 0)
     {
-        uint8_t buffer[3072];
-        ssize_t len = recv(sock_fd_, buffer, sizeof(buffer), 0);
-        // std::cout << "[TcpMFR] recv() 호출됨, len = " << len << "\n";
+        std::cout << "[TcpMFR] 새 연결로 기존 연결 교체" << std::endl;
+        closeClient();
+    }
 
-        if (len == 0)
+    {
+        std::lock_guard<std::mutex> lock(sendMutex_);
+        sock_fd_ = fd;
+        sendQueue_.clear();
+        writeArmed_ = false;
+        sendFailed_ = false;
+    }
+    framer_ = stream::StreamFramer();
+    reactor_->add(fd, EPOLLIN | EPOLLRDHUP, [this](uint32_t events)
+                  {
+        if (events & EPOLLOUT)
         {
-            // std::cerr << "[TcpMFR] 클라이언트가 연결을 종료했습니다.\n";
-            break;
+            onWritable();
         }
-        else if (len < 0)
+        if (events & ~EPOLLOUT)
         {
-            std::cerr << "[TcpMFR] 수신 에러: " << strerror(errno) << " (errno=" << errno << ")\n";
-            break;
-        }
+            onReadable();
+        } });
 
-        // std::cout << "[TcpMFR] 데이터 수신 성공: " << len << " 바이트\n";
-
-        std::vector<uint8_t> raw(buffer, buffer + len);
+    std::cout << "[TcpMFR] 클라이언트 연결됨" << std::endl;
+}
 
+void TcpMFR::onReadable()
+{
+    // recv 한 번에 붙어 온 프레임을 모두 처리, 나뉘어 온 프레임은 다음 이벤트에서 완성
+    auto status = framer_.receive(sock_fd_, [&](const uint8_t *frame, size_t len)
+                                  {
+        if (callback_)
+        {
+            callback_->onRawFrame(getSenderType(), frame, len);
+        }
         Common::CommonMessage msg;
         try
         {
-            msg = Common::MessageParser::parse(raw, getSenderType());
-            // std::cout << "[TcpMFR] 파싱 성공: CommandType = " << static_cast<int>(msg.commandType) << "\n";
+            msg = parser_.parse(Common::ByteSpan(frame, len), getSenderType());
         }
         catch (const std::exception &e)
         {
             std::cerr << "[TcpMFR] 파싱 중 예외: " << e.what() << "\n";
-            continue;
+            return;
         }
         if (callback_)
         {
-            // std::cout << "[TcpMFR] onMessage 호출\n";
             callback_->onMessage(msg);
+        } });
+
+    if (status == stream::StreamFramer::Status::Ok)
+    {
+        return;
+    }
+
+    if (status == stream::StreamFramer::Status::Error)
+    {
+        std::cerr << "[TcpMFR] 수신 에러: " << strerror(errno) << " (errno=" << errno << ")\n";
+    }
+    else if (status == stream::StreamFramer::Status::Oversize)
+    {
+        std::cerr << "[TcpMFR] 프레임 길이 오류, 연결 종료\n";
+    }
+    std::cerr << "[TcpMFR] 연결 종료, 재접속 대기\n";
+    closeClient();
+}
+
+void TcpMFR::onWritable()
+{
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    if (sock_fd_ < 0 || sendFailed_)
+    {
+        return;
+    }
+    updateSendState(sendQueue_.flush(sock_fd_));
+}
+
+// sendMutex_ 보유 상태에서 호출. 큐가 남으면 EPOLLOUT 등록, 비면 해제
+// 초과/에러면 shutdown만 하고 실제 종료는 이어지는 수신 이벤트(Closed)에서 closeClient로 처리
+void TcpMFR::updateSendState(stream::SendQueue::Status status)
+{
+    if (status != stream::SendQueue::Status::Ok)
+    {
+        if (status == stream::SendQueue::Status::Full)
+        {
+            std::cerr << "[TcpMFR] 송신 큐 초과 (" << sendQueue_.pendingBytes() << " 바이트 대기), 연결 종료\n";
+        }
+        else
+        {
+            std::cerr << "[TcpMFR] 송신 에러: " << strerror(errno) << " (errno=" << errno << ")\n";
         }
+        sendQueue_.clear();
+        sendFailed_ = true;
+        shutdown(sock_fd_, SHUT_RDWR);
     }
 
-    std::cerr << "[TcpMFR] 수신 루프 종료, 소켓 닫음\n";
+    const bool pending = sendQueue_.pendingBytes() > 0;
+    if (pending != writeArmed_)
+    {
+        reactor_->modify(sock_fd_, EPOLLIN | EPOLLRDHUP | (pending ? EPOLLOUT : 0));
+        writeArmed_ = pending;
+    }
+}
+
+void TcpMFR::closeClient()
+{
+    if (sock_fd_ < 0)
+    {
+        return;
+    }
+    reactor_->remove(sock_fd_);
+
+    std::lock_guard<std::mutex> lock(sendMutex_);
     close(sock_fd_);
+    sock_fd_ = -1;
+    sendQueue_.clear();
+    writeArmed_ = false;
+    sendFailed_ = false;
 }
 
 SenderType TcpMFR::getSenderType() const
@@ -170,8 +247,15 @@ void TcpMFR::sendRaw(const std::vector<uint8_t> &data)
 
     // const std::string prefix = "[TcpMFR] 일반 전송";
 
-    ssize_t sent = send(sock_fd_, data.data(), data.size(), 0);
-    if (sent < 0)
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    if (sock_fd_ < 0 || sendFailed_)
+    {
+        return;
+    }
+    auto status = sendQueue_.push(sock_fd_, data.data(), data.size());
+    bool sent = status == stream::SendQueue::Status::Ok;
+    updateSendState(status);
+    if (!sent)
     {
         // std::cerr << prefix << " - 전송 실패 (errno=" << errno << ")\n";
     }
@@ -179,7 +263,7 @@ void TcpMFR::sendRaw(const std::vector<uint8_t> &data)
     {
         if (sendCounter2 % 10 == 0)
         {
-            // std::cout << prefix << " - " << sent << " 바이트 전송 완료\n";
+            // std::cout << prefix << " - " << data.size() << " 바이트 전송 완료\n";
         }
     }
 }
@@ -188,8 +272,16 @@ void TcpMFR::sendRaw(const std::vector<uint8_t> &data, const std::string &prefix
     static int sendCounter = 0;
     sendCounter++;
 
-    ssize_t sent = send(sock_fd_, data.data(), data.size(), 0);
-    if (sent < 0)
+    // 리액터 스레드에서 호출: 바로 못 보낸 나머지는 큐에 두고 EPOLLOUT에서 이어서 보냄
+    std::lock_guard<std::mutex> lock(sendMutex_);
+    if (sock_fd_ < 0 || sendFailed_)
+    {
+        return;
+    }
+    auto status = sendQueue_.push(sock_fd_, data.data(), data.size());
+    bool sent = status == stream::SendQueue::Status::Ok;
+    updateSendState(status);
+    if (!sent)
     {
         std::cerr << prefix << " - 전송 실패 (errno=" << errno << ")\n";
     }
@@ -197,7 +289,7 @@ void TcpMFR::sendRaw(const std::vector<uint8_t> &data, const std::string &prefix
     {
         if (sendCounter % 10 == 0)
         {
-            // std::cout << prefix << " - " << sent << " 바이트 전송 완료\n";
+            // std::cout << prefix << " - " << data.size() << " 바이트 전송 완료\n";
         }
     }
 }
\ No newline at end of file
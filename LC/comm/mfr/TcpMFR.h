@@ -4,7 +4,10 @@
 #include "SenderType.h"
 #include "SystemStatus.h"       // ✅ 이것이 반드시 필요
 #include "CommonMessage.h"
+#include "MessageParser.h"
+#include "StreamFramer.h"
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -15,7 +18,7 @@ public:
 
     void setCallback(IReceiverCallback* cb);  // ✅ LCManager → IReceiverCallback
 
-    void start() override;
+    void start(Reactor& reactor) override;
     SenderType getSenderType() const override;
 
     // IStatusSender 인터페이스 구현
@@ -30,9 +33,22 @@ public:
 private:
     std::string ip_;
     int port_;
+    int listen_fd_ = -1;
     int sock_fd_ = -1;
+    std::mutex sendMutex_;  // 연결 교체/종료와 송신 큐 보호
+    stream::SendQueue sendQueue_;  // 상대가 늦게 읽을 때 남은 송신 데이터 (초과 시 연결 종료)
+    bool writeArmed_ = false;      // EPOLLOUT 등록 여부
+    bool sendFailed_ = false;      // 송신 실패로 종료 대기 중 (이후 송신은 버림)
     IReceiverCallback* callback_ = nullptr;
+    Reactor* reactor_ = nullptr;
 
-    void receiveLoop();
+    stream::StreamFramer framer_;
+    Common::MessageParser parser_; // 탐지 목록 arena와 0x24 키프레임 캐시를 연결별로 보유
+
+    void onAccept();
+    void onReadable();
+    void onWritable();
+    void updateSendState(stream::SendQueue::Status status);
+    void closeClient();
     void sendRaw(const std::vector<uint8_t>& data, const std::string& prefix);
 };
\ No newline at end of file
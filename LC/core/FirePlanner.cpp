@@ -0,0 +1,143 @@
+#include "FirePlanner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+    // 우선순위 0은 미지정 → 가장 뒤
+    int priorityRank(uint8_t priority)
+    {
+        return priority == 0 ? 256 : priority;
+    }
+}
+
+FirePlanner::Shot FirePlanner::planTarget(const LSStatus &ls, const TargetStatus &target, double launchDelay) const
+{
+    Shot shot;
+    shot.targetId = target.id;
+    shot.priority = target.priority;
+
+    Common::LaunchCommand &cmd = shot.command;
+    cmd.launcherId = ls.launchSystemId;
+
+    // 발사대 기준 평면 근사 (위도 → 북, 경도 → 동)
+    const double lat_ls = static_cast<double>(ls.position.x) / geo::COORD_SCALE;
+    const double lon_ls = static_cast<double>(ls.position.y) / geo::COORD_SCALE;
+    const double meters_per_deg_lon = geo::metersPerDegLon(lat_ls);
+
+    const geo::Enu offset{(static_cast<double>(target.posY) / geo::COORD_SCALE - lon_ls) * meters_per_deg_lon,
+                          (static_cast<double>(target.posX) / geo::COORD_SCALE - lat_ls) * geo::METERS_PER_DEG_LAT,
+                          static_cast<double>(target.altitude - ls.height)};
+
+    const double missileSpeed = static_cast<double>(ls.speed) * geo::KMH_TO_MPS;
+    const double targetSpeed = static_cast<double>(target.speed) * geo::KMH_TO_MPS;
+    const geo::Enu velocity = InterceptSolver::velocityFromHeading(targetSpeed, target.angle1, target.angle2);
+
+    shot.solution = solver_.solve(offset, velocity, missileSpeed);
+    if (!shot.solution.ok)
+    {
+        cmd.launchAngleXY = geo::flatBearing(geo::Enu{offset.east, offset.north, 0.0});
+        cmd.launchAngleXZ = 0.0;
+        cmd.start_x = 0;
+        cmd.start_y = 0;
+        cmd.start_z = 0;
+        return shot;
+    }
+
+    cmd.launchAngleXY = shot.solution.bearingDeg;
+    cmd.launchAngleXZ = shot.solution.elevationDeg;
+
+    const double flown_m = missileSpeed * launchDelay;
+    const double bearingRad = cmd.launchAngleXY * geo::DEG_TO_RAD;
+    cmd.start_x = static_cast<long long>((std::cos(bearingRad) * flown_m / geo::METERS_PER_DEG_LAT) * geo::COORD_SCALE + ls.position.x);
+    cmd.start_y = static_cast<long long>((std::sin(bearingRad) * flown_m / meters_per_deg_lon) * geo::COORD_SCALE + ls.position.y);
+    cmd.start_z = static_cast<long long>(ls.height);
+    return shot;
+}
+
+const TargetStatus *FirePlanner::topTarget(const SystemStatus &status)
+{
+    const TargetStatus *best = nullptr;
+    double bestDistSq = 0.0;
+    for (const auto &t : status.targets)
+    {
+        if (t.hit)
+            continue;
+
+        const double dx = static_cast<double>(t.posX - status.ls.position.x);
+        const double dy = static_cast<double>(t.posY - status.ls.position.y);
+        const double distSq = dx * dx + dy * dy;
+        if (best == nullptr || priorityRank(t.priority) < priorityRank(best->priority) ||
+            (priorityRank(t.priority) == priorityRank(best->priority) && distSq < bestDistSq))
+        {
+            best = &t;
+            bestDistSq = distSq;
+        }
+    }
+    return best;
+}
+
+FirePlanner::Plan FirePlanner::plan(const SystemStatus &status, double launchDelay, size_t maxShots) const
+{
+    std::vector<const TargetStatus *> candidates;
+    candidates.reserve(status.targets.size());
+    for (const auto &t : status.targets)
+    {
+        if (!t.hit)
+            candidates.push_back(&t);
+    }
+
+    std::vector<Shot> shots(candidates.size());
+    auto solveRange = [&](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+            shots[i] = planTarget(status.ls, *candidates[i], launchDelay);
+    };
+
+    const size_t n = candidates.size();
+    const size_t workers = n >= PARALLEL_MIN_TARGETS
+                               ? std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), n / (PARALLEL_MIN_TARGETS / 4))
+                               : 1;
+    if (workers <= 1)
+    {
+        solveRange(0, n);
+    }
+    else
+    {
+        // 호출 스레드가 첫 구간을 맡고 나머지는 임시 스레드로
+        const size_t chunk = (n + workers - 1) / workers;
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        for (size_t w = 1; w < workers; ++w)
+        {
+            const size_t begin = std::min(n, w * chunk);
+            threads.emplace_back(solveRange, begin, std::min(n, begin + chunk));
+        }
+        solveRange(0, std::min(n, chunk));
+        for (auto &th : threads)
+            th.join();
+    }
+
+    Plan result;
+    auto reachableEnd = std::partition(shots.begin(), shots.end(), [](const Shot &s)
+                                       { return s.solution.ok; });
+    result.unreachable = static_cast<size_t>(shots.end() - reachableEnd);
+    shots.erase(reachableEnd, shots.end());
+
+    std::sort(shots.begin(), shots.end(), [](const Shot &a, const Shot &b)
+              {
+        const int pa = priorityRank(a.priority);
+        const int pb = priorityRank(b.priority);
+        if (pa != pb)
+            return pa < pb;
+        if (a.solution.time != b.solution.time)
+            return a.solution.time < b.solution.time;
+        return a.targetId < b.targetId; });
+
+    if (shots.size() > maxShots)
+        shots.resize(maxShots);
+    result.shots = std::move(shots);
+    return result;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CommonMessage.h"
+#include "InterceptSolver.h"
+#include "SystemStatus.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 발사대 기준 표적별 요격 해 계산과 교전 순서 결정
+// - planTarget: 표적 1개 → LaunchCommand (요격 해가 없으면 현재 방위각으로 fallback)
+// - plan: 표적 테이블 전체를 계산해 우선순위(MFR 부여, 1이 최우선), 요격까지 남은 시간 순으로 정렬
+class FirePlanner
+{
+public:
+    // ECC FireCommand.targetId가 이 값이면 전체 교전(일제 사격)
+    static constexpr unsigned int ENGAGE_ALL_TARGET_ID = 0xFFFFFFFFu;
+    // 표적이 이보다 많을 때만 스레드로 나눠 계산 (해 1개가 수백 ns라 적으면 순차가 더 빠르다)
+    static constexpr size_t PARALLEL_MIN_TARGETS = 1024;
+
+    struct Shot
+    {
+        unsigned int targetId = 0;
+        uint8_t priority = 0;
+        InterceptSolver::Result solution;
+        Common::LaunchCommand command{};
+    };
+
+    struct Plan
+    {
+        std::vector<Shot> shots; // 교전 순서, 요격 가능한 표적만
+        size_t unreachable = 0;  // 요격 해가 없어 제외된 표적 수
+    };
+
+    FirePlanner() = default;
+    explicit FirePlanner(const InterceptSolver &solver) : solver_(solver) {}
+
+    // launchDelay: 명령 수신부터 실제 발사까지의 지연 (s), 그동안 미사일이 비행한 지점을 시작점으로 사용
+    Shot planTarget(const LSStatus &ls, const TargetStatus &target, double launchDelay) const;
+
+    // 격추(hit)된 표적은 제외, maxShots개까지만 반환
+    Plan plan(const SystemStatus &status, double launchDelay, size_t maxShots = SIZE_MAX) const;
+
+    // 격추되지 않은 표적 중 우선순위가 가장 높은 것 (같으면 발사대에서 가까운 순), 없으면 nullptr
+    // 요격 해가 하나도 없을 때 fallback 각도로 쏠 표적을 고르는 용도
+    static const TargetStatus *topTarget(const SystemStatus &status);
+
+private:
+    InterceptSolver solver_;
+};
@@ -0,0 +1,105 @@
+#include "InterceptSolver.h"
+
+#include <cmath>
+#include <utility>
+
+namespace
+{
+    // a t² + b t + c = 0 의 가장 작은 양의 근, 없으면 -1
+    double smallestPositiveRoot(double a, double b, double c)
+    {
+        constexpr double EPS = 1e-12;
+
+        if (std::abs(a) < EPS)
+        {
+            // 미사일과 타겟 속력이 같을 때: 1차식
+            if (std::abs(b) < EPS)
+                return -1.0;
+            const double t = -c / b;
+            return t > 0.0 ? t : -1.0;
+        }
+
+        const double disc = b * b - 4.0 * a * c;
+        if (disc < 0.0)
+            return -1.0;
+
+        // 상쇄 오차를 피하는 형태 (q = -(b + sign(b)√D) / 2)
+        const double q = -0.5 * (b + std::copysign(std::sqrt(disc), b));
+        double t1 = q / a;
+        double t2 = (q != 0.0) ? c / q : t1;
+        if (t1 > t2)
+            std::swap(t1, t2);
+
+        if (t1 > 0.0)
+            return t1;
+        if (t2 > 0.0)
+            return t2;
+        return -1.0;
+    }
+}
+
+geo::Enu InterceptSolver::velocityFromHeading(double speedMps, double headingDeg, double climbDeg)
+{
+    const double heading = headingDeg * geo::DEG_TO_RAD;
+    return geo::Enu{speedMps * std::sin(heading),
+                    speedMps * std::cos(heading),
+                    std::tan(climbDeg * geo::DEG_TO_RAD) * speedMps};
+}
+
+InterceptSolver::Result InterceptSolver::solve(const geo::Enu &target, const geo::Enu &targetVelocity, double missileSpeed) const
+{
+    Result result;
+    if (!(missileSpeed > 0.0))
+        return result;
+
+    // 1) 수평면 닫힌 해
+    const double a = targetVelocity.east * targetVelocity.east + targetVelocity.north * targetVelocity.north - missileSpeed * missileSpeed;
+    const double b = 2.0 * (target.east * targetVelocity.east + target.north * targetVelocity.north);
+    const double c = target.east * target.east + target.north * target.north;
+
+    double t = smallestPositiveRoot(a, b, c);
+    if (t <= 0.0 || t > options_.maxTime)
+        return result;
+
+    // 2) 고도/상승률 포함 3차원 Newton 보정, 발산하면 수평 해 유지
+    if (options_.refine)
+    {
+        double tn = t;
+        for (int i = 0; i < options_.maxIterations; ++i)
+        {
+            const double rx = target.east + targetVelocity.east * tn;
+            const double ry = target.north + targetVelocity.north * tn;
+            const double rz = target.up + targetVelocity.up * tn;
+            const double range = std::sqrt(rx * rx + ry * ry + rz * rz);
+            if (range <= 0.0)
+                break;
+
+            const double f = range - missileSpeed * tn;
+            const double df = (rx * targetVelocity.east + ry * targetVelocity.north + rz * targetVelocity.up) / range - missileSpeed;
+            if (std::abs(df) < 1e-12)
+                break;
+
+            const double step = f / df;
+            tn -= step;
+            result.iterations = i + 1;
+            if (!(tn > 0.0) || tn > options_.maxTime)
+            {
+                tn = t;
+                result.iterations = 0;
+                break;
+            }
+            if (std::abs(step) < options_.tolerance)
+                break;
+        }
+        t = tn;
+    }
+
+    result.ok = true;
+    result.time = t;
+    result.aim = geo::Enu{target.east + targetVelocity.east * t,
+                          target.north + targetVelocity.north * t,
+                          target.up + targetVelocity.up * t};
+    result.bearingDeg = geo::flatBearing(result.aim);
+    result.elevationDeg = std::atan2(result.aim.up, std::hypot(result.aim.east, result.aim.north)) * geo::RAD_TO_DEG;
+    return result;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Geodesy.h"
+
+// 등속 직선 타겟 / 등속 요격 미사일의 요격 시각 계산
+// 1) 수평면: |P + V t| = s t 를 t에 대한 2차식으로 풀어 가장 이른 양의 근을 구한다 (닫힌 해)
+// 2) refine이면 고도차와 타겟 상승률까지 넣은 3차원 사거리식 |P3 + V3 t| - s t = 0 을 1)의 해에서 출발한 Newton 반복으로 보정
+// 좌표는 발사대 기준 동/북/상 (m), 속도는 m/s
+class InterceptSolver
+{
+public:
+    struct Options
+    {
+        double maxTime = 2000.0;  // 이보다 늦은 요격은 불가로 처리 (s)
+        bool refine = true;       // 3차원 Newton 보정 여부
+        int maxIterations = 8;
+        double tolerance = 1e-6;  // Newton 종료 조건 (s)
+    };
+
+    struct Result
+    {
+        bool ok = false;
+        double time = 0.0;        // 요격까지 걸리는 시간 (s)
+        geo::Enu aim{};           // 요격 지점 (발사대 기준)
+        double bearingDeg = 0.0;  // 진북 기준 0~360
+        double elevationDeg = 0.0;
+        int iterations = 0;       // Newton 반복 횟수 (0이면 닫힌 해 그대로)
+    };
+
+    InterceptSolver() = default;
+    explicit InterceptSolver(const Options &options) : options_(options) {}
+
+    // 방위각(진북 기준)/상승각(deg)과 속력으로 속도 벡터 구성, 상승량은 tan(climb) * 수평 속력
+    static geo::Enu velocityFromHeading(double speedMps, double headingDeg, double climbDeg);
+
+    Result solve(const geo::Enu &target, const geo::Enu &targetVelocity, double missileSpeed) const;
+
+    const Options &options() const { return options_; }
+
+private:
+    Options options_;
+};
@@ -1,6 +1,8 @@
 #include "LCCommandHandler.h"
 #include "LCManager.h"
 #include "Serializer.h"
+#include "Geodesy.h"
+#include "FirePlanner.h"
 #include <iostream>
 #include <vector>
 #include <cstring>
@@ -49,6 +51,12 @@ namespace LCCommandHandler
             {
                 std::cerr << "[LCCommandHandler] MFR 송신자 없음. 전송 실패\n";
             }
+
+            // 회전모드 복귀 시 표적 잠금 해제 (MFR 폴링 주기 원복)
+            if (payload.radarMode == 0x02)
+            {
+                manager.setTargetLock(0);
+            }
             break;
         }
         // 0x03
@@ -77,193 +85,105 @@ namespace LCCommandHandler
             std::cout << "[ECC] 발사 명령 수신 → lsId=" << payload.lsId
                       << ", targetId=" << payload.targetId << "\n";
 
-            SystemStatus snapshot = manager.getStatusCopy();
-            const auto &ls = snapshot.ls;
-            const auto &targets = snapshot.targets;
+            StatusSnapshot snapshot = manager.getStatusSnapshot();
+            // 표 위치는 마지막 MFR 보고 시점 → 지금까지 이동한 만큼 외삽한 사본으로 계산
+            SystemStatus current = *snapshot;
+            manager.extrapolateTargets(current);
+            const auto &ls = current.ls;
 
-            TargetStatus selectedTarget{};
-            bool found = false;
+            static const FirePlanner planner;
+            // 계산 지연(+0.15s) 동안 미사일이 이동한 위치를 시작점으로 사용
+            std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - loop_start;
+            const double launchDelay = elapsed.count() + 0.15;
 
-            if (payload.targetId == 0)
+            std::vector<FirePlanner::Shot> shots;
+            if (payload.targetId == FirePlanner::ENGAGE_ALL_TARGET_ID)
             {
-                long long minDistSq = LLONG_MAX;
-                for (const auto &t : targets)
-                {
-                    long long dx = t.posX - ls.position.x;
-                    long long dy = t.posY - ls.position.y;
-                    long long distSq = dx * dx + dy * dy;
-                    if (distSq < minDistSq)
-                    {
-                        minDistSq = distSq;
-                        selectedTarget = t;
-                        found = true;
-                    }
-                }
+                // 전체 교전: 요격 가능한 표적 전부를 우선순위/요격 시간 순으로 일제 사격
+                FirePlanner::Plan plan = planner.plan(current, launchDelay);
+                std::cout << "[LC] 전체 교전 계획: 발사 " << plan.shots.size()
+                          << "발, 요격 불가 " << plan.unreachable << "개\n";
+                shots = std::move(plan.shots);
             }
-            else
+            else if (payload.targetId == 0)
             {
-                for (const auto &t : targets)
+                // 지정 없음: 순위가 가장 높은 표적 1개
+                FirePlanner::Plan plan = planner.plan(current, launchDelay, 1);
+                shots = std::move(plan.shots);
+
+                // 요격 가능한 표적이 없어도 기본 발사는 유지: 최상위 표적에 fallback 각도로 발사
+                if (shots.empty())
                 {
-                    if (t.id == payload.targetId)
+                    if (const TargetStatus *t = FirePlanner::topTarget(current))
                     {
-                        selectedTarget = t;
-                        found = true;
-                        break;
+                        shots.push_back(planner.planTarget(ls, *t, launchDelay));
                     }
                 }
             }
-
-            if (!found)
+            else if (const TargetStatus *t = current.targets.find(payload.targetId))
             {
-                std::cerr << "[LC] 대상 타겟 없음 → targetId=" << payload.targetId << "\n";
-                break;
+                // 지정 표적은 요격 해가 없어도 fallback 각도로 발사
+                shots.push_back(planner.planTarget(ls, *t, launchDelay));
             }
 
-            // 레이더 정지모드 전환
-            manager.setTargetLock(selectedTarget.id); // 타겟 잠금
-            RadarModeCommand radarCmd;
-            radarCmd.radarId = snapshot.mfr.mfrId;
-            radarCmd.radarMode = 0x01;  // STOP
-            radarCmd.flag = 0x00;       // 사용 안 할 경우라도 초기화
-            radarCmd.priority_select = 0x02; // targetId 있음
-            radarCmd.targetId =  selectedTarget.id;
-            auto radarPacket = Serializer::serializeRadarModeChange(radarCmd);
-            if (manager.hasMFRSender())
+            if (shots.empty())
             {
-                manager.sendToMFR(radarPacket);
-                std::cout << "[LC] 레이더 정지모드 전송 → radarId=" << radarCmd.radarId
-                        << ", targetId=" << radarCmd.targetId << "\n";
+                std::cerr << "[LC] 대상 타겟 없음 → targetId=" << payload.targetId << "\n";
+                break;
             }
 
-            LaunchCommand cmd;
-            cmd.launcherId = ls.launchSystemId;
-
-            // 위도/경도 변환
-            double lat_ls = static_cast<double>(ls.position.x) / 1e7;
-            double lon_ls = static_cast<double>(ls.position.y) / 1e7;
-            double lat_tg = static_cast<double>(selectedTarget.posX) / 1e7;
-            double lon_tg = static_cast<double>(selectedTarget.posY) / 1e7;
-
-            const double meters_per_deg_lat = 111320.0;
-            const double meters_per_deg_lon = 111320.0 * std::cos(lat_ls * M_PI / 180.0);
-
-            double dy = (lat_tg - lat_ls) * meters_per_deg_lat;
-            double dx = (lon_tg - lon_ls) * meters_per_deg_lon;
-            double dz = 0;
-            double dist_m = std::sqrt(dx * dx + dy * dy);
-
-            std::cout << "[LC] 발사대 위치: (" << lat_ls << ", " << lon_ls << ")\n";
-            std::cout << "[LC] 타겟 위치:   (" << lat_tg << ", " << lon_tg << ")\n";
-            std::cout << "[LC] 거리 계산 결과 → dx: " << dx << "m, dy: " << dy << "m, 총거리: " << dist_m << "m\n";
-
-            double initial_bearing = std::atan2(dx, dy) * 180.0 / M_PI;
-            if (initial_bearing < 0.0)
-                initial_bearing += 360.0;
-
-            const double missileSpeed = static_cast<double>(snapshot.ls.speed) * 1000.0 / 3600.0;
-            const double targetSpeed = static_cast<double>(selectedTarget.speed) * 1000.0 / 3600.0;
-
-            std::cout << "[LC] 타겟 속도: " << selectedTarget.speed << " km/h (" << targetSpeed << " m/s)\n";
-            std::cout << "[LC] 타겟 헤딩 : " << selectedTarget.angle1 << "도\n";
-
-            double targetHeadingRad = selectedTarget.angle1 * M_PI / 180.0;
-            double vx_t = targetSpeed * std::sin(targetHeadingRad);
-            double vy_t = targetSpeed * std::cos(targetHeadingRad);
-
-            std::cout << "[LC] 타겟 속도 벡터 → vx: " << vx_t << " m/s, vy: " << vy_t << " m/s\n";
-
-            double bestTime = -1.0;
-            double interceptAngle = initial_bearing;
-            bool foundSolution = false;
-
-            for (double t = 1.0; t <= 2000.0; t += 0.1)
+            // 단일 표적 교전이면 레이더 정지모드 전환 (전체 교전은 회전 탐지 유지)
+            if (payload.targetId != FirePlanner::ENGAGE_ALL_TARGET_ID)
             {
-                double future_lat = lat_tg + (vy_t * t) / meters_per_deg_lat;
-                double future_lon = lon_tg + (vx_t * t) / meters_per_deg_lon;
-
-                double dx_f = (future_lon - lon_ls) * meters_per_deg_lon;
-                double dy_f = (future_lat - lat_ls) * meters_per_deg_lat;
-                double dist_to_future = std::sqrt(dx_f * dx_f + dy_f * dy_f);
-
-                double required_time = dist_to_future / missileSpeed;
-
-                if (std::abs(required_time - t) < 0.2)
+                const unsigned int targetId = shots.front().targetId;
+                manager.setTargetLock(targetId); // 타겟 잠금
+                RadarModeCommand radarCmd;
+                radarCmd.radarId = current.mfr.mfrId;
+                radarCmd.radarMode = 0x01;  // STOP
+                radarCmd.flag = 0x00;       // 사용 안 할 경우라도 초기화
+                radarCmd.priority_select = 0x02; // targetId 있음
+                radarCmd.targetId = targetId;
+                auto radarPacket = Serializer::serializeRadarModeChange(radarCmd);
+                if (manager.hasMFRSender())
                 {
-                    interceptAngle = std::atan2(dx_f, dy_f) * 180.0 / M_PI;
-                    if (interceptAngle < 0.0)
-                        interceptAngle += 360.0;
-                    bestTime = t;
-                    foundSolution = true;
-
-                    double altitude_change = std::tan(selectedTarget.angle2 * M_PI / 180.0) * targetSpeed * t;
-                    double target_altitude = selectedTarget.altitude + altitude_change;
-                    dz = target_altitude - ls.height;
-                    double horizontal_distance = std::sqrt(dx_f * dx_f + dy_f * dy_f); // 실제 평면 거리
-                    cmd.launchAngleXZ = std::atan2(dz, horizontal_distance) * 180.0 / M_PI;
-
-                    std::cout << "[고도 디버깅]\n";
-                    std::cout << "  타겟 초기 고도: " << selectedTarget.altitude << " m\n";
-                    std::cout << "  타겟 고도 변화량: " << altitude_change << " m\n";
-                    std::cout << "  타겟 예측 고도: " << target_altitude << " m\n";
-                    std::cout << "  타겟 상승 각: " << selectedTarget.angle2 << " m\n";
-                    std::cout << "  발사대 고도: " << ls.height << " m\n";
-                    std::cout << "  dz = 타겟고도 - 발사대고도 = " << dz << " m\n";
-                    std::cout << "  고도 각도 (XZ): " << cmd.launchAngleXZ << " 도\n";
-
-                    std::cout << "[Intercept] t=" << t << "s, 위치=(" << future_lat << ", " << future_lon << "), 각도=" << interceptAngle << "도\n";
-                    break;
+                    manager.sendToMFR(radarPacket);
+                    std::cout << "[LC] 레이더 정지모드 전송 → radarId=" << radarCmd.radarId
+                            << ", targetId=" << radarCmd.targetId << "\n";
                 }
             }
 
-            if (foundSolution)
+            // 요격 예정 시각은 첫 발 기준
+            const FirePlanner::Shot &first = shots.front();
+            if (first.solution.ok)
             {
-                cmd.launchAngleXY = interceptAngle;
-                std::cout << "[LC] 벡터 기반 요격 계산 결과\n";
-                std::cout << "  조준 각도 (XY): " << cmd.launchAngleXY << "도 (진북 기준)\n";
-                std::cout << "  조준 각도 (XZ): " << cmd.launchAngleXZ << "도 (수직 기준)\n";
-                std::cout << "  추정 요격 시간: " << bestTime << " 초\n";
-
-                auto loop_end = std::chrono::high_resolution_clock::now();
-                std::chrono::duration<double> elapsed = loop_end - loop_start;
-                cmd.start_x = static_cast<long long>(
-                    (std::cos(cmd.launchAngleXY * M_PI / 180.0) * missileSpeed * (elapsed.count() + 0.15) * 0.001 / 111.32) * 1e7 + snapshot.ls.position.x);
-
-                double lat_deg = static_cast<double>(snapshot.ls.position.x) / 1e7;
-                cmd.start_y = static_cast<long long>(
-                    (std::sin(cmd.launchAngleXY * M_PI / 180.0) * missileSpeed * (elapsed.count() + 0.15) * 0.001 / (111.32 * std::cos(lat_deg * M_PI / 180.0))) * 1e7 + snapshot.ls.position.y);
-                cmd.start_z = static_cast<long long>(snapshot.ls.height);
                 TimeStamp now_ms = getCurrentTimeMillis();
-                TimeStamp intercept_time_ms = static_cast<TimeStamp>(now_ms + (bestTime - elapsed.count()) * 1000.0);
-
-                manager.updateCalTime(intercept_time_ms);
+                manager.updateCalTime(static_cast<TimeStamp>(now_ms + (first.solution.time - elapsed.count()) * 1000.0));
             }
             else
             {
-                cmd.launchAngleXY = initial_bearing;
-                cmd.launchAngleXZ = 0.0;
-                cmd.start_x = 0;
-                cmd.start_y = 0;
-                cmd.start_z = 0;
                 manager.updateCalTime(0);
-                std::cerr << "[LC] 요격 불가: fallback 각도 적용 → " << initial_bearing << " 도\n";
+                std::cerr << "[LC] 요격 불가: fallback 각도 적용 → " << first.command.launchAngleXY << " 도\n";
             }
 
-            auto packet = Serializer::serializeLaunchCommand(cmd);
-            if (manager.hasLSSender())
-            {
-                manager.sendToLS(packet);
-            }
-            else
+            if (!manager.hasLSSender())
             {
                 std::cerr << "[LC] LS 송신자 없음. 전송 실패\n";
+                break;
             }
 
             std::cout << std::dec;
             std::cout << "------------------------------------------------------" << std::endl;
-            std::cout << "발사명령 정보\n"
-                      << "  lsId: " << cmd.launcherId
-                      << ", launchAngleXY: " << cmd.launchAngleXY
-                      << ", launchAngleXZ: " << cmd.launchAngleXZ << " (수직 기준)\n";
+            std::cout << "발사명령 정보 (" << shots.size() << "발)\n";
+            for (const auto &shot : shots)
+            {
+                manager.sendToLS(Serializer::serializeLaunchCommand(shot.command));
+                std::cout << "  lsId: " << shot.command.launcherId
+                          << ", targetId: " << shot.targetId
+                          << ", priority: " << static_cast<int>(shot.priority)
+                          << ", launchAngleXY: " << shot.command.launchAngleXY
+                          << ", launchAngleXZ: " << shot.command.launchAngleXZ << " (수직 기준)"
+                          << ", 요격 시간: " << shot.solution.time << " 초\n";
+            }
             std::cout << "------------------------------------------------------" << std::endl;
 
             break;
@@ -289,6 +209,19 @@ namespace LCCommandHandler
             break;
         }
 
+        // 0x06
+        case CommandType::STATUS_SUBSCRIBE_ECC_TO_LC:
+        {
+            const auto *sub = std::get_if<StatusSubscribe>(&msg.payload);
+            if (sub == nullptr)
+            {
+                std::cerr << "[ECC] 상태 구독 payload 없음, 무시\n";
+                break;
+            }
+            manager.onStatusSubscribe(*sub);
+            break;
+        }
+
         default:
             std::cerr << "[ECC] 알 수 없는 명령\n";
             break;
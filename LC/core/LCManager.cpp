@@ -1,5 +1,6 @@
 // LCManager.cpp
 #include <iostream>
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <thread>
@@ -17,56 +18,59 @@
 #include "TcpECC.h" // TcpECC 포함 필요
 #include "LCCommandHandler.h"
 #include "LCConfig.h"
+#include "MessageParser.h"
+#include "Trace.h"
 
 void LCManager::run()
 {
-    std::cout << "[LCManager::run] 디버그 루프 실행 준비\n";
-    this->startStatusPrintingLoop(); // 🔥 꼭 여기에 추가해야 함
+    std::cout << "[LCManager::run] 리액터 실행 준비\n";
 
-    // std::thread radarLoop([this]() {
-    //     // this->startRadarDebugLoop();
-    // });
-    // radarLoop.detach();
+    initLCStatus();
 
-    // std::thread lsLoop([this]() {
-    //     // this->startLSCommandLoop();
-    // });
-    // lsLoop.detach();
+    // 상태 주기적으로 받아오기 (MFR 주기는 표적 잠금 여부에 따라 setTargetLock에서 변경)
+    mfrPollTimer = reactor.addTimer(std::chrono::milliseconds(locked_target_id != 0 ? mfrLockedPollMs : mfrPollMs),
+                                    [this]()
+                                    { pollMFRStatus(); });
+    lsPollTimer = reactor.addTimer(std::chrono::milliseconds(lsPollMs), [this]()
+                                   { pollLSStatus(); });
+    if (mfrPollTimer == 0 || lsPollTimer == 0)
+    {
+        std::cerr << "[LCManager::run] 상태 폴링 타이머 등록 실패\n";
+    }
 
-    status.lc.LCId = 103001;
-    status.lc.position.x = 367080635;
-    status.lc.position.y = 1290083312;
+    // ECC 상태 푸시 (구독 전에는 아무것도 보내지 않음)
+    if (pushIntervalMs > 0 && reactor.addTimer(std::chrono::milliseconds(pushIntervalMs), [this]()
+                                               { pushStatus(); }) == 0)
+    {
+        std::cerr << "[LCManager::run] 상태 푸시 타이머 등록 실패\n";
+    }
 
-    // 상태 주기적으로 받아오기
-    std::thread statusLoop([this]()
-                           {
-        // mfr status get
-        while (true) {
-        {
-            std::vector<uint8_t> packet;
-            packet.push_back(0x11);          // commandType
-            packet.push_back(0x00);
-            packet.push_back(0x00);
-            packet.push_back(0x00);
-            packet.push_back(0x01);
-            mfrSender->sendRaw(packet); // status 명령
-        }
+    reactor.run(reactorCpu);
+}
 
-        {
-            std::vector<uint8_t> packet;
-            packet.push_back(0x34);          // commandType
-            packet.push_back(0x00);
-            packet.push_back(0x00);
-            packet.push_back(0x00);
-            packet.push_back(0x01);
-            serialLS->sendRaw(packet);
-        }
+void LCManager::initLCStatus()
+{
+    modifyStatus([](SystemStatus &s)
+                 {
+        s.lc.LCId = 103001;
+        s.lc.position.x = 367080635;
+        s.lc.position.y = 1290083312; });
+}
 
-        sleep(1);
-    } });
-    statusLoop.detach();
-    // TcpMFR 상태
-    // SerialLS 상태
+void LCManager::pollMFRStatus()
+{
+    if (mfrSender)
+    {
+        mfrSender->sendRaw(mfrStatusPoll); // status 명령 (0x11)
+    }
+}
+
+void LCManager::pollLSStatus()
+{
+    if (lsSender)
+    {
+        lsSender->sendRaw(lsStatusPoll); // status 명령 (0x34)
+    }
 }
 // for test
 //  void LCManager::startRadarDebugLoop() {
@@ -116,67 +120,55 @@ void LCManager::run()
 //     }
 // }
 
-SystemStatus LCManager::getStatusCopy() const
+StatusSnapshot LCManager::getStatusSnapshot() const
+{
+    return statusStore.snapshot();
+}
+
+void LCManager::modifyStatus(const std::function<void(SystemStatus &)> &func)
+{
+    statusStore.update(func);
+}
+
+uint64_t LCManager::clockUs() const
 {
-    std::lock_guard<std::mutex> lock(statusMutex);
-    return status;
+    return replayClockUs != 0 ? replayClockUs : trace::nowUs();
 }
 
-void LCManager::withLockedStatus(std::function<void(SystemStatus &)> func)
+void LCManager::extrapolateTargets(SystemStatus &status)
 {
-    std::lock_guard<std::mutex> lock(statusMutex);
-    func(status);
+    trackFilter.extrapolate(status, clockUs());
 }
 
 // UpdateStatus overloads
 void LCManager::updateStatus(const MFRStatus &mfr)
 {
-    withLockedStatus([&](SystemStatus &s)
+    modifyStatus([&](SystemStatus &s)
                      { s.mfr = mfr; });
 }
 
 void LCManager::updateStatus(const LSStatus &ls)
 {
-    withLockedStatus([&](SystemStatus &s)
+    modifyStatus([&](SystemStatus &s)
                      { s.ls = ls; });
 }
 
 void LCManager::updateStatus(const LCStatus &lc)
 {
-    withLockedStatus([&](SystemStatus &s)
+    modifyStatus([&](SystemStatus &s)
                      { s.lc = lc; });
 }
 
-void LCManager::updateStatus(const std::vector<MissileStatus> &missiles)
-{
-    withLockedStatus([&](SystemStatus &s)
-                     { s.missiles = missiles; });
-}
-
-void LCManager::updateStatus(const std::vector<TargetStatus> &targets)
-{
-    withLockedStatus([&](SystemStatus &s)
-                     { s.targets = targets; });
-}
-
 void LCManager::deleteTargetById(unsigned int targetId)
 {
-    withLockedStatus([&](SystemStatus &s)
-                     {
-        auto &targets = s.targets;
-        targets.erase(std::remove_if(targets.begin(), targets.end(),
-                                      [targetId](const TargetStatus &t) { return t.id == targetId; }),
-                      targets.end()); });
+    modifyStatus([&](SystemStatus &s)
+                     { s.targets.erase(targetId); });
 }
 
 void LCManager::deleteMissileById(unsigned int missileId)
 {
-    withLockedStatus([&](SystemStatus &s)
-                     {
-        auto &missiles = s.missiles;
-        missiles.erase(std::remove_if(missiles.begin(), missiles.end(),
-                                       [missileId](const MissileStatus &m) { return m.id == missileId; }),
-                       missiles.end()); });
+    modifyStatus([&](SystemStatus &s)
+                     { s.missiles.erase(missileId); });
 }
 
 void LCManager::onMessage(const Common::CommonMessage &msg)
@@ -184,6 +176,15 @@ void LCManager::onMessage(const Common::CommonMessage &msg)
     dispatch(msg);
 }
 
+void LCManager::onRawFrame(SenderType from, const uint8_t *data, size_t len)
+{
+    if (frameCapture.isOpen() && !frameCapture.append(from, data, len))
+    {
+        std::cerr << "[LCManager] 프레임 캡처 실패, 캡처 중단\n";
+        frameCapture.close();
+    }
+}
+
 void LCManager::dispatch(const Common::CommonMessage &msg)
 {
     using namespace Common;
@@ -197,10 +198,13 @@ void LCManager::dispatch(const Common::CommonMessage &msg)
         //   << ", OK=" << msg.ok << "\n";
     }
 
-    // if (!msg.ok) {
-    //     std::cerr << "[dispatch] ⚠️ 파싱 실패 or 포맷 이상\n";
-    //     return;
-    // }
+    // 길이가 모자란 프레임은 payload가 비어 있으므로 처리기(std::get)로 넘기지 않음
+    if (!msg.ok)
+    {
+        std::cerr << "[dispatch] 파싱 실패 또는 포맷 이상 (sender " << static_cast<int>(msg.sender)
+                  << ", cmd 0x" << std::hex << static_cast<int>(msg.commandType) << std::dec << ") 무시\n";
+        return;
+    }
 
     switch (msg.sender)
     {
@@ -221,15 +225,15 @@ void LCManager::dispatch(const Common::CommonMessage &msg)
 
 double LCManager::LaunchAngleCalc()
 {
-    SystemStatus snapshot = getStatusCopy();
-    if (snapshot.targets.empty())
+    StatusSnapshot snapshot = getStatusSnapshot();
+    if (snapshot->targets.empty())
         return -1;
 
-    const Pos2D &lsPos = snapshot.ls.position;
+    const Pos2D &lsPos = snapshot->ls.position;
 
     // posX/posY 직접 사용
-    double dx = static_cast<double>(snapshot.targets[0].posX - lsPos.x);
-    double dy = static_cast<double>(snapshot.targets[0].posY - lsPos.y);
+    double dx = static_cast<double>(snapshot->targets[0].posX - lsPos.x);
+    double dy = static_cast<double>(snapshot->targets[0].posY - lsPos.y);
     double angle = atan2(dy, dx) * 180.0 / M_PI;
 
     std::cout << "[LaunchAngleCalc] θ: " << angle << "도\n";
@@ -238,16 +242,16 @@ double LCManager::LaunchAngleCalc()
 
 double LCManager::DetectionAngleCalc()
 {
-    SystemStatus snapshot = getStatusCopy();
+    StatusSnapshot snapshot = getStatusSnapshot();
 
-    if (snapshot.targets.empty())
+    if (snapshot->targets.empty())
         return -1;
 
-    const Pos2D &radarPos = snapshot.mfr.position;
+    const Pos2D &radarPos = snapshot->mfr.position;
 
     // posX, posY 직접 접근
-    double dx = static_cast<double>(snapshot.targets[0].posX - radarPos.x);
-    double dy = static_cast<double>(snapshot.targets[0].posY - radarPos.y);
+    double dx = static_cast<double>(snapshot->targets[0].posX - radarPos.x);
+    double dy = static_cast<double>(snapshot->targets[0].posY - radarPos.y);
     double angle = atan2(dy, dx) * 180.0 / M_PI;
 
     std::cout << "[DetectionAngleCalc] θ: " << angle << "도\n";
@@ -259,7 +263,7 @@ void LCManager::sendStatus()
     static int sendCounter = 0;
     sendCounter++;
 
-    SystemStatus snapshot = getStatusCopy(); // 상태 스냅샷
+    StatusSnapshot snapshot = getStatusSnapshot(); // 상태 스냅샷
 
     if (sendCounter % 10 == 0)
     {
@@ -268,27 +272,27 @@ void LCManager::sendStatus()
         std::cout << std::dec;
 
         // // MFR 상태 출력
-        // std::cout << "- [MFR] ID: " << snapshot.mfr.mfrId
-        //           << ", Mode: " << static_cast<int>(snapshot.mfr.mode)
-        //           << ", Degree: " << snapshot.mfr.degree
-        //           << ", Detect Time : " << snapshot.mfr.detectTime
-        //           << ", Pos: (" << snapshot.mfr.position.x << ", " << snapshot.mfr.position.y
-        //           << ", " << snapshot.mfr.height << ")\n";
+        // std::cout << "- [MFR] ID: " << snapshot->mfr.mfrId
+        //           << ", Mode: " << static_cast<int>(snapshot->mfr.mode)
+        //           << ", Degree: " << snapshot->mfr.degree
+        //           << ", Detect Time : " << snapshot->mfr.detectTime
+        //           << ", Pos: (" << snapshot->mfr.position.x << ", " << snapshot->mfr.position.y
+        //           << ", " << snapshot->mfr.height << ")\n";
 
         // // LS 상태 출력
-        // std::cout << "- [LS] ID: " << snapshot.ls.launchSystemId
-        //           << ", Mode: " << static_cast<int>(snapshot.ls.mode)
-        //           << ", Angle: " << snapshot.ls.launchAngle
-        //           << ", Pos: (" << snapshot.ls.position.x << ", " << snapshot.ls.position.y
-        //           << ", " << snapshot.ls.height << ")\n";
+        // std::cout << "- [LS] ID: " << snapshot->ls.launchSystemId
+        //           << ", Mode: " << static_cast<int>(snapshot->ls.mode)
+        //           << ", Angle: " << snapshot->ls.launchAngle
+        //           << ", Pos: (" << snapshot->ls.position.x << ", " << snapshot->ls.position.y
+        //           << ", " << snapshot->ls.height << ")\n";
 
         // // LC 상태 출력
-        // std::cout << "- [LC] ID: " << snapshot.lc.LCId
-        //           << ", Pos: (" << snapshot.lc.position.x << ", " << snapshot.lc.position.y
-        //           << ", " << snapshot.lc.height << ")\n";
+        // std::cout << "- [LC] ID: " << snapshot->lc.LCId
+        //           << ", Pos: (" << snapshot->lc.position.x << ", " << snapshot->lc.position.y
+        //           << ", " << snapshot->lc.height << ")\n";
 
         // 타겟 정보출력
-        // for (const auto target : snapshot.targets)
+        // for (const auto target : snapshot->targets)
         // {
         //     std::cout << "- [Target] ID: " << target.id
         //               << ", Pos: (" << target.posX << ", " << target.posY
@@ -303,42 +307,99 @@ void LCManager::sendStatus()
     }
 
     // 직렬화 및 전송
-    std::vector<uint8_t> packet = Common::Serializer::serializeStatusResponse(snapshot);
-    for (const auto &m : snapshot.missiles)
+    // 버퍼는 리액터 스레드에서만 쓰므로 재사용 (크기가 커질 때만 재할당)
+    Common::Serializer::serializeStatusResponse(*snapshot, statusPacket, statusVersion);
+    removeHitEntries(*snapshot);
+
+    if (consoleSender)
+    {
+        consoleSender->sendRaw(statusPacket);
+
+        static auto &egress = trace::stage("lc.egress");
+        egress.recordSince(snapshot->trace);
+
+        // if (sendCounter % 10 == 0) {
+        //     std::cout << "[LCManager] ECC로 상태 메시지 전송 완료 (" << static_cast<int>(statusPacket.size()) << " 바이트)\n";
+        // }
+    }
+    else
+    {
+        std::cerr << "[LCManager] consoleSender가 연결되지 않았습니다.\n";
+    }
+}
+
+void LCManager::removeHitEntries(const SystemStatus &status)
+{
+    std::vector<unsigned int> hitIds;
+    for (const auto &m : status.missiles)
     {
         if (m.hit == true)
         {
-            deleteTargetById(m.id);
-            std::cout << "[LCManager] 미사일 ID " << m.id << "가 파괴되어 삭제되었습니다.\n";
+            hitIds.push_back(m.id);
+            asynclog::info("[LCManager] 미사일 ID {}가 파괴되어 삭제되었습니다.", m.id);
         }
     }
 
-    for (const auto &t : snapshot.targets)
+    for (const auto &t : status.targets)
     {
         if (t.hit == true)
         {
-            deleteTargetById(t.id);
-            std::cout << "[LCManager] 타겟 ID " << t.id << "가 파괴되어 삭제되었습니다.\n";
+            hitIds.push_back(t.id);
+            asynclog::info("[LCManager] 타겟 ID {}가 파괴되어 삭제되었습니다.", t.id);
         }
     }
 
-    if (consoleSender)
+    if (!hitIds.empty())
     {
-        consoleSender->sendRaw(packet);
+        modifyStatus([&](SystemStatus &s)
+                     {
+            for (unsigned int id : hitIds)
+            {
+                s.targets.erase(id);
+            } });
+    }
+}
 
-        // if (sendCounter % 10 == 0) {
-        //     std::cout << "[LCManager] ECC로 상태 메시지 전송 완료 (" << static_cast<int>(packet.size()) << " 바이트)\n";
-        // }
+void LCManager::onStatusSubscribe(const Common::StatusSubscribe &sub)
+{
+    if (sub.ackVersion == 0)
+    {
+        std::cout << "[LCManager] ECC 상태 푸시 구독/재동기 요청 → 다음 푸시는 키프레임\n";
     }
-    else
+    statusPush.acknowledge(sub.ackVersion);
+}
+
+void LCManager::pushStatus()
+{
+    if (!statusPush.subscribed() || !consoleSender)
     {
-        std::cerr << "[LCManager] consoleSender가 연결되지 않았습니다.\n";
+        return;
+    }
+
+    StatusSnapshot snapshot = getStatusSnapshot();
+    removeHitEntries(*snapshot);
+    const trace::Context statusTrace = snapshot->trace;
+    // 버퍼는 리액터 스레드에서만 쓰므로 폴링 응답과 공유
+    if (statusPush.encode(std::move(snapshot), statusPacket))
+    {
+        consoleSender->sendRaw(statusPacket);
+
+        static auto &egress = trace::stage("lc.egress");
+        egress.recordSince(statusTrace);
     }
 }
 
 void LCManager::setTargetLock(unsigned int targetId)
 {
+    const bool wasLocked = locked_target_id != 0;
     locked_target_id = targetId;
+
+    // 잠금 중에는 교전 시각 계산용으로 MFR 상태를 더 자주 받음
+    const bool locked = targetId != 0;
+    if (mfrPollTimer != 0 && locked != wasLocked)
+    {
+        reactor.setTimerPeriod(mfrPollTimer, std::chrono::milliseconds(locked ? mfrLockedPollMs : mfrPollMs));
+    }
 }
 
 void LCManager::getTargetLock(unsigned int &targetId) const
@@ -355,7 +416,7 @@ void LCManager::initialize(const std::string &iniPath)
         return;
     }
 
-    withLockedStatus([&](SystemStatus &s)
+    modifyStatus([&](SystemStatus &s)
                      {
         // [MFR]
         s.mfr.mfrId = reader.GetInteger("MFR", "mfrId", 0);
@@ -402,7 +463,7 @@ void LCManager::initialize(const std::string &iniPath)
             missile.detectTime = reader.GetLongLong("Missile", "predicted_time", 0);
             missile.interceptTime = reader.GetLongLong("Missile", "intercept_time", 0);
             missile.hit = reader.GetBoolean("Missile", "hit", false);
-            s.missiles.push_back(missile);
+            s.missiles.upsert(missile);
 
             std::cout << "[DEBUG][Missile] id=" << missile.id
                       << ", posX=" << missile.posX
@@ -432,7 +493,7 @@ void LCManager::initialize(const std::string &iniPath)
             target.priority = static_cast<uint8_t>(reader.GetInteger(section, "priority", 0));
             target.hit = reader.GetBoolean(section, "hit", false);
 
-            s.targets.push_back(target);
+            s.targets.upsert(target);
 
             std::cout << "[DEBUG][Target_" << i << "] id=" << target.id
                       << ", posX=" << target.posX
@@ -447,10 +508,47 @@ void LCManager::initialize(const std::string &iniPath)
         } });
 }
 
+void LCManager::applyConfig(const ConfigCommon &config)
+{
+    reactorCpu = config.ReactorCpu;
+    statusVersion = config.ECCStatusVersion;
+    pushIntervalMs = config.ECCPushIntervalMs;
+    mfrPollMs = config.MFRStatusPollMs;
+    mfrLockedPollMs = config.MFRLockedStatusPollMs;
+    lsPollMs = config.LSStatusPollMs;
+    if (!reactor.setTimerTick(std::chrono::milliseconds(config.ReactorTickMs)))
+    {
+        std::cerr << "[LCManager] 잘못된 타이머 tick: " << config.ReactorTickMs << "ms, 기본값 사용\n";
+    }
+    Common::MessageParser::setLogging(config.LogParser);
+    if (!config.LogFile.empty())
+    {
+        logger.startLogging(config.LogFile);
+    }
+    statusPush = StatusDeltaEncoder(config.ECCKeyframeInterval);
+
+    TrackFilter::Options track;
+    track.alpha = config.TrackAlpha;
+    track.beta = config.TrackBeta;
+    track.maxPredictSec = config.TrackMaxPredictMs / 1000.0;
+    track.resetSec = config.TrackResetMs / 1000.0;
+    trackFilter.setOptions(track);
+}
+
 void LCManager::init(const std::string &configPath, const std::string &ip, int port)
 {
     ConfigCommon config;
     loadConfig("./../Config/LC.ini", config);
+    applyConfig(config);
+
+    if (!config.CaptureDir.empty())
+    {
+        const size_t segmentBytes = static_cast<size_t>(std::max(config.CaptureSegmentMB, 1)) * 1024 * 1024;
+        if (frameCapture.open(config.CaptureDir, segmentBytes))
+        {
+            std::cout << "[LCManager] 수신 프레임 캡처: " << frameCapture.sessionDir() << "\n";
+        }
+    }
 
     // 설정 파일 초기화 (필요 시 활성화)
     // initialize(configPath);
@@ -460,21 +558,99 @@ void LCManager::init(const std::string &configPath, const std::string &ip, int p
     std::cout<<config.ECCRecvIP <<"," << config.ECCRecvPort<<"\n";
     ecc->setCallback(this);
     setConsoleSender(ecc);
-    ecc->start();
+    ecc->start(reactor);
 
     // ✅ MFR 연결 (ECC와 동일한 구조)
     auto mfr = std::make_shared<TcpMFR>(config.MFRRecvIP, config.MFRRecvPort);
     mfr->setCallback(this);
     setMFRSender(mfr);
-    mfr->start();
+    mfr->start(reactor);
 
     // ✅ LS 연결 (Serial UDP 방식)
-    serialLS = std::make_shared<SerialLS>(
+    auto ls = std::make_shared<SerialLS>(
         /* localPort */ config.LSRecvPort,
         /* lcIp */ config.LSSendIP,
         /* lcPort */ config.LSSendPort);
-    serialLS->setCallback(this);
-    serialLS->start();
+    ls->setCallback(this);
+    setLSSender(ls);
+    ls->start(reactor);
+}
+
+namespace
+{
+    // 재생 중 송신은 보내지 않고 개수만 셈
+    class DiscardSender : public IStatusSender
+    {
+    public:
+        void sendStatus(const Common::CommonMessage &) override { ++packets; }
+        void sendRaw(const std::vector<uint8_t> &data) override
+        {
+            ++packets;
+            bytes += data.size();
+        }
+
+        uint64_t packets = 0;
+        uint64_t bytes = 0;
+    };
+}
+
+bool LCManager::replay(const std::string &sessionDir, double speed)
+{
+    ConfigCommon config;
+    loadConfig("./../Config/LC.ini", config);
+    applyConfig(config);
+    initLCStatus();
+
+    auto ecc = std::make_shared<DiscardSender>();
+    auto mfr = std::make_shared<DiscardSender>();
+    auto ls = std::make_shared<DiscardSender>();
+    setConsoleSender(ecc);
+    setMFRSender(mfr);
+    setLSSender(ls);
+
+    // 실제 수신 경로와 같이 송신자(연결)마다 파서 하나 (0x24 키프레임 캐시가 송신자별)
+    Common::MessageParser eccParser, mfrParser, lsParser;
+    uint64_t parseErrors = 0;
+
+    capture::ReplayStats stats;
+    const bool ok = capture::replay(sessionDir, speed, [&](const capture::Frame &frame)
+                                    {
+        Common::MessageParser &parser = frame.sender == SenderType::ECC   ? eccParser
+                                        : frame.sender == SenderType::MFR ? mfrParser
+                                                                          : lsParser;
+        // 속도와 관계없이 같은 결과가 나오도록 추적 필터는 녹화 시각으로 진행
+        replayClockUs = std::max<uint64_t>(frame.monoNs / 1000, 1);
+        try
+        {
+            onMessage(parser.parse(Common::ByteSpan(frame.data, frame.size), frame.sender));
+        }
+        catch (const std::exception &)
+        {
+            ++parseErrors;
+        } }, stats);
+    replayClockUs = 0;
+    if (!ok && !stats.corrupt)
+    {
+        return false;
+    }
+
+    const double wallMs = stats.wallNs / 1e6;
+    std::cout << "[LCManager::replay] " << sessionDir << "\n"
+              << "  프레임 " << stats.frames << "개 (" << stats.bytes << " byte), 파싱 예외 " << parseErrors << "건\n"
+              << "  녹화 " << stats.recordedNs / 1e6 << "ms / 재생 " << wallMs << "ms"
+              << " (" << (wallMs > 0 ? stats.frames / (wallMs / 1000.0) : 0.0) << " frame/s)\n"
+              << "  송신 ECC " << ecc->packets << "건 " << ecc->bytes << " byte, MFR " << mfr->packets
+              << "건, LS " << ls->packets << "건\n";
+    if (speed > 0)
+    {
+        std::cout << "  예정 시각 대비 최대 지연 " << stats.maxLagNs / 1e6 << "ms\n";
+    }
+    if (stats.corrupt)
+    {
+        std::cerr << "[LCManager::replay] 손상된 레코드에서 중단 (segment " << stats.corruptSegment << ", offset "
+                  << stats.corruptOffset << "), 이후 프레임은 재생되지 않음\n";
+    }
+    return ok;
 }
 
 long long LCManager::squaredDistance(const Pos2D &a, const Pos2D &b)
@@ -491,19 +667,15 @@ double LCManager::calculateDetectionAngle(const Pos2D &from, const Pos2D &to)
     return atan2(dy, dx) * 180.0 / M_PI;
 }
 
-TargetStatus *LCManager::findTargetById(std::vector<TargetStatus> &targets, unsigned int id)
+TargetStatus *LCManager::findTargetById(IdSlotMap<TargetStatus> &targets, unsigned int id)
 {
-    for (auto &t : targets)
-    {
-        if (t.id == id)
-            return &t;
-    }
-    return nullptr;
+    return targets.find(id);
 }
 
 void LCManager::updateCalTime(const unsigned long long &calTime)
 {
-    status.lc.calculated_time = calTime;
+    modifyStatus([&](SystemStatus &s)
+                 { s.lc.calculated_time = calTime; });
 }
 
 void LCManager::printStatus(const SystemStatus &status)
@@ -575,36 +747,79 @@ void LCManager::onRadarStatusReceived(const Common::RadarStatus &r)
 
 void LCManager::onRadarDetectionReceived(const Common::RadarDetection &d)
 {
-    std::vector<TargetStatus> targets;
+    static auto &ingress = trace::stage("lc.ingress");
+    ingress.recordSince(d.trace);
+
     bool lockedTargetFound = false;
-    for (const auto &t : d.targets)
-    {
-        TargetStatus ts;
-        ts.id = t.id;
-        ts.angle1 = t.angle1;
-        ts.angle2 = t.angle2;
-        ts.posX = t.posX;
-        ts.posY = t.posY;
-        ts.altitude = t.altitude;
-        ts.speed = t.speed;
-        ts.detectTime = t.detectTime;
-        ts.priority = t.priority;
-        ts.hit = t.hit;
-        targets.push_back(ts);
-        if (t.id == locked_target_id)
+    size_t targetCount = 0;
+    // 트랙 시각은 LC 시계(수신 시각, 재생 중에는 녹화 수신 시각)로 외삽 기준과 맞춤
+    // 시뮬레이터 발생 시각(trace)은 다른 호스트 시계이므로 재보고 판별과 샘플 간격에만 사용
+    const uint64_t receivedUs = clockUs();
+
+    // 한 번의 발행으로 반영: 보고에 있는 항목은 제자리 갱신, 없는 항목은 sweep으로 삭제
+    modifyStatus([&](SystemStatus &s)
+                 {
+        if (d.trace)
         {
-            lockedTargetFound = true; // 현재 잠금된 타겟이 탐지됨
+            s.trace = d.trace;
         }
-        // std::cout << "[MFR] 타겟 정보: ID=" << ts.id
-        //           << ", Pos=(" << ts.posX << ", " << ts.posY << ")"
-        //           << ", Altitude=" << ts.altitude
-        //           << ", Speed=" << ts.speed
-        //           << ", Angle1=" << ts.angle1
-        //           << ", Angle2=" << ts.angle2
-        //           << ", DetectTime=" << ts.detectTime
-        //           << ", Priority=" << static_cast<int>(ts.priority)
-        //           << ", Hit=" << static_cast<int>(ts.hit) << "\n";
-    }
+        s.targets.beginSweep();
+        trackFilter.beginReport();
+        for (const auto &t : d.targets)
+        {
+            TargetStatus ts;
+            ts.id = t.id;
+            ts.angle1 = t.angle1;
+            ts.angle2 = t.angle2;
+            ts.posX = t.posX;
+            ts.posY = t.posY;
+            ts.altitude = t.altitude;
+            ts.speed = t.speed;
+            ts.detectTime = t.detectTime;
+            ts.priority = t.priority;
+            ts.hit = t.hit;
+            s.targets.upsert(ts);
+            if (d.trace)
+            {
+                trackFilter.update(ts, receivedUs, d.trace.originUs);
+            }
+            else
+            {
+                trackFilter.updateReceived(ts, receivedUs);
+            }
+            if (t.id == locked_target_id)
+            {
+                lockedTargetFound = true; // 현재 잠금된 타겟이 탐지됨
+            }
+            // std::cout << "[MFR] 타겟 정보: ID=" << ts.id
+            //           << ", Pos=(" << ts.posX << ", " << ts.posY << ")"
+            //           << ", Altitude=" << ts.altitude
+            //           << ", Speed=" << ts.speed
+            //           << ", Angle1=" << ts.angle1
+            //           << ", Angle2=" << ts.angle2
+            //           << ", DetectTime=" << ts.detectTime
+            //           << ", Priority=" << static_cast<int>(ts.priority)
+            //           << ", Hit=" << static_cast<int>(ts.hit) << "\n";
+        }
+        s.targets.endSweep();
+        trackFilter.endReport();
+        targetCount = s.targets.size();
+
+        s.missiles.beginSweep();
+        for (const auto &m : d.missiles)
+        {
+            MissileStatus ms{};
+            ms.id = m.id; // struct에 정의된 필드 사용
+            ms.posX = m.posX;
+            ms.posY = m.posY;
+            ms.altitude = m.altitude;
+            ms.speed = m.speed;
+            ms.angle = m.angle;
+            ms.interceptTime = m.detectTime;
+            ms.hit = m.hit;
+            s.missiles.upsert(ms);
+        }
+        s.missiles.endSweep(); });
     /*if (lockedTargetFound == false)
     {
         // 현재 잠금된 타겟이 탐지되지 않은 경우, 잠금 해제
@@ -625,27 +840,10 @@ void LCManager::onRadarDetectionReceived(const Common::RadarDetection &d)
         locked_target_id = 0;
     }
         */
-    updateStatus(targets);
-    std::cout << "[MFR] 타겟 정보 갱신 완료 (총 " << targets.size() << "개)\n";
+    asynclog::info("[MFR] 타겟 정보 갱신 완료 (총 {}개)", targetCount);
 
     // 이후에 hit처리 로그 삭제
 
-    std::vector<MissileStatus> missiles;
-    for (const auto &m : d.missiles)
-    {
-        MissileStatus ms;
-        ms.id = m.id; // struct에 정의된 필드 사용
-        ms.posX = m.posX;
-        ms.posY = m.posY;
-        ms.altitude = m.altitude;
-        ms.speed = m.speed;
-        ms.angle = m.angle;
-        ms.interceptTime = m.detectTime;
-        ms.hit = m.hit;
-        missiles.push_back(ms);
-    }
-    updateStatus(missiles);
-
     static int detectionCounter = 0;
     detectionCounter++;
 
@@ -680,15 +878,20 @@ void LCManager::setMFRSender(std::shared_ptr<IStatusSender> sender)
     mfrSender = std::move(sender);
 }
 
+void LCManager::setLSSender(std::shared_ptr<IStatusSender> sender)
+{
+    lsSender = std::move(sender);
+}
+
 void LCManager::sendToLS(const std::vector<uint8_t> &packet)
 {
-    if (serialLS)
+    if (lsSender)
     {
-        serialLS->sendRaw(packet);
+        lsSender->sendRaw(packet);
     }
     else
     {
-        std::cerr << "[LCManager] LS 송신자(serialLS)가 설정되지 않았습니다. 전송 실패.\n";
+        std::cerr << "[LCManager] LS 송신자(lsSender)가 설정되지 않았습니다. 전송 실패.\n";
     }
 }
 
@@ -720,7 +923,7 @@ void LCManager::sendToMFR(const std::vector<uint8_t> &packet)
     if (mfrSender)
     {
         mfrSender->sendRaw(packet);
-        std::cout << "[LCManager] MFR로 " << packet.size() << "바이트 전송 완료.\n";
+        asynclog::info("[LCManager] MFR로 {}바이트 전송 완료.", packet.size());
     }
     else
     {
@@ -730,17 +933,17 @@ void LCManager::sendToMFR(const std::vector<uint8_t> &packet)
 
 bool LCManager::hasLSSender() const
 {
-    return static_cast<bool>(serialLS);
+    return static_cast<bool>(lsSender);
 }
 
 void LCManager::onLCPositionRequest()
 {
-    SystemStatus snapshot = getStatusCopy();
+    StatusSnapshot snapshot = getStatusSnapshot();
     Common::LCPositionResponse res{
-        .radarId = snapshot.mfr.mfrId,
-        .posX = snapshot.lc.position.x,
-        .posY = snapshot.lc.position.y,
-        .height = snapshot.lc.height // ✅ height 필드 추가
+        .radarId = snapshot->mfr.mfrId,
+        .posX = snapshot->lc.position.x,
+        .posY = snapshot->lc.position.y,
+        .height = snapshot->lc.height // ✅ height 필드 추가
     };
     auto packet = Common::Serializer::serializeLCPositionResponse(res);
     sendToMFR(packet);
@@ -779,67 +982,35 @@ void LCManager::onLSStatusReceived(const Common::LSReport &ls)
     // }
 }
 
-// *******************FOR TEST
-void LCManager::startLSCommandLoop()
-{
-    std::cout << "[LS] Serial 포트 수신만 실행 중... 종료하려면 Ctrl+C\n";
-
-    if (serialLS)
-    {
-        serialLS->start(); // 내부 receiveLoop() 실행됨
-    }
-    else
-    {
-        std::cerr << "[LS] serialLS 인스턴스가 설정되지 않았습니다.\n";
-    }
-
-    // 아무 일도 하지 않음. 단순히 스레드가 돌아가게 유지
-    while (true)
-    {
-        std::this_thread::sleep_for(std::chrono::seconds(1));
-    }
-}
-
-void LCManager::startStatusPrintingLoop()
-{
-    std::thread([this]()
-                {
-        while (true) {
-            //this->printStatus();  // 현재 위치 상태 출력
-            std::this_thread::sleep_for(std::chrono::seconds(1));
-        } })
-        .detach();
-}
-
 void LCManager::printStatus() const
 {
-    SystemStatus snapshot = getStatusCopy(); // thread-safe하게 복사
+    StatusSnapshot snapshot = getStatusSnapshot(); // 잠금/복사 없는 스냅샷
     std::cout << std::dec;
     std::cout << "\n\n";
     std::cout << "----| Launch System (LS)\n";
-    std::cout << "  - ID: " << snapshot.ls.launchSystemId << "\n";
-    std::cout << "  - Pos: (" << snapshot.ls.position.x << ", " << snapshot.ls.position.y << ")\n";
-    std::cout << "  - Altitude: " << snapshot.ls.height << "\n";
-    std::cout << "  - Mode: " << static_cast<int>(snapshot.ls.mode) << "\n";
-    std::cout << "  - LaunchAngle: " << snapshot.ls.launchAngle << "\n";
+    std::cout << "  - ID: " << snapshot->ls.launchSystemId << "\n";
+    std::cout << "  - Pos: (" << snapshot->ls.position.x << ", " << snapshot->ls.position.y << ")\n";
+    std::cout << "  - Altitude: " << snapshot->ls.height << "\n";
+    std::cout << "  - Mode: " << static_cast<int>(snapshot->ls.mode) << "\n";
+    std::cout << "  - LaunchAngle: " << snapshot->ls.launchAngle << "\n";
 
     std::cout << std::dec;
     std::cout << "----| Radar (MFR)\n";
-    std::cout << "  - ID: " << snapshot.mfr.mfrId << "\n";
-    std::cout << "  - Pos: (" << snapshot.mfr.position.x << ", " << snapshot.mfr.position.y << ")\n";
-    std::cout << "  - Altitude: " << snapshot.mfr.height << "\n";
-    std::cout << "  - Mode: " << static_cast<int>(snapshot.mfr.mode) << "\n";
-    std::cout << "  - Degree: " << snapshot.mfr.degree << "\n";
+    std::cout << "  - ID: " << snapshot->mfr.mfrId << "\n";
+    std::cout << "  - Pos: (" << snapshot->mfr.position.x << ", " << snapshot->mfr.position.y << ")\n";
+    std::cout << "  - Altitude: " << snapshot->mfr.height << "\n";
+    std::cout << "  - Mode: " << static_cast<int>(snapshot->mfr.mode) << "\n";
+    std::cout << "  - Degree: " << snapshot->mfr.degree << "\n";
 
     std::cout << std::dec;
     std::cout << "----| Launcher Controller (LC)\n";
-    std::cout << "  - ID: " << snapshot.lc.LCId << "\n";
-    std::cout << "  - Pos: (" << snapshot.lc.position.x << ", " << snapshot.lc.position.y << ")\n";
-    std::cout << "  - Height: " << snapshot.lc.height << "\n";
+    std::cout << "  - ID: " << snapshot->lc.LCId << "\n";
+    std::cout << "  - Pos: (" << snapshot->lc.position.x << ", " << snapshot->lc.position.y << ")\n";
+    std::cout << "  - Height: " << snapshot->lc.height << "\n";
 
-    std::cout << "----| Missile List (" << snapshot.missiles.size() << "개)\n";
+    std::cout << "----| Missile List (" << snapshot->missiles.size() << "개)\n";
     std::cout << std::dec;
-    for (const auto &m : snapshot.missiles)
+    for (const auto &m : snapshot->missiles)
     {
         std::cout << "  - ID: " << m.id
                   << ", Pos: (" << m.posX << ", " << m.posY << ")"
@@ -851,8 +1022,8 @@ void LCManager::printStatus() const
     }
 
     std::cout << std::dec;
-    std::cout << "----| Target List (" << snapshot.targets.size() << "개)\n";
-    for (const auto &t : snapshot.targets)
+    std::cout << "----| Target List (" << snapshot->targets.size() << "개)\n";
+    for (const auto &t : snapshot->targets)
     {
         std::cout << "  - ID: " << t.id
                   << ", Pos: (" << t.posX << ", " << t.posY << ")"
@@ -14,19 +14,69 @@
 #include <vector>
 #include "SerialLS.h"
 #include "timeTrans.h"
+#include "Reactor.h"
+#include "StatusStore.h"
+#include "StatusDeltaEncoder.h"
+#include "lc_logger.h"
+#include "FrameCapture.h"
+#include "TrackFilter.h"
+
+struct ConfigCommon;
+
 class LCManager : public IReceiverCallback
 {
 private:
-    SystemStatus status;
-    mutable std::mutex statusMutex;
+    // 잠금 없는 읽기용 버전 관리 상태 저장소
+    StatusStore statusStore;
     std::shared_ptr<IStatusSender> consoleSender;
     std::shared_ptr<IStatusSender> mfrSender;
-    // 수정필요
-    std::shared_ptr<SerialLS> serialLS;
+    std::shared_ptr<IStatusSender> lsSender;
 
     unsigned int locked_target_id = 0; // 현재 잠금된 표적 ID
+
+    // 모든 송수신 소켓과 주기 작업을 처리하는 리액터
+    Reactor reactor;
+    int reactorCpu = -1;
+
+    // ECC 상태 응답 (포맷 버전, 재사용 송신 버퍼)
+    int statusVersion = 1;
+    std::vector<uint8_t> statusPacket;
+
+    // 하위 체계 상태 폴링 (리액터 타이머 휠 작업, 패킷은 미리 만들어 재사용)
+    int mfrPollMs = 1000;
+    int mfrLockedPollMs = 100; // 표적 잠금 중
+    int lsPollMs = 1000;
+    Reactor::TimerId mfrPollTimer = 0;
+    Reactor::TimerId lsPollTimer = 0;
+    const std::vector<uint8_t> mfrStatusPoll{0x11, 0x00, 0x00, 0x00, 0x01};
+    const std::vector<uint8_t> lsStatusPoll{0x34, 0x00, 0x00, 0x00, 0x01};
+
+    // ECC 상태 푸시 (0x06 구독 시 pushIntervalMs마다 0x57 변경분 전송)
+    int pushIntervalMs = 0;
+    StatusDeltaEncoder statusPush;
+
+    LcLogger logger;
+
+    // 수신 프레임 캡처 (LC.ini [Capture] Dir, 리액터 스레드에서만 기록)
+    capture::FrameWriter frameCapture;
+
+    // MFR 보고 사이 표적 위치 외삽 (탐지 보고마다 갱신, 리액터 스레드 전용)
+    TrackFilter trackFilter;
+
+    // 재생 중이면 지금 처리하는 프레임의 녹화 수신 시각 (us, CLOCK_MONOTONIC 기준), 아니면 0
+    uint64_t replayClockUs = 0;
+    // 추적 필터/외삽 기준 시각: 실행 중에는 system_clock, 재생 중에는 녹화 시각
+    uint64_t clockUs() const;
+
+    void applyConfig(const ConfigCommon &config);
+    void initLCStatus();
+    void pollMFRStatus();
+    void pollLSStatus();
+    void pushStatus();
+    // 격추된 미사일/표적을 한 번의 발행으로 삭제
+    void removeHitEntries(const SystemStatus &status);
 public:
-    // 실행
+    // 실행 (호출한 스레드에서 리액터 루프, 반환하지 않음)
     void run();
     // void startRadarDebugLoop();
     void onLCPositionRequest();
@@ -36,11 +86,16 @@ public:
     void onRadarStatusReceived(const Common::RadarStatus &msg);
     void onRadarDetectionReceived(const Common::RadarDetection &msg);
     void onMessage(const Common::CommonMessage &msg) override;
+    void onRawFrame(SenderType from, const uint8_t *data, size_t len) override;
 
     // 초기화
     void init(const std::string &configPath, const std::string &ip, int port);
     void initialize(const std::string &iniPath);
 
+    // 캡처 세션을 onMessage로 재생 (소켓/리액터 없이, 송신은 버림, 주기 작업은 돌지 않음)
+    // speed: 배속 (0 이하면 최대 속도)
+    bool replay(const std::string &sessionDir, double speed);
+
     // 메시지 처리
     void dispatch(const Common::CommonMessage &msg);
     void handleECCCommand(const Common::CommonMessage &msg); // ✅ 추가
@@ -49,10 +104,13 @@ public:
     // 송신자 등록
     void setConsoleSender(std::shared_ptr<IStatusSender> sender);
     void setMFRSender(std::shared_ptr<IStatusSender> sender);
+    void setLSSender(std::shared_ptr<IStatusSender> sender);
 
     // 상태 접근
-    void withLockedStatus(std::function<void(SystemStatus &)> func);
-    SystemStatus getStatusCopy() const;
+    void modifyStatus(const std::function<void(SystemStatus &)> &func);
+    StatusSnapshot getStatusSnapshot() const;
+    // 표적 위치를 추적 필터로 현재 시각까지 외삽 (마지막 MFR 보고 이후 이동분 반영)
+    void extrapolateTargets(SystemStatus &status);
     bool hasLSSender() const;
     void sendToLS(const std::vector<uint8_t> &packet);
     bool hasConsoleSender() const;
@@ -60,14 +118,12 @@ public:
 
     // 상태 출력 및 전송
     void sendStatus();
+    void onStatusSubscribe(const Common::StatusSubscribe &sub);
     void printStatus(const SystemStatus &status);
-    void startLSCommandLoop();
     // 상태 업데이트
     void updateStatus(const MFRStatus &mfr);
     void updateStatus(const LSStatus &ls);
     void updateStatus(const LCStatus &lc);
-    void updateStatus(const std::vector<MissileStatus> &missiles);
-    void updateStatus(const std::vector<TargetStatus> &targets);
     void updateCalTime(const unsigned long long &calTime);
     void sendLCPositionToMFR();
     void onLSStatusReceived(const Common::LSReport &ls);
@@ -78,7 +134,7 @@ public:
 
     // 유틸
     long long squaredDistance(const Pos2D &a, const Pos2D &b);
-    TargetStatus *findTargetById(std::vector<TargetStatus> &targets, unsigned int id);
+    TargetStatus *findTargetById(IdSlotMap<TargetStatus> &targets, unsigned int id);
     double calculateDetectionAngle(const Pos2D &from, const Pos2D &to);
     double LaunchAngleCalc();
     double DetectionAngleCalc();
@@ -88,8 +144,6 @@ public:
     bool hasMFRSender() const;
     void sendToMFR(const std::vector<uint8_t> &packet);
 
-    void startStatusPrintingLoop();
-
     void setTargetLock(unsigned int targetId);
     void getTargetLock(unsigned int &targetId) const;
 
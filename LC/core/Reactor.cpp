@@ -0,0 +1,303 @@
+#include "Reactor.h"
+
+#include <iostream>
+#include <cerrno>
+#include <cstring>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+namespace
+{
+    constexpr int MAX_EVENTS = 64;
+
+    uint64_t makeToken(int fd, uint32_t generation)
+    {
+        return (static_cast<uint64_t>(generation) << 32) | static_cast<uint32_t>(fd);
+    }
+}
+
+Reactor::Reactor()
+{
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ < 0)
+    {
+        perror("[Reactor] epoll_create1");
+        return;
+    }
+
+    wakeFd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (wakeFd_ < 0)
+    {
+        perror("[Reactor] eventfd");
+        return;
+    }
+
+    epoll_event ev{};
+    ev.events = EPOLLIN;
+    ev.data.u64 = makeToken(wakeFd_, 0);
+    epoll_ctl(epollFd_, EPOLL_CTL_ADD, wakeFd_, &ev);
+}
+
+Reactor::~Reactor()
+{
+    if (tickFd_ >= 0)
+    {
+        close(tickFd_);
+    }
+    if (wakeFd_ >= 0)
+    {
+        close(wakeFd_);
+    }
+    if (epollFd_ >= 0)
+    {
+        close(epollFd_);
+    }
+}
+
+bool Reactor::add(int fd, uint32_t events, Handler handler)
+{
+    if (epollFd_ < 0 || fd < 0)
+    {
+        return false;
+    }
+
+    auto entry = std::make_shared<Entry>();
+    entry->generation = nextGeneration_++;
+    if (nextGeneration_ == 0)
+    {
+        nextGeneration_ = 1; // 0은 wakeFd_ 전용
+    }
+    entry->handler = std::move(handler);
+
+    epoll_event ev{};
+    ev.events = events;
+    ev.data.u64 = makeToken(fd, entry->generation);
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, fd, &ev) < 0)
+    {
+        std::cerr << "[Reactor] epoll_ctl ADD 실패 (fd=" << fd << "): " << strerror(errno) << "\n";
+        return false;
+    }
+
+    entries_[fd] = std::move(entry);
+    return true;
+}
+
+bool Reactor::modify(int fd, uint32_t events)
+{
+    auto it = entries_.find(fd);
+    if (it == entries_.end())
+    {
+        return false;
+    }
+
+    epoll_event ev{};
+    ev.events = events;
+    ev.data.u64 = makeToken(fd, it->second->generation);
+    if (epoll_ctl(epollFd_, EPOLL_CTL_MOD, fd, &ev) < 0)
+    {
+        std::cerr << "[Reactor] epoll_ctl MOD 실패 (fd=" << fd << "): " << strerror(errno) << "\n";
+        return false;
+    }
+    return true;
+}
+
+void Reactor::remove(int fd)
+{
+    if (entries_.erase(fd) > 0)
+    {
+        epoll_ctl(epollFd_, EPOLL_CTL_DEL, fd, nullptr);
+    }
+}
+
+bool Reactor::setTimerTick(std::chrono::milliseconds tick)
+{
+    if (tick.count() <= 0 || tickFd_ >= 0)
+    {
+        return false;
+    }
+    tick_ = tick;
+    return true;
+}
+
+Reactor::TimerId Reactor::addTimer(std::chrono::milliseconds period, TimerCallback callback)
+{
+    if (!ensureTickTimer())
+    {
+        return 0;
+    }
+    return wheel_.add(toTicks(period), std::move(callback), currentTick());
+}
+
+bool Reactor::removeTimer(TimerId id)
+{
+    return wheel_.remove(id);
+}
+
+bool Reactor::setTimerPeriod(TimerId id, std::chrono::milliseconds period)
+{
+    return wheel_.setPeriod(id, toTicks(period), currentTick());
+}
+
+bool Reactor::ensureTickTimer()
+{
+    if (tickFd_ >= 0)
+    {
+        return true;
+    }
+
+    const int fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd < 0)
+    {
+        perror("[Reactor] timerfd_create");
+        return false;
+    }
+
+    // steady_clock == CLOCK_MONOTONIC, 기준 시각에 정렬된 절대 시각으로 tick 발생
+    tickBase_ = std::chrono::steady_clock::now();
+    const auto first = std::chrono::duration_cast<std::chrono::nanoseconds>((tickBase_ + tick_).time_since_epoch());
+    const auto interval = std::chrono::duration_cast<std::chrono::nanoseconds>(tick_);
+
+    itimerspec spec{};
+    spec.it_value.tv_sec = first.count() / 1000000000LL;
+    spec.it_value.tv_nsec = first.count() % 1000000000LL;
+    spec.it_interval.tv_sec = interval.count() / 1000000000LL;
+    spec.it_interval.tv_nsec = interval.count() % 1000000000LL;
+    if (timerfd_settime(fd, TFD_TIMER_ABSTIME, &spec, nullptr) < 0)
+    {
+        perror("[Reactor] timerfd_settime");
+        close(fd);
+        return false;
+    }
+
+    if (!add(fd, EPOLLIN, [this](uint32_t)
+             { onTick(); }))
+    {
+        close(fd);
+        return false;
+    }
+
+    tickFd_ = fd;
+    return true;
+}
+
+uint64_t Reactor::currentTick() const
+{
+    if (tickFd_ < 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>((std::chrono::steady_clock::now() - tickBase_) / tick_);
+}
+
+uint64_t Reactor::toTicks(std::chrono::milliseconds period) const
+{
+    return TimerWheel::toTicks(period, tick_);
+}
+
+void Reactor::onTick()
+{
+    // 만료 횟수는 쓰지 않음: 기준 시각으로부터의 경과 tick으로 진행해야 핸들러 지연이 있어도 어긋나지 않음
+    uint64_t expirations;
+    if (read(tickFd_, &expirations, sizeof(expirations)) <= 0)
+    {
+        return;
+    }
+    wheel_.advance(currentTick());
+    missedTicks_.store(wheel_.missed(), std::memory_order_relaxed);
+}
+
+void Reactor::run(int cpu)
+{
+    if (epollFd_ < 0)
+    {
+        return;
+    }
+
+    if (cpu >= 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        {
+            std::cerr << "[Reactor] CPU " << cpu << " 고정 실패\n";
+        }
+    }
+
+    running_ = true;
+    epoll_event events[MAX_EVENTS];
+
+    while (running_)
+    {
+        const int n = epoll_wait(epollFd_, events, MAX_EVENTS, -1);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            perror("[Reactor] epoll_wait");
+            break;
+        }
+
+        for (int i = 0; i < n && running_; ++i)
+        {
+            dispatch(events[i].data.u64, events[i].events);
+        }
+    }
+
+    running_ = false;
+}
+
+void Reactor::stop()
+{
+    running_ = false;
+    if (wakeFd_ >= 0)
+    {
+        const uint64_t one = 1;
+        (void)!write(wakeFd_, &one, sizeof(one));
+    }
+}
+
+Reactor::Stats Reactor::stats() const
+{
+    return Stats{events_.load(std::memory_order_relaxed), maxHandlerUs_.load(std::memory_order_relaxed),
+                 missedTicks_.load(std::memory_order_relaxed)};
+}
+
+void Reactor::dispatch(uint64_t token, uint32_t events)
+{
+    const int fd = static_cast<int>(token & 0xFFFFFFFFu);
+    const uint32_t generation = static_cast<uint32_t>(token >> 32);
+
+    if (generation == 0)
+    {
+        uint64_t value;
+        (void)!read(wakeFd_, &value, sizeof(value));
+        return;
+    }
+
+    auto it = entries_.find(fd);
+    if (it == entries_.end() || it->second->generation != generation)
+    {
+        return; // 같은 배치 안에서 먼저 처리된 핸들러가 해제/재등록한 fd
+    }
+
+    // 핸들러가 자기 자신을 remove해도 안전하도록 참조 유지
+    std::shared_ptr<Entry> entry = it->second;
+
+    const auto begin = std::chrono::steady_clock::now();
+    entry->handler(events);
+    const auto elapsedUs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count());
+
+    events_.fetch_add(1, std::memory_order_relaxed);
+    if (elapsedUs > maxHandlerUs_.load(std::memory_order_relaxed))
+    {
+        maxHandlerUs_.store(elapsedUs, std::memory_order_relaxed);
+    }
+}
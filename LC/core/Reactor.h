@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "TimerWheel.h"
+
+// epoll 단일 리액터: LC의 소켓(ECC/MFR TCP, LS UDP)과 주기 타이머를 한 스레드에서 처리
+// add/remove/타이머 함수는 run() 전이나 리액터 스레드(핸들러 안)에서만 호출한다. stop()만 다른 스레드에서 호출 가능.
+// 주기 작업은 timerfd 하나로 구동하는 타이머 휠에서 처리 (작업 수와 무관하게 fd 1개)
+class Reactor
+{
+public:
+    using Handler = std::function<void(uint32_t events)>;
+    using TimerCallback = TimerWheel::Callback;
+    using TimerId = TimerWheel::TimerId;
+
+    struct Stats
+    {
+        uint64_t events;       // 처리한 이벤트 수
+        uint64_t maxHandlerUs; // 가장 오래 걸린 핸들러 (us)
+        uint64_t missedTicks;  // 주기 작업이 밀려 건너뛴 실행 수
+    };
+
+    Reactor();
+    ~Reactor();
+
+    Reactor(const Reactor &) = delete;
+    Reactor &operator=(const Reactor &) = delete;
+
+    // level-triggered 등록 (events: EPOLLIN 등)
+    bool add(int fd, uint32_t events, Handler handler);
+    // 등록된 fd의 관심 이벤트 변경 (송신 대기 시 EPOLLOUT 켜고 끄기)
+    bool modify(int fd, uint32_t events);
+    // 등록 해제만 하고 fd는 닫지 않음
+    void remove(int fd);
+
+    // 타이머 휠 tick 간격 (주기는 tick 배수로 올림). 타이머 등록 전에만 변경 가능
+    bool setTimerTick(std::chrono::milliseconds tick);
+
+    // 주기 작업 등록, 실패 시 0. 첫 실행은 period 뒤
+    TimerId addTimer(std::chrono::milliseconds period, TimerCallback callback);
+    bool removeTimer(TimerId id);
+    // 주기 변경 (다음 실행은 지금부터 새 주기 뒤)
+    bool setTimerPeriod(TimerId id, std::chrono::milliseconds period);
+
+    // 호출한 스레드에서 stop()까지 이벤트 처리, cpu >= 0이면 해당 코어에 고정
+    void run(int cpu = -1);
+    void stop();
+
+    Stats stats() const;
+
+private:
+    struct Entry
+    {
+        uint32_t generation;
+        Handler handler;
+    };
+
+    int epollFd_ = -1;
+    int wakeFd_ = -1; // stop() 깨우기용 eventfd
+    std::atomic<bool> running_{false};
+
+    // fd 재사용 시 같은 epoll_wait 배치의 이전 이벤트를 구분하기 위한 세대 번호
+    uint32_t nextGeneration_ = 1;
+    std::unordered_map<int, std::shared_ptr<Entry>> entries_;
+
+    // 타이머 휠: tick마다 timerfd 만료, 기준 시각부터 경과 tick으로 진행 (지연이 누적되지 않음)
+    TimerWheel wheel_;
+    int tickFd_ = -1;
+    std::chrono::milliseconds tick_{10};
+    std::chrono::steady_clock::time_point tickBase_;
+    std::atomic<uint64_t> missedTicks_{0};
+
+    std::atomic<uint64_t> events_{0};
+    std::atomic<uint64_t> maxHandlerUs_{0};
+
+    void dispatch(uint64_t token, uint32_t events);
+    bool ensureTickTimer();
+    uint64_t currentTick() const;
+    uint64_t toTicks(std::chrono::milliseconds period) const;
+    void onTick();
+};
@@ -0,0 +1,179 @@
+#include "StatusDeltaEncoder.h"
+#include "CommandType.h"
+#include "StatusRecordWriter.h"
+
+#include <iostream>
+#include <limits>
+
+namespace
+{
+    // 전송되는 필드만 비교 (detectTime 등 포맷에 없는 필드 변화는 무시)
+    bool sameMfr(const MFRStatus &a, const MFRStatus &b)
+    {
+        return a.mfrId == b.mfrId && a.position.x == b.position.x && a.position.y == b.position.y &&
+               a.height == b.height && a.mode == b.mode && a.degree == b.degree;
+    }
+
+    bool sameLs(const LSStatus &a, const LSStatus &b)
+    {
+        return a.launchSystemId == b.launchSystemId && a.position.x == b.position.x && a.position.y == b.position.y &&
+               a.height == b.height && a.mode == b.mode && a.launchAngle == b.launchAngle;
+    }
+
+    bool sameLc(const LCStatus &a, const LCStatus &b)
+    {
+        return a.LCId == b.LCId && a.position.x == b.position.x && a.position.y == b.position.y;
+    }
+
+    bool sameMissile(const MissileStatus &a, const MissileStatus &b)
+    {
+        return a.posX == b.posX && a.posY == b.posY && a.altitude == b.altitude && a.speed == b.speed &&
+               a.angle == b.angle && a.interceptTime == b.interceptTime && a.hit == b.hit;
+    }
+
+    bool sameTarget(const TargetStatus &a, const TargetStatus &b)
+    {
+        return a.posX == b.posX && a.posY == b.posY && a.altitude == b.altitude && a.speed == b.speed &&
+               a.angle1 == b.angle1 && a.angle2 == b.angle2 && a.detectTime == b.detectTime &&
+               a.priority == b.priority && a.hit == b.hit;
+    }
+
+    // 이전 테이블 대비 추가/변경된 항목과 사라진 id 수집 (prev가 없으면 전부 추가)
+    template <typename T, typename Same>
+    void diffTable(const IdSlotMap<T> *prev, const IdSlotMap<T> &cur, bool forceAll, Same same,
+                   std::vector<const T *> &upserts, std::vector<unsigned int> &removed)
+    {
+        upserts.clear();
+        removed.clear();
+        for (const T &item : cur)
+        {
+            const T *old = prev ? prev->find(item.id) : nullptr;
+            if (forceAll || old == nullptr || !same(*old, item))
+                upserts.push_back(&item);
+        }
+        if (prev == nullptr)
+            return;
+        for (const T &item : *prev)
+        {
+            if (cur.find(item.id) == nullptr)
+                removed.push_back(item.id);
+        }
+    }
+}
+
+void StatusDeltaEncoder::acknowledge(uint32_t ackVersion)
+{
+    if (ackVersion == 0)
+    {
+        // 구독 시작 또는 ECC 쪽 상태 불일치 → 다음 푸시를 키프레임으로
+        subscribed_ = true;
+        keyframeRequested_ = true;
+        acked_ = version_;
+        return;
+    }
+    if (ackVersion <= version_ && ackVersion > acked_)
+        acked_ = ackVersion;
+}
+
+bool StatusDeltaEncoder::encode(StatusSnapshot snapshot, std::vector<uint8_t> &out)
+{
+    if (!subscribed_ || !snapshot)
+        return false;
+    if (version_ - acked_ >= MAX_UNACKED)
+        return false;
+
+    const SystemStatus &cur = *snapshot;
+    const bool keyframe = keyframeRequested_ || !last_ ||
+                          (keyframeInterval_ > 0 && sinceKeyframe_ + 1 >= keyframeInterval_);
+    const SystemStatus *prev = keyframe ? nullptr : &*last_;
+
+    uint8_t flags = keyframe ? (FLAG_KEYFRAME | FLAG_MFR | FLAG_LS | FLAG_LC) : 0;
+    if (prev)
+    {
+        if (!sameMfr(prev->mfr, cur.mfr))
+            flags |= FLAG_MFR;
+        if (!sameLs(prev->ls, cur.ls))
+            flags |= FLAG_LS;
+        if (!sameLc(prev->lc, cur.lc))
+            flags |= FLAG_LC;
+    }
+
+    // 미사일 레코드에는 LC 계산 시각이 들어가므로 바뀌면 미사일 전체를 다시 보냄
+    const bool calTimeChanged = prev && prev->lc.calculated_time != cur.lc.calculated_time;
+    diffTable(prev ? &prev->missiles : nullptr, cur.missiles, calTimeChanged, sameMissile, missileUpserts_, missileRemoved_);
+    diffTable(prev ? &prev->targets : nullptr, cur.targets, false, sameTarget, targetUpserts_, targetRemoved_);
+
+    ++sinceKeyframe_;
+    if (!keyframe && flags == 0 && missileUpserts_.empty() && missileRemoved_.empty() &&
+        targetUpserts_.empty() && targetRemoved_.empty())
+    {
+        return false;
+    }
+
+    constexpr size_t COUNT_LIMIT = std::numeric_limits<uint16_t>::max();
+    if (missileUpserts_.size() > COUNT_LIMIT || missileRemoved_.size() > COUNT_LIMIT ||
+        targetUpserts_.size() > COUNT_LIMIT || targetRemoved_.size() > COUNT_LIMIT)
+    {
+        std::cerr << "[StatusDeltaEncoder] 변경 항목이 u16 범위를 넘어 푸시 생략\n";
+        return false;
+    }
+
+    // 추적 정보는 다른 변경분이 있을 때만 실음 (이것만으로 푸시하지 않음)
+    if (cur.trace)
+    {
+        flags |= FLAG_TRACE;
+    }
+
+    const size_t total = HEADER_SIZE +
+                         ((flags & FLAG_TRACE) ? trace::WIRE_SIZE : 0) +
+                         ((flags & FLAG_MFR) ? status_record::MFR_SIZE : 0) +
+                         ((flags & FLAG_LS) ? status_record::LS_SIZE : 0) +
+                         ((flags & FLAG_LC) ? status_record::LC_SIZE : 0) +
+                         2 + missileUpserts_.size() * status_record::MISSILE_SIZE + 2 + missileRemoved_.size() * 4 +
+                         2 + targetUpserts_.size() * status_record::TARGET_SIZE + 2 + targetRemoved_.size() * 4;
+    out.resize(total);
+
+    const uint32_t base = keyframe ? 0 : version_;
+    ++version_;
+
+    status_record::Cursor c{out.data()};
+    c.putByte(static_cast<uint8_t>(Common::CommandType::STATUS_DELTA_LC_TO_ECC));
+    c.put(static_cast<uint32_t>(total - 5));
+    c.putByte(flags);
+    c.put(version_);
+    c.put(base);
+
+    if (flags & FLAG_TRACE)
+    {
+        c.put(cur.trace.id);
+        c.put(cur.trace.originUs);
+    }
+    if (flags & FLAG_MFR)
+        status_record::writeMfr(c, cur.mfr);
+    if (flags & FLAG_LS)
+        status_record::writeLs(c, cur.ls);
+    if (flags & FLAG_LC)
+        status_record::writeLc(c, cur.lc);
+
+    c.put(static_cast<uint16_t>(missileUpserts_.size()));
+    for (const MissileStatus *m : missileUpserts_)
+        status_record::writeMissile(c, *m, cur.lc.calculated_time);
+    c.put(static_cast<uint16_t>(missileRemoved_.size()));
+    for (unsigned int id : missileRemoved_)
+        c.put(static_cast<uint32_t>(id));
+
+    c.put(static_cast<uint16_t>(targetUpserts_.size()));
+    for (const TargetStatus *t : targetUpserts_)
+        status_record::writeTarget(c, *t);
+    c.put(static_cast<uint16_t>(targetRemoved_.size()));
+    for (unsigned int id : targetRemoved_)
+        c.put(static_cast<uint32_t>(id));
+
+    if (keyframe)
+    {
+        keyframeRequested_ = false;
+        sinceKeyframe_ = 0;
+    }
+    last_ = std::move(snapshot);
+    return true;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "StatusStore.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ECC 상태 푸시(0x57) 인코더
+// - 직전에 보낸 스냅샷과 비교해 추가/변경/삭제된 미사일·표적만 기록 (TCP라 순서 보장 → 직전 송신본이 기준)
+// - keyframeInterval번마다, 또는 ECC가 0을 ack(구독/재동기 요청)하면 전체 상태를 키프레임으로 보냄
+// - ECC ack보다 MAX_UNACKED개 이상 앞서면 ack가 올 때까지 보내지 않음
+//
+// [0x57][len u32][flags u8][version u32][baseVersion u32]
+// [traceId u32][traceOriginUs u64] (FLAG_TRACE일 때만, 보낼 변경분이 있을 때 최근 탐지 보고 기준)
+// [MFR][LS][LC] (flags에 해당 비트가 있을 때만)
+// [missile upsert u16][MISSILE_SIZE * n][missile removed u16][id u32 * n]
+// [target upsert u16][TARGET_SIZE * n][target removed u16][id u32 * n]
+class StatusDeltaEncoder
+{
+public:
+    static constexpr size_t HEADER_SIZE = 1 + 4 + 1 + 4 + 4;
+    static constexpr uint32_t MAX_UNACKED = 32;
+
+    static constexpr uint8_t FLAG_KEYFRAME = 0x01;
+    static constexpr uint8_t FLAG_MFR = 0x02;
+    static constexpr uint8_t FLAG_LS = 0x04;
+    static constexpr uint8_t FLAG_LC = 0x08;
+    static constexpr uint8_t FLAG_TRACE = 0x10;
+
+    explicit StatusDeltaEncoder(int keyframeInterval = 50) : keyframeInterval_(keyframeInterval) {}
+
+    // 구독 중인지 (ECC가 한 번이라도 0x06을 보냈는지)
+    bool subscribed() const { return subscribed_; }
+    uint32_t version() const { return version_; }
+
+    // 0x06 수신: 0이면 구독 시작/재동기 (다음 푸시는 키프레임), 아니면 해당 버전까지 적용 완료
+    void acknowledge(uint32_t ackVersion);
+
+    // 푸시 주기마다 호출. 보낼 내용이 없거나 ack 대기 중이면 false (out은 건드리지 않음)
+    bool encode(StatusSnapshot snapshot, std::vector<uint8_t> &out);
+
+private:
+    int keyframeInterval_;
+    bool subscribed_ = false;
+    bool keyframeRequested_ = true;
+    int sinceKeyframe_ = 0;
+    uint32_t version_ = 0;
+    uint32_t acked_ = 0;
+
+    StatusSnapshot last_; // 직전에 보낸 버전 (다음 델타의 기준)
+
+    // 변경분 수집용 (리액터 스레드에서만 사용, 재사용)
+    std::vector<const MissileStatus *> missileUpserts_;
+    std::vector<unsigned int> missileRemoved_;
+    std::vector<const TargetStatus *> targetUpserts_;
+    std::vector<unsigned int> targetRemoved_;
+};
@@ -0,0 +1,163 @@
+#include "StatusStore.h"
+
+#include <limits>
+#include <thread>
+
+namespace
+{
+    constexpr size_t MAX_READER_THREADS = 64;
+    constexpr uint64_t IDLE = std::numeric_limits<uint64_t>::max();
+
+    // 읽기 스레드별 슬롯: 현재 버전 포인터를 읽는 짧은 구간에만 epoch 기록
+    struct alignas(64) ReaderSlot
+    {
+        std::atomic<uint64_t> epoch{IDLE};
+        std::atomic<bool> used{false};
+    };
+
+    ReaderSlot g_readerSlots[MAX_READER_THREADS];
+    std::atomic<uint64_t> g_epoch{1};
+
+    struct SlotOwner
+    {
+        ReaderSlot *slot = nullptr;
+
+        ~SlotOwner()
+        {
+            if (slot)
+            {
+                slot->used.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    ReaderSlot &localSlot()
+    {
+        thread_local SlotOwner owner;
+        while (!owner.slot)
+        {
+            for (auto &slot : g_readerSlots)
+            {
+                bool expected = false;
+                if (slot.used.compare_exchange_strong(expected, true, std::memory_order_acquire))
+                {
+                    owner.slot = &slot;
+                    break;
+                }
+            }
+            if (!owner.slot)
+            {
+                // 슬롯 수보다 많은 스레드가 동시에 읽는 경우 (LC는 리액터 + 소수 스레드)
+                std::this_thread::yield();
+            }
+        }
+        return *owner.slot;
+    }
+}
+
+StatusSnapshot::~StatusSnapshot()
+{
+    if (node_)
+    {
+        node_->refs.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+StatusSnapshot::StatusSnapshot(StatusSnapshot &&other) noexcept
+    : node_(other.node_)
+{
+    other.node_ = nullptr;
+}
+
+StatusSnapshot &StatusSnapshot::operator=(StatusSnapshot &&other) noexcept
+{
+    if (this != &other)
+    {
+        if (node_)
+        {
+            node_->refs.fetch_sub(1, std::memory_order_release);
+        }
+        node_ = other.node_;
+        other.node_ = nullptr;
+    }
+    return *this;
+}
+
+StatusStore::StatusStore()
+    : current_(new StatusNode(SystemStatus{}))
+{
+}
+
+StatusStore::~StatusStore()
+{
+    // 소멸 시점에는 남은 스냅샷이 없어야 한다
+    delete current_.load();
+    for (StatusNode *node : retired_)
+    {
+        delete node;
+    }
+}
+
+StatusSnapshot StatusStore::snapshot() const
+{
+    ReaderSlot &slot = localSlot();
+
+    // epoch 기록 → 포인터 읽기 → 참조 증가 순서 (쓰기 쪽 reclaim과 seq_cst로 순서 보장)
+    slot.epoch.store(g_epoch.load());
+    StatusNode *node = current_.load();
+    node->refs.fetch_add(1, std::memory_order_relaxed);
+    slot.epoch.store(IDLE, std::memory_order_release);
+
+    return StatusSnapshot(node);
+}
+
+uint64_t StatusStore::update(const std::function<void(SystemStatus &)> &mutate)
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+
+    StatusNode *old = current_.load(std::memory_order_relaxed);
+    auto *next = new StatusNode(old->status);
+    mutate(next->status);
+    next->version = old->version + 1;
+
+    current_.exchange(next);
+    version_.store(next->version, std::memory_order_release);
+    // 이 값 이상의 epoch로 읽기를 시작한 스레드는 next만 볼 수 있다
+    old->retireEpoch = g_epoch.fetch_add(1) + 1;
+    retired_.push_back(old);
+
+    reclaim();
+    return next->version;
+}
+
+uint64_t StatusStore::version() const
+{
+    return version_.load(std::memory_order_acquire);
+}
+
+void StatusStore::reclaim()
+{
+    uint64_t oldestReader = IDLE;
+    for (const auto &slot : g_readerSlots)
+    {
+        const uint64_t epoch = slot.epoch.load();
+        if (epoch < oldestReader)
+        {
+            oldestReader = epoch;
+        }
+    }
+
+    size_t kept = 0;
+    for (StatusNode *node : retired_)
+    {
+        if (oldestReader >= node->retireEpoch && node->refs.load(std::memory_order_acquire) == 0)
+        {
+            delete node;
+        }
+        else
+        {
+            retired_[kept++] = node;
+        }
+    }
+    retired_.resize(kept);
+}
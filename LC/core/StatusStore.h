@@ -0,0 +1,73 @@
+#pragma once
+
+#include "SystemStatus.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// 발행된 SystemStatus 한 버전 (발행 후 불변)
+struct StatusNode
+{
+    explicit StatusNode(const SystemStatus &s) : status(s) {}
+
+    SystemStatus status;
+    uint64_t version = 0;
+    uint64_t retireEpoch = 0;        // 교체된 시점의 전역 epoch
+    std::atomic<uint32_t> refs{0};   // 살아 있는 StatusSnapshot 수
+};
+
+// 읽기 전용 참조 (복사 없음), 들고 있는 동안 해당 버전은 해제되지 않는다
+class StatusSnapshot
+{
+public:
+    StatusSnapshot() = default;
+    ~StatusSnapshot();
+
+    StatusSnapshot(StatusSnapshot &&other) noexcept;
+    StatusSnapshot &operator=(StatusSnapshot &&other) noexcept;
+    StatusSnapshot(const StatusSnapshot &) = delete;
+    StatusSnapshot &operator=(const StatusSnapshot &) = delete;
+
+    const SystemStatus &operator*() const { return node_->status; }
+    const SystemStatus *operator->() const { return &node_->status; }
+    uint64_t version() const { return node_ ? node_->version : 0; }
+    explicit operator bool() const { return node_ != nullptr; }
+
+private:
+    friend class StatusStore;
+    explicit StatusSnapshot(StatusNode *node) : node_(node) {}
+
+    StatusNode *node_ = nullptr;
+};
+
+// RCU 방식 SystemStatus 저장소
+// - 읽기: 잠금/복사 없이 현재 버전 참조 (스레드별 epoch 슬롯 + 참조 카운트)
+// - 쓰기: 현재 버전을 복사해 수정한 뒤 원자적으로 교체, 쓰기끼리만 직렬화
+// - 교체된 버전은 그 버전을 잡을 수 있던 읽기가 모두 끝나고 참조가 0이 되면 다음 쓰기에서 해제
+class StatusStore
+{
+public:
+    StatusStore();
+    ~StatusStore();
+
+    StatusStore(const StatusStore &) = delete;
+    StatusStore &operator=(const StatusStore &) = delete;
+
+    StatusSnapshot snapshot() const;
+
+    // 수정 후 새 버전 발행, 발행된 버전 번호 반환
+    uint64_t update(const std::function<void(SystemStatus &)> &mutate);
+
+    uint64_t version() const;
+
+private:
+    std::atomic<StatusNode *> current_;
+    std::atomic<uint64_t> version_{0};
+    std::mutex writeMutex_;
+    std::vector<StatusNode *> retired_;
+
+    void reclaim();
+};
@@ -0,0 +1,115 @@
+#include "TimerWheel.h"
+
+#include <algorithm>
+
+TimerWheel::TimerWheel(size_t slotCount) : slots_(std::max<size_t>(slotCount, 1)) {}
+
+uint64_t TimerWheel::toTicks(std::chrono::milliseconds period, std::chrono::milliseconds tick)
+{
+    const int64_t ticks = (period.count() + tick.count() - 1) / tick.count();
+    return static_cast<uint64_t>(ticks > 0 ? ticks : 1);
+}
+
+TimerWheel::TimerId TimerWheel::add(uint64_t periodTicks, Callback callback, uint64_t nowTick)
+{
+    const TimerId id = nextId_++;
+    if (nextId_ == 0)
+    {
+        nextId_ = 1;
+    }
+
+    Job job;
+    job.periodTicks = std::max<uint64_t>(periodTicks, 1);
+    job.deadline = std::max(nowTick, lastTick_) + job.periodTicks;
+    job.callback = std::make_shared<Callback>(std::move(callback));
+    const uint64_t deadline = job.deadline;
+    jobs_[id] = std::move(job);
+    schedule(id, deadline);
+    return id;
+}
+
+bool TimerWheel::remove(TimerId id)
+{
+    // 슬롯 항목은 만료 때 jobs_에 없으면 버려짐
+    return jobs_.erase(id) > 0;
+}
+
+bool TimerWheel::setPeriod(TimerId id, uint64_t periodTicks, uint64_t nowTick)
+{
+    auto it = jobs_.find(id);
+    if (it == jobs_.end())
+    {
+        return false;
+    }
+
+    Job &job = it->second;
+    job.periodTicks = std::max<uint64_t>(periodTicks, 1);
+    job.deadline = std::max(nowTick, lastTick_) + job.periodTicks;
+    schedule(id, job.deadline);
+    return true;
+}
+
+void TimerWheel::advance(uint64_t nowTick)
+{
+    if (nowTick <= lastTick_)
+    {
+        return;
+    }
+
+    // 한 바퀴 넘게 밀렸으면 모든 슬롯을 한 번씩만 보면 됨
+    const uint64_t steps = std::min<uint64_t>(nowTick - lastTick_, slots_.size());
+    const uint64_t first = nowTick - steps + 1;
+    lastTick_ = nowTick;
+    for (uint64_t t = first; t <= nowTick; ++t)
+    {
+        expire(static_cast<size_t>(t % slots_.size()), nowTick);
+    }
+}
+
+void TimerWheel::schedule(TimerId id, uint64_t deadline)
+{
+    slots_[deadline % slots_.size()].push_back(SlotEntry{id, deadline});
+}
+
+void TimerWheel::expire(size_t slot, uint64_t nowTick)
+{
+    // 콜백이 같은 슬롯에 예약할 수 있으므로 비운 뒤 처리
+    scratch_.clear();
+    scratch_.swap(slots_[slot]);
+
+    for (size_t i = 0; i < scratch_.size(); ++i)
+    {
+        const SlotEntry entry = scratch_[i];
+        auto it = jobs_.find(entry.id);
+        if (it == jobs_.end() || it->second.deadline != entry.deadline)
+        {
+            continue; // 삭제되었거나 재예약된 이전 항목
+        }
+        if (entry.deadline > nowTick)
+        {
+            slots_[slot].push_back(entry); // 다음 바퀴
+            continue;
+        }
+
+        std::shared_ptr<Callback> callback = it->second.callback;
+        (*callback)();
+
+        // 콜백이 remove/setPeriod/add를 했을 수 있으므로 다시 조회
+        it = jobs_.find(entry.id);
+        if (it == jobs_.end() || it->second.deadline != entry.deadline)
+        {
+            continue;
+        }
+
+        Job &job = it->second;
+        uint64_t next = job.deadline + job.periodTicks;
+        if (next <= nowTick)
+        {
+            const uint64_t skipped = (nowTick - next) / job.periodTicks + 1;
+            missed_ += skipped;
+            next += skipped * job.periodTicks;
+        }
+        job.deadline = next;
+        schedule(entry.id, next);
+    }
+}
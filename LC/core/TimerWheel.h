@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// 해시 타이머 휠 (주기 작업 스케줄러)
+// - 시간은 tick 단위 정수. 마감 tick = 직전 마감 + 주기 → 실행 지연이 다음 마감에 누적되지 않음
+// - 주기 이상 밀리면 밀린 만큼 건너뛰고 한 번만 실행 (missed()에 누적)
+// - 슬롯에는 (id, 마감)만 두고 삭제/주기 변경은 지연 처리 → 콜백 안에서 add/remove/setPeriod 가능
+// 리액터 스레드에서만 사용 (동기화 없음)
+class TimerWheel
+{
+public:
+    using TimerId = uint32_t; // 0은 무효
+    using Callback = std::function<void()>;
+
+    explicit TimerWheel(size_t slotCount = 256);
+
+    // 주기 → tick 수 (tick 배수로 올림, 최소 1 tick)
+    static uint64_t toTicks(std::chrono::milliseconds period, std::chrono::milliseconds tick);
+
+    // period는 tick 단위 (1 이상). 첫 실행은 nowTick + period
+    TimerId add(uint64_t periodTicks, Callback callback, uint64_t nowTick);
+    bool remove(TimerId id);
+    // 주기 변경, 다음 실행은 nowTick + 새 주기
+    bool setPeriod(TimerId id, uint64_t periodTicks, uint64_t nowTick);
+
+    // (lastTick, nowTick] 구간에 마감된 작업 실행
+    void advance(uint64_t nowTick);
+
+    size_t size() const { return jobs_.size(); }
+    uint64_t missed() const { return missed_; }
+
+private:
+    struct Job
+    {
+        uint64_t periodTicks;
+        uint64_t deadline;
+        std::shared_ptr<Callback> callback; // 콜백이 자기 자신을 remove해도 실행 중에는 유지
+    };
+
+    struct SlotEntry
+    {
+        TimerId id;
+        uint64_t deadline; // Job::deadline과 다르면 재예약된 이전 항목
+    };
+
+    std::vector<std::vector<SlotEntry>> slots_;
+    std::vector<SlotEntry> scratch_;
+    std::unordered_map<TimerId, Job> jobs_;
+    TimerId nextId_ = 1;
+    uint64_t lastTick_ = 0;
+    uint64_t missed_ = 0;
+
+    void schedule(TimerId id, uint64_t deadline);
+    void expire(size_t slot, uint64_t nowTick);
+};
@@ -0,0 +1,256 @@
+#include "TrackFilter.h"
+#include "InterceptSolver.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    // 분기 없는 축별 곱셈-덧셈만 남겨 컴파일러가 SIMD로 묶을 수 있게 함 (출력은 입력과 겹치지 않음)
+    void predictAxis(size_t n, double t, double maxDt, const double *time, const double *pos, const double *vel,
+                     double *__restrict out)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            double dt = t - time[i];
+            dt = dt < 0.0 ? 0.0 : dt;
+            dt = dt > maxDt ? maxDt : dt;
+            out[i] = pos[i] + vel[i] * dt;
+        }
+    }
+}
+
+double TrackFilter::toSec(uint64_t timeUs) const
+{
+    return static_cast<double>(static_cast<int64_t>(timeUs - baseUs_)) * 1e-6;
+}
+
+void TrackFilter::beginReport()
+{
+    std::fill(seen_.begin(), seen_.end(), 0);
+}
+
+void TrackFilter::update(const TargetStatus &target, uint64_t receivedUs, uint64_t measuredUs)
+{
+    update(target, receivedUs, measuredUs, false);
+}
+
+void TrackFilter::updateReceived(const TargetStatus &target, uint64_t receivedUs)
+{
+    update(target, receivedUs, receivedUs, true);
+}
+
+void TrackFilter::update(const TargetStatus &target, uint64_t receivedUs, uint64_t sampleUs, bool skipRepeat)
+{
+    if (!hasBase_)
+    {
+        baseUs_ = receivedUs;
+        hasBase_ = true;
+    }
+    const double t = toSec(receivedUs);
+
+    auto it = index_.find(target.id);
+    if (it == index_.end())
+    {
+        const size_t i = id_.size();
+        id_.push_back(target.id);
+        lat_.push_back(0.0);
+        lon_.push_back(0.0);
+        alt_.push_back(0.0);
+        vLat_.push_back(0.0);
+        vLon_.push_back(0.0);
+        vAlt_.push_back(0.0);
+        time_.push_back(t);
+        sample_.push_back(sampleUs);
+        zX_.push_back(0);
+        zY_.push_back(0);
+        zAlt_.push_back(0);
+        seen_.push_back(1);
+        index_.emplace(target.id, static_cast<uint32_t>(i));
+        initTrack(i, target, t, sampleUs);
+        return;
+    }
+
+    const size_t i = it->second;
+    seen_[i] = 1;
+
+    if (skipRepeat && target.posX == zX_[i] && target.posY == zY_[i] && target.altitude == zAlt_[i])
+    {
+        return; // 수신 시각만 다른 같은 측정
+    }
+    // 샘플 간격: 측정 시각끼리의 차이 (수신 지연 흔들림이 속도 추정에 섞이지 않음)
+    const double dt = static_cast<double>(static_cast<int64_t>(sampleUs - sample_[i])) * 1e-6;
+    if (dt <= 0.0)
+    {
+        return; // 같은 측정 시각(같은 시뮬레이터 샘플의 재보고) 또는 순서가 뒤바뀐 보고
+    }
+    if (dt > options_.resetSec)
+    {
+        initTrack(i, target, t, sampleUs);
+        return;
+    }
+
+    const double zLat = static_cast<double>(target.posX) / geo::COORD_SCALE;
+    const double zLon = static_cast<double>(target.posY) / geo::COORD_SCALE;
+    const double zAlt = static_cast<double>(target.altitude);
+    const double a = options_.alpha;
+    const double b = options_.beta / dt;
+
+    const double pLat = lat_[i] + vLat_[i] * dt;
+    const double pLon = lon_[i] + vLon_[i] * dt;
+    const double pAlt = alt_[i] + vAlt_[i] * dt;
+    const double rLat = zLat - pLat;
+    const double rLon = zLon - pLon;
+    const double rAlt = zAlt - pAlt;
+
+    lat_[i] = pLat + a * rLat;
+    lon_[i] = pLon + a * rLon;
+    alt_[i] = pAlt + a * rAlt;
+    vLat_[i] += b * rLat;
+    vLon_[i] += b * rLon;
+    vAlt_[i] += b * rAlt;
+    time_[i] = t; // 새 샘플은 LC 수신 시각에 고정
+    sample_[i] = sampleUs;
+    zX_[i] = target.posX;
+    zY_[i] = target.posY;
+    zAlt_[i] = target.altitude;
+}
+
+void TrackFilter::endReport()
+{
+    for (size_t i = id_.size(); i-- > 0;)
+    {
+        if (!seen_[i])
+        {
+            swapRemove(i);
+        }
+    }
+}
+
+bool TrackFilter::predict(unsigned int id, uint64_t timeUs, State &out) const
+{
+    auto it = index_.find(id);
+    if (it == index_.end())
+    {
+        return false;
+    }
+
+    const size_t i = it->second;
+    const double dt = std::min(std::max(toSec(timeUs) - time_[i], 0.0), options_.maxPredictSec);
+    out.lat = lat_[i] + vLat_[i] * dt;
+    out.lon = lon_[i] + vLon_[i] * dt;
+    out.alt = alt_[i] + vAlt_[i] * dt;
+    out.vLat = vLat_[i];
+    out.vLon = vLon_[i];
+    out.vAlt = vAlt_[i];
+    return true;
+}
+
+void TrackFilter::extrapolate(SystemStatus &status, uint64_t timeUs)
+{
+    if (id_.empty())
+    {
+        return;
+    }
+
+    predictAll(toSec(timeUs));
+    for (size_t i = 0; i < id_.size(); ++i)
+    {
+        TargetStatus *target = status.targets.find(id_[i]);
+        if (target == nullptr || target->hit)
+        {
+            continue;
+        }
+        target->posX = std::llround(predLat_[i] * geo::COORD_SCALE);
+        target->posY = std::llround(predLon_[i] * geo::COORD_SCALE);
+        target->altitude = std::llround(predAlt_[i]);
+    }
+}
+
+void TrackFilter::clear()
+{
+    id_.clear();
+    lat_.clear();
+    lon_.clear();
+    alt_.clear();
+    vLat_.clear();
+    vLon_.clear();
+    vAlt_.clear();
+    time_.clear();
+    sample_.clear();
+    zX_.clear();
+    zY_.clear();
+    zAlt_.clear();
+    seen_.clear();
+    index_.clear();
+    hasBase_ = false;
+}
+
+void TrackFilter::initTrack(size_t i, const TargetStatus &target, double t, uint64_t sampleUs)
+{
+    lat_[i] = static_cast<double>(target.posX) / geo::COORD_SCALE;
+    lon_[i] = static_cast<double>(target.posY) / geo::COORD_SCALE;
+    alt_[i] = static_cast<double>(target.altitude);
+
+    // MFR 속력(km/h)/방위각/고도각 → 축별 변화율
+    const geo::Enu v = InterceptSolver::velocityFromHeading(static_cast<double>(target.speed) * geo::KMH_TO_MPS,
+                                                            target.angle1, target.angle2);
+    vLat_[i] = v.north / geo::METERS_PER_DEG_LAT;
+    vLon_[i] = v.east / geo::metersPerDegLon(lat_[i]);
+    vAlt_[i] = v.up;
+    time_[i] = t;
+    sample_[i] = sampleUs;
+    zX_[i] = target.posX;
+    zY_[i] = target.posY;
+    zAlt_[i] = target.altitude;
+}
+
+void TrackFilter::swapRemove(size_t i)
+{
+    const size_t last = id_.size() - 1;
+    index_.erase(id_[i]);
+    if (i != last)
+    {
+        id_[i] = id_[last];
+        lat_[i] = lat_[last];
+        lon_[i] = lon_[last];
+        alt_[i] = alt_[last];
+        vLat_[i] = vLat_[last];
+        vLon_[i] = vLon_[last];
+        vAlt_[i] = vAlt_[last];
+        time_[i] = time_[last];
+        sample_[i] = sample_[last];
+        zX_[i] = zX_[last];
+        zY_[i] = zY_[last];
+        zAlt_[i] = zAlt_[last];
+        seen_[i] = seen_[last];
+        index_[id_[i]] = static_cast<uint32_t>(i);
+    }
+    id_.pop_back();
+    lat_.pop_back();
+    lon_.pop_back();
+    alt_.pop_back();
+    vLat_.pop_back();
+    vLon_.pop_back();
+    vAlt_.pop_back();
+    time_.pop_back();
+    sample_.pop_back();
+    zX_.pop_back();
+    zY_.pop_back();
+    zAlt_.pop_back();
+    seen_.pop_back();
+}
+
+void TrackFilter::predictAll(double t)
+{
+    const size_t n = id_.size();
+    predLat_.resize(n);
+    predLon_.resize(n);
+    predAlt_.resize(n);
+
+    // 축마다 따로 돌려 루프당 스트림 수를 줄임 (time_은 세 번 읽지만 캐시에 남아 있음)
+    const double maxDt = options_.maxPredictSec;
+    predictAxis(n, t, maxDt, time_.data(), lat_.data(), vLat_.data(), predLat_.data());
+    predictAxis(n, t, maxDt, time_.data(), lon_.data(), vLon_.data(), predLon_.data());
+    predictAxis(n, t, maxDt, time_.data(), alt_.data(), vAlt_.data(), predAlt_.data());
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "SystemStatus.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// 표적별 알파-베타 추적 필터 (MFR 보고 사이 위치 외삽)
+// - 상태: 위도/경도(deg), 고도(m)와 각 축 변화율(/s). 축마다 독립인 1차 등속 모델
+// - 갱신: 보고 시각까지 예측한 뒤 잔차 r로 x += αr, v += (β/dt)r
+// - 새 트랙은 보고 위치와 MFR 속력/방위각/고도각으로 만든 속도에서 시작
+// - 트랙은 필드별 배열(SoA)로 보관하고, 전체 예측은 분기 없는 한 번의 루프로 계산
+// - 트랙 시각은 LC 시계(수신 시각, us). 새 샘플은 받은 시각에 고정하고 외삽도 같은 시계로 계산
+// - MFR는 같은 시뮬레이터 샘플(100ms 주기)을 10ms마다 다시 보고하므로 재보고를 걸러야 위치가 계단 모양이 되지 않음
+//   → 샘플 시각(trace, 시뮬레이터 호스트 시계)을 알면 update로 재보고 판별과 샘플 간격(dt)에만 쓰고,
+//     모르면 updateReceived로 위치 비교해 거르고 수신 간격을 dt로 씀
+// 리액터 스레드 전용 (잠금 없음)
+class TrackFilter
+{
+public:
+    struct Options
+    {
+        double alpha = 0.5;
+        double beta = 0.2;
+        double maxPredictSec = 2.0; // 마지막 갱신 이후 이 시간까지만 외삽 (그 뒤는 위치 유지)
+        double resetSec = 5.0;      // 갱신 간격이 이보다 길면 트랙을 새로 시작
+    };
+
+    struct State
+    {
+        double lat;  // deg
+        double lon;  // deg
+        double alt;  // m
+        double vLat; // deg/s
+        double vLon; // deg/s
+        double vAlt; // m/s
+    };
+
+    TrackFilter() = default;
+    explicit TrackFilter(const Options &options) : options_(options) {}
+
+    void setOptions(const Options &options) { options_ = options; }
+    const Options &options() const { return options_; }
+
+    // 탐지 보고 1건 반영: 보고에 있는 표적만 갱신하고, 없는 트랙은 삭제 (보고 = 현재 탐지 전체)
+    void beginReport();
+    // receivedUs: LC 수신 시각 (트랙 시각), measuredUs: 측정(시뮬레이터 샘플) 시각 (다른 시계여도 됨)
+    // 같은 measuredUs의 재보고는 무시하고, 갱신 간격은 measuredUs 차이로 계산
+    void update(const TargetStatus &target, uint64_t receivedUs, uint64_t measuredUs);
+    // 측정 시각을 모를 때: 수신 시각을 쓰되 직전 측정과 위치/고도가 같으면 재보고로 보고 갱신하지 않음
+    void updateReceived(const TargetStatus &target, uint64_t receivedUs);
+    void endReport();
+
+    // timeUs 시점의 예측 상태 (트랙이 없으면 false)
+    bool predict(unsigned int id, uint64_t timeUs, State &out) const;
+
+    // 모든 트랙을 timeUs 시점으로 외삽해 status.targets 위치(posX/posY/altitude)에 기록
+    void extrapolate(SystemStatus &status, uint64_t timeUs);
+
+    size_t size() const { return id_.size(); }
+    void clear();
+
+private:
+    Options options_;
+
+    // 시각은 첫 갱신 시각 기준 초 (루프 안에서 정수 → 실수 변환이 없도록)
+    uint64_t baseUs_ = 0;
+    bool hasBase_ = false;
+
+    std::vector<unsigned int> id_;
+    std::vector<double> lat_, lon_, alt_;
+    std::vector<double> vLat_, vLon_, vAlt_;
+    std::vector<double> time_;  // 마지막 갱신 수신 시각 (s)
+    std::vector<uint64_t> sample_; // 마지막 측정 시각 (us, 측정 쪽 시계)
+    std::vector<long long> zX_, zY_, zAlt_; // 마지막 측정값 (재보고 판별)
+    std::vector<uint8_t> seen_; // 이번 보고에서 갱신됨
+    std::unordered_map<unsigned int, uint32_t> index_;
+
+    // extrapolate 결과 (재사용)
+    std::vector<double> predLat_, predLon_, predAlt_;
+
+    double toSec(uint64_t timeUs) const;
+    void update(const TargetStatus &target, uint64_t receivedUs, uint64_t sampleUs, bool skipRepeat);
+    void initTrack(size_t i, const TargetStatus &target, double t, uint64_t sampleUs);
+    void swapRemove(size_t i);
+    // [0, size) 전체를 t 시점으로 예측 (SoA → pred*)
+    void predictAll(double t);
+};
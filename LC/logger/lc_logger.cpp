@@ -1,6 +1,4 @@
 #include "lc_logger.h"
-#include <iostream>
-#include <ctime>
 
 LcLogger::LcLogger() {}
 
@@ -9,25 +7,18 @@ LcLogger::~LcLogger() {
 }
 
 bool LcLogger::startLogging(const std::string& filename) {
-    logFile_.open(filename, std::ios::out | std::ios::app);
-    if (!logFile_.is_open()) {
-        std::cerr << "[LcLogger] 로그 파일 열기 실패" << std::endl;
-        return false;
-    }
-    return true;
+    started_ = asynclog::setFile(filename);
+    return started_;
 }
 
 void LcLogger::logMessage(const std::string& message) {
-    std::lock_guard<std::mutex> lock(logMutex_);
-
-    if (logFile_.is_open()) {
-        std::time_t now = std::time(nullptr);
-        logFile_ << "[" << std::ctime(&now) << "] " << message << std::endl;
-    }
+    asynclog::info("{}", message);
 }
 
 void LcLogger::stopLogging() {
-    if (logFile_.is_open()) {
-        logFile_.close();
+    if (started_) {
+        // 남은 로그를 파일에 쓰고 stdout으로 되돌림
+        asynclog::setFile("");
+        started_ = false;
     }
 }
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
-#include <fstream>
-#include <mutex>
 
+#include "AsyncLog.h"
+
+// 파일 로그 (공용 비동기 로거 위에 얹은 얇은 래퍼)
+// - 포맷/시각 기록/파일 쓰기는 asynclog drain 스레드가 수행, 호출 스레드는 레코드 적재만 한다
 class LcLogger {
 public:
     LcLogger();
@@ -14,6 +16,5 @@ public:
     void stopLogging();
 
 private:
-    std::ofstream logFile_;
-    std::mutex logMutex_;
+    bool started_ = false;
 };
\ No newline at end of file
@@ -1,16 +1,36 @@
 #include "main.h"
+#include "Trace.h"
 #include <iostream>
 #include <string>
 #include <cmath>
 #include <thread>
 #include <chrono>
+#include <cstdlib>
 
-int main() {
-    LCManager manager;
-    manager.init("./config/system_config.ini", "0.0.0.0", 8888);  // ✅ 먼저 초기화
-    manager.run();                                              // ✅ 이후 디버그 루프 백그라운드 실행
+// lc                               : 일반 실행
+// lc --replay <세션 디렉터리> [--speed N] : 캡처 재생 (N 배속, 0이면 최대 속도, 기본 1)
+int main(int argc, char *argv[]) {
+    trace::installDumpSignal(); // SIGUSR1 → 단계별 지연 출력 (스레드 생성 전에 등록)
 
-    while (true) {
-        std::this_thread::sleep_for(std::chrono::seconds(1));
+    std::string replayDir;
+    double replaySpeed = 1.0;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--replay" && i + 1 < argc) {
+            replayDir = argv[++i];
+        } else if (arg == "--speed" && i + 1 < argc) {
+            replaySpeed = std::atof(argv[++i]);
+        } else {
+            std::cerr << "사용법: " << argv[0] << " [--replay <세션 디렉터리> [--speed N]]\n";
+            return 1;
+        }
     }
+
+    LCManager manager;
+    if (!replayDir.empty()) {
+        return manager.replay(replayDir, replaySpeed) ? 0 : 1;
+    }
+
+    manager.init("./config/system_config.ini", "0.0.0.0", 8888);  // ✅ 먼저 초기화
+    manager.run();                                              // ✅ 리액터 루프 (반환하지 않음)
 }
\ No newline at end of file
@@ -1,10 +1,17 @@
 #pragma once
 #include <vector>
 #include <mutex>
+#include <cstddef>
+
+#include "PacketProtocol.h"
+#include "Trace.h"
 
 class IReceiver
 {
 public:
     virtual void callBackData(const std::vector<char> &packet) = 0;
+
+    // 검증된 배치 패킷의 표적 배열을 수신 버퍼에서 바로 전달 (호출 중에만 유효), batchTrace는 배치 헤더의 추적 정보
+    virtual void callBackTargetBatch(const TargetSimData *targets, size_t count, const trace::Context &batchTrace) = 0;
     virtual ~IReceiver() = default;
 };
\ No newline at end of file
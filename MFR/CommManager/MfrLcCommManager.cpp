@@ -1,5 +1,6 @@
 #include "MfrLcCommManager.h"
 #include "logger.h"
+#include "StreamFramer.h"
 
 #include <iostream>
 #include <cstring>
@@ -8,11 +9,6 @@
 #include <thread>
 #include <vector>
 
-namespace
-{
-    constexpr size_t BUFFER_SIZE = 1024;
-}
-
 MfrLcCommManager::MfrLcCommManager(std::shared_ptr<IReceiver> receiver)
     : receiver_(receiver), sockfd(-1)
 {
@@ -88,13 +84,24 @@ void MfrLcCommManager::startTcpReceiver()
 
 void MfrLcCommManager::runReceiver()
 {
-    std::vector<char> buffer(BUFFER_SIZE);
+    stream::StreamFramer framer;
+    std::vector<char> packet;
     Logger::log("[MfrLcCommManager] TCP Receiver thread started");
 
     while (isRunning_)
     {
-        ssize_t len = read(sockfd, buffer.data(), buffer.size());
-        if (len <= 0)
+        // 한 번의 수신에 들어온 프레임을 모두 처리
+        const auto status = framer.receive(sockfd, [&](const uint8_t *frame, size_t len)
+                                           {
+            packet.assign(frame, frame + len);
+            safeCallbackData(packet); });
+
+        if (status == stream::StreamFramer::Status::Oversize)
+        {
+            Logger::log("[MfrLcCommManager] Invalid frame length, closing connection");
+            break;
+        }
+        if (status != stream::StreamFramer::Status::Ok)
         {
             if (isRunning_)
             {
@@ -102,9 +109,6 @@ void MfrLcCommManager::runReceiver()
             }
             break;
         }
-
-        std::vector<char> packet(buffer.begin(), buffer.begin() + len);
-        safeCallbackData(packet);
     }
 
     Logger::log("[MfrLcCommManager] Receiver thread stopped");
@@ -118,7 +122,7 @@ void MfrLcCommManager::safeCallbackData(const std::vector<char> &packet)
         try
         {
             receiver->callBackData(packet);
-            Logger::log("[MfrLcCommManager] Successfully processed packet of size: " + std::to_string(packet.size()));
+            asynclog::debug("[MfrLcCommManager] Successfully processed packet of size: {}", packet.size());
         }
         catch (const std::exception &e)
         {
@@ -138,26 +142,20 @@ void MfrLcCommManager::stopReceiver()
 
 void MfrLcCommManager::send(const std::vector<char> &packet)
 {
+    // 길이 접두와 payload가 다른 스레드의 프레임과 섞이지 않도록 sendFrame 전체를 잠금
+    std::lock_guard<std::mutex> lock(sendMutex_);
     if (sockfd < 0)
     {
         Logger::log("[MfrLcCommManager] Error: Socket not open");
         return;
     }
 
-    try
+    if (!stream::sendFrame(sockfd, packet.data(), packet.size()))
     {
-        ssize_t sent = write(sockfd, packet.data(), packet.size());
-        if (sent != static_cast<ssize_t>(packet.size()))
-        {
-            Logger::log("[MfrLcCommManager] Send failed: " + std::to_string(sent) + " of " + std::to_string(packet.size()));
-        }
-        else
-        {
-            Logger::log("[MfrLcCommManager] Successfully sent " + std::to_string(sent) + " bytes");
-        }
+        asynclog::error("[MfrLcCommManager] Send failed: {}", strerror(errno));
     }
-    catch (const std::exception &e)
+    else
     {
-        Logger::log("[MfrLcCommManager] Send error: " + std::string(e.what()));
+        asynclog::debug("[MfrLcCommManager] Successfully sent {} bytes", packet.size());
     }
 }
\ No newline at end of file
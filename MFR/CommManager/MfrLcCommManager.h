@@ -4,6 +4,7 @@
 
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <atomic>
@@ -17,6 +18,7 @@ private:
     std::string lcIp;
     int lcPort;
     std::mutex receiverMutex_;
+    std::mutex sendMutex_; // 탐지 스레드와 수신 스레드(상태 응답, 초기 데이터 요청)가 함께 송신하므로 프레임 단위로 직렬화
     std::atomic<bool> isRunning_{false}; // 스레드 제어용 추가
     std::thread receiverThread;          // 수신 스레드 관리용 추가
 
@@ -9,12 +9,26 @@
 #include <thread>
 #include <cstring>
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cerrno>
 
 namespace
 {
-    constexpr size_t BUFFER_SIZE = 1024;
+    // 29개 표적 배치 패킷(28 + 29 * 49 = 1449 byte)이 잘리지 않도록 MTU 이상으로 설정
+    constexpr size_t BUFFER_SIZE = 2048;
+    constexpr size_t MAX_RING_SLOTS = 1024;
+    constexpr auto STATS_LOG_INTERVAL = std::chrono::seconds(10);
 }
 
+uint32_t MfrSimCommManager::g_lastSeqID = 0;
+uint64_t MfrSimCommManager::g_totalPackets = 0;
+uint64_t MfrSimCommManager::g_integrityFail = 0;
+uint64_t MfrSimCommManager::g_lossCount = 0;
+std::atomic<uint64_t> MfrSimCommManager::g_kernelDropCount{0};
+std::atomic<uint64_t> MfrSimCommManager::g_truncCount{0};
+std::atomic<uint64_t> MfrSimCommManager::g_ringFullCount{0};
+
 MfrSimCommManager::MfrSimCommManager(std::shared_ptr<IReceiver> receiver)
     : receiver_(std::move(receiver)), sockfd(-1), simPort(0), isRunning_(false)
 {
@@ -22,6 +36,9 @@ MfrSimCommManager::MfrSimCommManager(std::shared_ptr<IReceiver> receiver)
     g_totalPackets = 0;
     g_integrityFail = 0;
     g_lossCount = 0;
+    g_kernelDropCount = 0;
+    g_truncCount = 0;
+    g_ringFullCount = 0;
     initMfrSimCommManager();
 }
 
@@ -44,6 +61,8 @@ void MfrSimCommManager::initMfrSimCommManager()
 
     Logger::log("[MfrSimCommManager] Initializing with Simulator Port: " + std::to_string(simPort));
 
+    initReceiveRing(static_cast<size_t>(std::max(config.simulatorRecvBatch, 1)));
+
     if (connectToSim())
     {
         startUdpReceiver();
@@ -64,6 +83,30 @@ bool MfrSimCommManager::connectToSim()
     serverAddr.sin_addr.s_addr = INADDR_ANY;
     serverAddr.sin_port = htons(simPort);
 
+    // 커널 수신 버퍼 크기 (실제 적용 값은 커널이 두 배로 잡거나 rmem_max로 제한할 수 있음)
+    const int requestedRcvBuf = MfrConfig::getInstance().simulatorRecvBufferBytes;
+    if (requestedRcvBuf > 0 && setsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &requestedRcvBuf, sizeof(requestedRcvBuf)) < 0)
+    {
+        Logger::log("[MfrSimCommManager] Failed to set SO_RCVBUF");
+    }
+    int actualRcvBuf = 0;
+    socklen_t optLen = sizeof(actualRcvBuf);
+    getsockopt(sockfd, SOL_SOCKET, SO_RCVBUF, &actualRcvBuf, &optLen);
+    Logger::log("[MfrSimCommManager] SO_RCVBUF requested " + std::to_string(requestedRcvBuf) + ", actual " + std::to_string(actualRcvBuf));
+
+    // 커널 드롭 누계를 데이터그램마다 보조 데이터로 받음
+    int enable = 1;
+    if (setsockopt(sockfd, SOL_SOCKET, SO_RXQ_OVFL, &enable, sizeof(enable)) < 0)
+    {
+        Logger::log("[MfrSimCommManager] SO_RXQ_OVFL not supported, kernel drop counter disabled");
+    }
+
+    // 종료 플래그 확인용 수신 타임아웃 (소켓 생성 시 한 번만 설정)
+    struct timeval tv;
+    tv.tv_sec = 1; // 1초 타임아웃
+    tv.tv_usec = 0;
+    setsockopt(sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
     if (bind(sockfd, reinterpret_cast<struct sockaddr *>(&serverAddr), sizeof(serverAddr)) < 0)
     {
         Logger::log("[MfrSimCommManager] Failed to bind UDP socket");
@@ -87,45 +130,131 @@ void MfrSimCommManager::startUdpReceiver()
     receiverThread = std::thread(&MfrSimCommManager::runReceiver, this);
 }
 
+void MfrSimCommManager::initReceiveRing(size_t slots)
+{
+    ringSlots_ = std::min(slots, MAX_RING_SLOTS);
+
+    const size_t controlSize = CMSG_SPACE(sizeof(uint32_t));
+    ringBuffer_.assign(ringSlots_ * BUFFER_SIZE, 0);
+    controlBuffer_.assign(ringSlots_ * controlSize, 0);
+    ringIov_.resize(ringSlots_);
+    ringMsgs_.resize(ringSlots_);
+
+    for (size_t i = 0; i < ringSlots_; ++i)
+    {
+        ringIov_[i].iov_base = ringBuffer_.data() + i * BUFFER_SIZE;
+        ringIov_[i].iov_len = BUFFER_SIZE;
+
+        std::memset(&ringMsgs_[i], 0, sizeof(ringMsgs_[i]));
+        ringMsgs_[i].msg_hdr.msg_iov = &ringIov_[i];
+        ringMsgs_[i].msg_hdr.msg_iovlen = 1;
+        ringMsgs_[i].msg_hdr.msg_control = controlBuffer_.data() + i * controlSize;
+        ringMsgs_[i].msg_hdr.msg_controllen = controlSize;
+    }
+}
+
+void MfrSimCommManager::updateKernelDropCount(const struct msghdr &hdr)
+{
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&hdr); cmsg != nullptr; cmsg = CMSG_NXTHDR(const_cast<struct msghdr *>(&hdr), cmsg))
+    {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_RXQ_OVFL)
+        {
+            uint32_t dropped = 0;
+            std::memcpy(&dropped, CMSG_DATA(cmsg), sizeof(dropped));
+            g_kernelDropCount.store(dropped, std::memory_order_relaxed);
+        }
+    }
+}
+
 void MfrSimCommManager::runReceiver()
 {
-    Logger::log("[MfrSimCommManager] UDP Receiver thread started");
+    Logger::log("[MfrSimCommManager] UDP Receiver thread started (recvmmsg, " + std::to_string(ringSlots_) + " slots)");
 
-    std::vector<char> buffer(BUFFER_SIZE);
-    sockaddr_in clientAddr{};
-    socklen_t addrLen = sizeof(clientAddr);
+    const size_t controlSize = CMSG_SPACE(sizeof(uint32_t));
+    auto nextStatsLog = std::chrono::steady_clock::now() + STATS_LOG_INTERVAL;
 
     while (isRunning_)
     {
-        // 소켓 타임아웃 설정
-        struct timeval tv;
-        tv.tv_sec = 1; // 1초 타임아웃
-        tv.tv_usec = 0;
-        setsockopt(sockfd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        // recvmmsg가 덮어쓰는 길이/플래그 초기화
+        for (size_t i = 0; i < ringSlots_; ++i)
+        {
+            ringMsgs_[i].msg_hdr.msg_controllen = controlSize;
+            ringMsgs_[i].msg_hdr.msg_flags = 0;
+        }
 
-        ssize_t len = recvfrom(sockfd, buffer.data(), buffer.size(), 0,
-                               reinterpret_cast<struct sockaddr *>(&clientAddr), &addrLen);
+        // 첫 데이터그램까지만 대기하고 이후 쌓여 있는 것은 한 번에 가져옴
+        int received = recvmmsg(sockfd, ringMsgs_.data(), static_cast<unsigned int>(ringSlots_), MSG_WAITFORONE, nullptr);
 
-        if (len <= 0)
+        if (received <= 0)
         {
-            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
             {
                 // 타임아웃 - 계속 진행
-                continue;
             }
-            if (isRunning_)
+            else
             {
-                Logger::log("[MfrSimCommManager] Error receiving data");
+                if (isRunning_)
+                {
+                    Logger::log("[MfrSimCommManager] Error receiving data");
+                }
+                break;
+            }
+        }
+        else
+        {
+            if (static_cast<size_t>(received) == ringSlots_)
+            {
+                g_ringFullCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            for (int i = 0; i < received; ++i)
+            {
+                const struct msghdr &hdr = ringMsgs_[i].msg_hdr;
+                updateKernelDropCount(hdr);
+
+                if (hdr.msg_flags & MSG_TRUNC)
+                {
+                    g_truncCount.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+
+                processReceivedData(static_cast<const char *>(ringIov_[i].iov_base), ringMsgs_[i].msg_len);
             }
-            break;
         }
 
-        processReceivedData(buffer.data(), len);
+        const auto now = std::chrono::steady_clock::now();
+        if (now >= nextStatsLog)
+        {
+            logLinkStats();
+            nextStatsLog = now + STATS_LOG_INTERVAL;
+        }
     }
 
     Logger::log("[MfrSimCommManager] UDP Receiver thread stopped");
 }
 
+MfrSimCommManager::LinkStats MfrSimCommManager::getLinkStats() const
+{
+    return LinkStats{
+        g_totalPackets,
+        g_lossCount,
+        g_integrityFail,
+        g_kernelDropCount.load(std::memory_order_relaxed),
+        g_truncCount.load(std::memory_order_relaxed),
+        g_ringFullCount.load(std::memory_order_relaxed)};
+}
+
+void MfrSimCommManager::logLinkStats()
+{
+    const LinkStats stats = getLinkStats();
+    Logger::log("[MfrSimCommManager] packets " + std::to_string(stats.totalPackets) +
+                ", seq loss " + std::to_string(stats.lossCount) +
+                ", crc fail " + std::to_string(stats.integrityFail) +
+                ", kernel drop " + std::to_string(stats.kernelDropCount) +
+                ", truncated " + std::to_string(stats.truncCount) +
+                ", ring full " + std::to_string(stats.ringFullCount));
+}
+
 void MfrSimCommManager::processReceivedData(const char *buffer, size_t len)
 {
     auto receiver = receiver_.lock();
@@ -170,6 +299,14 @@ void MfrSimCommManager::processBatchPacket(const char* buffer, size_t len)
     const char* payloadStart = buffer + sizeof(PacketHeader);
     size_t payloadLen = len - sizeof(PacketHeader);
 
+    // 헤더의 표적 수가 실제 페이로드 길이와 맞지 않으면 버림
+    if (static_cast<size_t>(header->count) * sizeof(TargetSimData) > payloadLen)
+    {
+        g_integrityFail++;
+        Logger::log("[Integrity Fail] Batch count exceeds payload. Packet Dropped.");
+        return;
+    }
+
     // ---------------------------------------------------------
     // 1. 무결성 검증 (Integrity Check) - CRC
     // ---------------------------------------------------------
@@ -209,25 +346,8 @@ void MfrSimCommManager::processBatchPacket(const char* buffer, size_t len)
     {
         std::lock_guard<std::mutex> lock(callbackMutex_);
 
-        // 배치로 들어온 표적들을 하나씩 꺼내서 기존 callback 호출
-        for (uint32_t i = 0; i < header->count; ++i)
-        {
-            // 상위 레이어가 [1 byte Type] + [TargetData] 구조를 원한다면
-            // 여기서 그 구조를 만들어서 던져줘야 함.
-            
-            // 임시 버퍼 생성 (기존 호환성 유지용)
-            std::vector<char> packet;
-            packet.reserve(sizeof(uint8_t) + sizeof(TargetSimData));
-
-            uint8_t type = 1; // 예: Target 데이터 타입 ID (기존 코드의 buffer[0] 값 참조 필요)
-            packet.push_back(type);
-            
-            const char* targetPtr = reinterpret_cast<const char*>(&targets[i]);
-            packet.insert(packet.end(), targetPtr, targetPtr + sizeof(TargetSimData));
-
-            // 기존 콜백 호출 (하나씩 전달)
-            receiver->callBackData(packet);
-        }
+        // 수신 버퍼를 그대로 넘겨 한 번에 반영 (표적별 패킷 재구성 없음)
+        receiver->callBackTargetBatch(targets, header->count, trace::Context{header->traceId, header->traceOriginUs});
     }
 }
 
@@ -287,6 +407,7 @@ void MfrSimCommManager::stopReceiver()
     if (receiverThread.joinable())
     {
         receiverThread.join();
+        logLinkStats();
     }
     Logger::log("[MfrSimCommManager] Receiver stopped");
 }
\ No newline at end of file
@@ -7,6 +7,9 @@
 #include <atomic>
 #include <thread>
 #include <mutex>
+#include <cstdint>
+#include <sys/socket.h>
+#include <sys/uio.h>
 
 class MfrSimCommManager
 {
@@ -20,6 +23,18 @@ private:
     static uint64_t g_integrityFail;
     static uint64_t g_lossCount;
 
+    // 커널/수신 링 단계 손실 (seqID로는 구분할 수 없는 손실)
+    static std::atomic<uint64_t> g_kernelDropCount; // SO_RXQ_OVFL: 소켓 버퍼 초과로 커널이 버린 데이터그램 누계
+    static std::atomic<uint64_t> g_truncCount;      // 슬롯보다 큰 데이터그램 (MSG_TRUNC)
+    static std::atomic<uint64_t> g_ringFullCount;   // recvmmsg가 링을 가득 채워 반환한 횟수 (수신 지연)
+
+    // recvmmsg 수신 링 (슬롯당 데이터그램 1개)
+    std::vector<char> ringBuffer_;
+    std::vector<char> controlBuffer_;
+    std::vector<struct iovec> ringIov_;
+    std::vector<struct mmsghdr> ringMsgs_;
+    size_t ringSlots_ = 0;
+
     std::atomic<bool> isRunning_;
     std::thread receiverThread; // 스레드 객체 추가
     std::mutex callbackMutex_; // 스레드 안전을 위한 뮤텍스
@@ -28,6 +43,9 @@ private:
     void processTargetData(const char *buffer, size_t len);
     void processMissileData(const char *buffer, size_t len);
     void runReceiver(); // 실제 수신 작업을 수행할 메서드
+    void initReceiveRing(size_t slots);
+    void updateKernelDropCount(const struct msghdr &hdr);
+    void logLinkStats();
     void processBatchPacket(const char* buffer, size_t len);
     
 public:
@@ -40,4 +58,15 @@ public:
     bool connectToSim();
     void startUdpReceiver();
     void stopReceiver();
+
+    struct LinkStats
+    {
+        uint64_t totalPackets;
+        uint64_t lossCount;
+        uint64_t integrityFail;
+        uint64_t kernelDropCount;
+        uint64_t truncCount;
+        uint64_t ringFullCount;
+    };
+    LinkStats getLinkStats() const;
 };
\ No newline at end of file
@@ -80,6 +80,14 @@ bool MfrConfig::loadConfig(const std::string &filepath)
             {
                 simulatorPort = std::stoi(value);
             }
+            else if (key == "RecvBufferBytes")
+            {
+                simulatorRecvBufferBytes = std::stoi(value);
+            }
+            else if (key == "RecvBatch")
+            {
+                simulatorRecvBatch = std::stoi(value);
+            }
         }
         else if (currentSection == "Motor")
         {
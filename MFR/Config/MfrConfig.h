@@ -29,6 +29,8 @@ public:
     std::string launchControllerIP;
     int launchControllerPort = 0;
     int simulatorPort = 0;
+    int simulatorRecvBufferBytes = 4 * 1024 * 1024; // SO_RCVBUF (커널 수신 버퍼)
+    int simulatorRecvBatch = 32;                    // recvmmsg 1회당 최대 데이터그램 수 (수신 링 슬롯 수)
     std::string device;
     int uartBaudRate = B9600;
 
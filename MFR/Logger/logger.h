@@ -1,12 +1,11 @@
 #pragma once
-#include <mutex>
 #include <string>
 
+#include "AsyncLog.h"
+
+// 기존 호출부 호환용 (비동기 로거에 Info로 적재). 주기적으로 찍는 경로는 asynclog를 직접 사용
 class Logger
 {
-private:
-    static std::mutex mtx;
-
 public:
     static void log(const std::string &message);
 };
\ No newline at end of file
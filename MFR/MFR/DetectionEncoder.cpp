@@ -0,0 +1,255 @@
+#include "DetectionEncoder.h"
+#include "DetectionDelta.h"
+
+#include <cstring>
+
+namespace
+{
+    // packed 레코드의 멤버(정렬 안 된 double 등)를 참조로 묶지 않도록 값으로 받음
+    template <typename T>
+    void appendRaw(std::vector<char> &out, T value)
+    {
+        const char *ptr = reinterpret_cast<const char *>(&value);
+        out.insert(out.end(), ptr, ptr + sizeof(T));
+    }
+
+    void appendDelta(std::vector<char> &out, long long key, long long cur)
+    {
+        detection_v2::putVarint(out, detection_v2::zigzag(static_cast<int64_t>(cur) - static_cast<int64_t>(key)));
+    }
+
+    bool sameBits(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+}
+
+DetectionEncoder::DetectionEncoder(unsigned int radarId)
+    : radarId_(radarId)
+{
+    static_assert(sizeof(MfrToLcTargetInfo) == detection_v2::TARGET_RECORD_SIZE, "target record size");
+    static_assert(sizeof(MfrToLcMissileInfo) == detection_v2::MISSILE_RECORD_SIZE, "missile record size");
+
+    keyTargets_.reserve(ID_SLOTS);
+    keyMissiles_.reserve(ID_SLOTS);
+}
+
+uint16_t DetectionEncoder::targetRef(unsigned int id) const
+{
+    return (id >= TARGET_ID_BASE && id - TARGET_ID_BASE < ID_SLOTS) ? keyTargetRef_[id - TARGET_ID_BASE] : 0;
+}
+
+uint16_t DetectionEncoder::missileRef(unsigned int id) const
+{
+    return (id >= MISSILE_ID_BASE && id - MISSILE_ID_BASE < ID_SLOTS) ? keyMissileRef_[id - MISSILE_ID_BASE] : 0;
+}
+
+bool DetectionEncoder::needKeyframe(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles) const
+{
+    if (!hasKeyframe_ || framesSinceKey_ >= KEYFRAME_INTERVAL)
+    {
+        return true;
+    }
+
+    // 신규 접촉(전체 레코드)이 1/4을 넘으면 델타 이득이 작으므로 새 키프레임
+    size_t newContacts = 0;
+    for (const auto &t : targets)
+    {
+        newContacts += targetRef(t.id) == 0;
+    }
+    for (const auto &m : missiles)
+    {
+        newContacts += missileRef(m.id) == 0;
+    }
+    return newContacts * 4 > targets.size() + missiles.size();
+}
+
+void DetectionEncoder::storeKeyframe(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles)
+{
+    for (const auto &t : keyTargets_)
+    {
+        if (t.id >= TARGET_ID_BASE && t.id - TARGET_ID_BASE < ID_SLOTS)
+        {
+            keyTargetRef_[t.id - TARGET_ID_BASE] = 0;
+        }
+    }
+    for (const auto &m : keyMissiles_)
+    {
+        if (m.id >= MISSILE_ID_BASE && m.id - MISSILE_ID_BASE < ID_SLOTS)
+        {
+            keyMissileRef_[m.id - MISSILE_ID_BASE] = 0;
+        }
+    }
+
+    keyTargets_.assign(targets.begin(), targets.end());
+    keyMissiles_.assign(missiles.begin(), missiles.end());
+
+    for (size_t i = 0; i < keyTargets_.size(); ++i)
+    {
+        const unsigned int id = keyTargets_[i].id;
+        if (id >= TARGET_ID_BASE && id - TARGET_ID_BASE < ID_SLOTS)
+        {
+            keyTargetRef_[id - TARGET_ID_BASE] = static_cast<uint16_t>(i + 1);
+        }
+    }
+    for (size_t i = 0; i < keyMissiles_.size(); ++i)
+    {
+        const unsigned int id = keyMissiles_[i].id;
+        if (id >= MISSILE_ID_BASE && id - MISSILE_ID_BASE < ID_SLOTS)
+        {
+            keyMissileRef_[id - MISSILE_ID_BASE] = static_cast<uint16_t>(i + 1);
+        }
+    }
+
+    keySeq_ = frameSeq_;
+    framesSinceKey_ = 0;
+    hasKeyframe_ = true;
+}
+
+void DetectionEncoder::writeHeader(std::vector<char> &out, bool keyframe, size_t numTargets, size_t numMissiles, const trace::Context &trace) const
+{
+    const uint8_t flags = (keyframe ? detection_v2::FLAG_KEYFRAME : 0) | (trace ? detection_v2::FLAG_TRACE : 0);
+    out.push_back(static_cast<char>(detection_v2::COMMAND));
+    out.push_back(static_cast<char>(detection_v2::VERSION));
+    out.push_back(static_cast<char>(flags));
+    appendRaw(out, static_cast<uint32_t>(radarId_));
+    appendRaw(out, frameSeq_);
+    appendRaw(out, keySeq_);
+    appendRaw(out, static_cast<uint16_t>(numTargets));
+    appendRaw(out, static_cast<uint16_t>(numMissiles));
+    if (trace)
+    {
+        appendRaw(out, trace.id);
+        appendRaw(out, trace.originUs);
+    }
+}
+
+void DetectionEncoder::writeTargetDelta(std::vector<char> &out, const MfrToLcTargetInfo &key, const MfrToLcTargetInfo &cur) const
+{
+    using namespace detection_v2;
+
+    uint8_t mask = 0;
+    if (cur.targetCoords.latitude != key.targetCoords.latitude ||
+        cur.targetCoords.longitude != key.targetCoords.longitude ||
+        cur.targetCoords.altitude != key.targetCoords.altitude)
+        mask |= TARGET_POS;
+    if (cur.targetSpeed != key.targetSpeed)
+        mask |= TARGET_SPEED;
+    if (!sameBits(cur.targetAngle, key.targetAngle))
+        mask |= TARGET_ANGLE1;
+    if (!sameBits(cur.targetAngle2, key.targetAngle2))
+        mask |= TARGET_ANGLE2;
+    if (cur.firstDetectionTime != key.firstDetectionTime)
+        mask |= TARGET_DETECT_TIME;
+    if (cur.prioirty != key.prioirty)
+        mask |= TARGET_PRIORITY;
+    if (cur.isHit != key.isHit)
+        mask |= TARGET_HIT;
+
+    out.push_back(static_cast<char>(mask));
+    if (mask & TARGET_POS)
+    {
+        appendDelta(out, key.targetCoords.latitude, cur.targetCoords.latitude);
+        appendDelta(out, key.targetCoords.longitude, cur.targetCoords.longitude);
+        appendDelta(out, key.targetCoords.altitude, cur.targetCoords.altitude);
+    }
+    if (mask & TARGET_SPEED)
+        appendDelta(out, key.targetSpeed, cur.targetSpeed);
+    if (mask & TARGET_ANGLE1)
+        appendRaw(out, cur.targetAngle);
+    if (mask & TARGET_ANGLE2)
+        appendRaw(out, cur.targetAngle2);
+    if (mask & TARGET_DETECT_TIME)
+        appendDelta(out, static_cast<long long>(key.firstDetectionTime), static_cast<long long>(cur.firstDetectionTime));
+    if (mask & TARGET_PRIORITY)
+        out.push_back(static_cast<char>(cur.prioirty));
+    if (mask & TARGET_HIT)
+        out.push_back(static_cast<char>(cur.isHit));
+}
+
+void DetectionEncoder::writeMissileDelta(std::vector<char> &out, const MfrToLcMissileInfo &key, const MfrToLcMissileInfo &cur) const
+{
+    using namespace detection_v2;
+
+    uint8_t mask = 0;
+    if (cur.missileCoords.latitude != key.missileCoords.latitude ||
+        cur.missileCoords.longitude != key.missileCoords.longitude ||
+        cur.missileCoords.altitude != key.missileCoords.altitude)
+        mask |= MISSILE_POS;
+    if (cur.missileSpeed != key.missileSpeed)
+        mask |= MISSILE_SPEED;
+    if (!sameBits(cur.missileAngle, key.missileAngle))
+        mask |= MISSILE_ANGLE;
+    if (cur.firstDetectionTime != key.firstDetectionTime)
+        mask |= MISSILE_DETECT_TIME;
+    if (cur.timeToIntercept != key.timeToIntercept)
+        mask |= MISSILE_INTERCEPT_TIME;
+    if (cur.isHit != key.isHit)
+        mask |= MISSILE_HIT;
+
+    out.push_back(static_cast<char>(mask));
+    if (mask & MISSILE_POS)
+    {
+        appendDelta(out, key.missileCoords.latitude, cur.missileCoords.latitude);
+        appendDelta(out, key.missileCoords.longitude, cur.missileCoords.longitude);
+        appendDelta(out, key.missileCoords.altitude, cur.missileCoords.altitude);
+    }
+    if (mask & MISSILE_SPEED)
+        appendDelta(out, key.missileSpeed, cur.missileSpeed);
+    if (mask & MISSILE_ANGLE)
+        appendRaw(out, cur.missileAngle);
+    if (mask & MISSILE_DETECT_TIME)
+        appendDelta(out, static_cast<long long>(key.firstDetectionTime), static_cast<long long>(cur.firstDetectionTime));
+    if (mask & MISSILE_INTERCEPT_TIME)
+        appendDelta(out, static_cast<long long>(key.timeToIntercept), static_cast<long long>(cur.timeToIntercept));
+    if (mask & MISSILE_HIT)
+        out.push_back(static_cast<char>(cur.isHit));
+}
+
+void DetectionEncoder::encode(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles,
+                              const trace::Context &trace, std::vector<char> &out)
+{
+    out.clear();
+    ++frameSeq_;
+
+    const bool keyframe = needKeyframe(targets, missiles);
+    if (keyframe)
+    {
+        storeKeyframe(targets, missiles);
+    }
+    else
+    {
+        ++framesSinceKey_;
+    }
+
+    writeHeader(out, keyframe, targets.size(), missiles.size(), trace);
+
+    if (keyframe)
+    {
+        for (const auto &t : targets)
+            appendRaw(out, t);
+        for (const auto &m : missiles)
+            appendRaw(out, m);
+        return;
+    }
+
+    for (const auto &t : targets)
+    {
+        const uint16_t ref = targetRef(t.id);
+        detection_v2::putVarint(out, ref);
+        if (ref == 0)
+            appendRaw(out, t);
+        else
+            writeTargetDelta(out, keyTargets_[ref - 1], t);
+    }
+
+    for (const auto &m : missiles)
+    {
+        const uint16_t ref = missileRef(m.id);
+        detection_v2::putVarint(out, ref);
+        if (ref == 0)
+            appendRaw(out, m);
+        else
+            writeMissileDelta(out, keyMissiles_[ref - 1], m);
+    }
+}
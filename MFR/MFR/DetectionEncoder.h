@@ -0,0 +1,50 @@
+#pragma once
+
+#include "PacketProtocol.h"
+#include "Trace.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// 탐지 정보 v2 (키프레임 + 델타) 직렬화, 형식은 Common/DetectionDelta.h 참고
+// 탐지 스레드 전용 (내부 상태를 잠금 없이 갱신)
+class DetectionEncoder
+{
+public:
+    static constexpr uint32_t KEYFRAME_INTERVAL = 100; // 최대 키프레임 간격 (프레임, 10ms 주기 기준 1초)
+
+    explicit DetectionEncoder(unsigned int radarId);
+
+    // out은 재사용 버퍼 (clear 후 기록), trace가 있으면 헤더 뒤에 추적 정보를 붙임
+    void encode(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles,
+                const trace::Context &trace, std::vector<char> &out);
+
+private:
+    static constexpr unsigned int TARGET_ID_BASE = 104001;
+    static constexpr unsigned int MISSILE_ID_BASE = 105001;
+    static constexpr size_t ID_SLOTS = 999;
+
+    unsigned int radarId_;
+    uint16_t frameSeq_ = 0;
+    uint16_t keySeq_ = 0;
+    uint32_t framesSinceKey_ = 0;
+    bool hasKeyframe_ = false;
+
+    std::vector<MfrToLcTargetInfo> keyTargets_;
+    std::vector<MfrToLcMissileInfo> keyMissiles_;
+
+    // ID → 키프레임 레코드 번호 + 1 (0이면 키프레임에 없음)
+    std::array<uint16_t, ID_SLOTS> keyTargetRef_{};
+    std::array<uint16_t, ID_SLOTS> keyMissileRef_{};
+
+    bool needKeyframe(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles) const;
+    void storeKeyframe(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles);
+    uint16_t targetRef(unsigned int id) const;
+    uint16_t missileRef(unsigned int id) const;
+
+    void writeHeader(std::vector<char> &out, bool keyframe, size_t numTargets, size_t numMissiles, const trace::Context &trace) const;
+    void writeTargetDelta(std::vector<char> &out, const MfrToLcTargetInfo &key, const MfrToLcTargetInfo &cur) const;
+    void writeMissileDelta(std::vector<char> &out, const MfrToLcMissileInfo &key, const MfrToLcMissileInfo &cur) const;
+};
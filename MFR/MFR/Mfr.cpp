@@ -1,12 +1,14 @@
 #include "Mfr.h"
 #include "logger.h"
 #include "IReceiver.h"
+#include "CommonPacket.h"
 
 #include <iostream>
 #include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <iomanip>
+#include <cmath>
 
 void Mfr::requestLcInitData()
 {
@@ -46,11 +48,9 @@ void Mfr::startDetectionAlgoThread()
 
 void Mfr::mfrDetectionAlgo()
 {
-    std::map<unsigned int, localMockSimData> localTargets;
-    std::unordered_map<unsigned int, localMockSimData> localMissiles;
-
-    localTargets = mockTargets;
-    localMissiles = mockMissile;
+    // 복사 없이 가장 최근에 게시된 스냅샷 참조
+    const MockTable &localTargets = mockTargets.acquire();
+    const MockTable &localMissiles = mockMissile.acquire();
 
     std::unordered_map<unsigned int, localMockSimData> localDetectedTargets;
     std::unordered_map<unsigned int, localMockSimData> localDetectedMissile;
@@ -64,25 +64,17 @@ void Mfr::mfrDetectionAlgo()
     if (mfrMode == ROTATION_MODE)
     {
         std::vector<std::pair<unsigned int, double>> targetDistances;
+        targetDistances.reserve(localTargets.active.size());
 
-        for (const auto &[id, target] : localTargets)
+        scanDetectionRange(localTargets);
+        for (size_t i = 0; i < scanMocks.size(); ++i)
         {
-            double distance = calcDistance(mfrCoords, target.mockCoords);
-            std::cout<<"cur distnace: "<<distance<<"\n";
-            if (distance <= limitDetectionRange && !target.isHit)
+            const auto &target = *scanMocks[i];
+            double distance = 0.0;
+            if (!target.isHit && checkDetectionRange(target.mockCoords, scanDistSq[i], distance))
             {
-                localDetectedTargets[id] = target;
-                targetDistances.emplace_back(id, distance);
-                Logger::log("Target ID: " + std::to_string(id) + ", Distance: " + std::to_string(distance) + " m, Sppeed: " + std::to_string(target.speed));
-            }
-            else
-            {
-                localDetectedTargets.erase(id);
-                auto it = std::remove_if(targetDistances.begin(), targetDistances.end(),
-                                         [id](const std::pair<unsigned int, double> &p)
-                                         { return p.first == id; });
-
-                targetDistances.erase(it, targetDistances.end());
+                localDetectedTargets[target.mockId] = target;
+                targetDistances.emplace_back(target.mockId, distance);
             }
         }
 
@@ -108,21 +100,21 @@ void Mfr::mfrDetectionAlgo()
             status.targetSpeed = target.speed;
             status.targetAngle = target.angle;
             status.targetAngle2 = target.angle2;
-            status.firstDetectionTime = nowMs;
+            status.firstDetectionTime = targetFirstDetection.mark(status.id, nowMs);
             status.prioirty = priority++;
             status.isHit = false;
 
             detectedTargetList.push_back(status);
-            Logger::log("Detected Target ID: " + std::to_string(status.id) +
-                        ", Distance: " + std::to_string(distance) +
-                        " m, Speed: " + std::to_string(status.targetSpeed));
+            // 표적마다 찍히므로 Debug (기본 빌드에서는 컴파일 단계에서 제거)
+            asynclog::debug("Detected Target ID: {}, Distance: {} m, Speed: {}", status.id, distance, status.targetSpeed);
         }
 
-        for (const auto &[id, missile] : localMissiles)
+        for (uint16_t slot : localMissiles.active)
         {
-            long long distance = calcDistance(mfrCoords, missile.mockCoords);
-
-            if (distance <= limitDetectionRange && !missile.isHit)
+            const auto &missile = localMissiles.slots[slot];
+            const unsigned int id = missile.mockId;
+            double distance = 0.0;
+            if (!missile.isHit && checkDetectionRange(missile.mockCoords, distance))
             {
                 localDetectedMissile[id] = missile;
 
@@ -131,7 +123,7 @@ void Mfr::mfrDetectionAlgo()
                 status.missileCoords = encode(missile.mockCoords);
                 status.missileSpeed = missile.speed;
                 status.missileAngle = missile.angle;
-                status.firstDetectionTime = nowMs;
+                status.firstDetectionTime = missileFirstDetection.mark(status.id, nowMs);
                 status.timeToIntercept = 10;
                 status.isHit = false;
 
@@ -139,7 +131,6 @@ void Mfr::mfrDetectionAlgo()
             }
             else
             {
-                localDetectedMissile.erase(id);
                 detectedMissile.erase(id);
             }
         }
@@ -153,49 +144,68 @@ void Mfr::mfrDetectionAlgo()
         detectedTargetList.clear();
         detectedMissileList.clear();
         // std::cout << "goalTargetId: " << goalTargetId << std::endl;
-        if (localTargets.find(goalTargetId) != localTargets.end())
+        if (const localMockSimData *goal = localTargets.find(goalTargetId))
         {
             // std::cout << "[Mfr::mfrDetectionAlgo] 목표 표적 ID: " << goalTargetId << std::endl;
-            const auto &goalTarget = localTargets[goalTargetId];
+            const auto &goalTarget = *goal;
             double baseAz = calcBearing(mfrCoords, goalTarget.mockCoords);
 
             std::ostringstream oss;
             oss << std::fixed << std::setprecision(2) << baseAz;
             // stepMotorManager->sendCommand("STOP_MODE:" + oss.str());
 
-            for (const auto &[id, target] : localTargets)
+            // 탐지 범위 안의 표적을 평면 방위 섹터별로 분류
+            for (auto &sector : bearingSectors)
+            {
+                sector.clear();
+            }
+
+            scanDetectionRange(localTargets);
+            for (size_t i = 0; i < scanMocks.size(); ++i)
             {
-                long long distance = calcDistance(mfrCoords, target.mockCoords);
-                if (distance > limitDetectionRange)
+                double distance = 0.0;
+                if (checkDetectionRange(scanMocks[i]->mockCoords, scanDistSq[i], distance))
                 {
-                    continue;
+                    bearingSectors[bearingSector(scanEast[i], scanNorth[i])].push_back(scanMocks[i]);
                 }
+            }
 
-                double az = calcBearing(mfrCoords, target.mockCoords);
-                double diff = angleDiff(baseAz, az);
+            // ±15도 창에 걸치는 섹터 + 평면/대권 방위 오차 여유로 양옆 1섹터만 정밀 방위 계산
+            const int firstSector = static_cast<int>(std::floor((baseAz - ANGLE_MODE_HALF_WIDTH) / BEARING_SECTOR_DEG)) - 1;
+            const int lastSector = static_cast<int>(std::floor((baseAz + ANGLE_MODE_HALF_WIDTH) / BEARING_SECTOR_DEG)) + 1;
 
-                if (std::abs(diff) <= 15.0)
+            for (int s = firstSector; s <= lastSector; ++s)
+            {
+                for (const localMockSimData *target : bearingSectors[(s + BEARING_SECTOR_COUNT) % BEARING_SECTOR_COUNT])
                 {
-                    localDetectedTargets[id] = target;
-
-                    MfrToLcTargetInfo status{};
-                    status.id = target.mockId;
-                    status.targetCoords = encode(target.mockCoords);
-                    status.targetSpeed = target.speed;
-                    status.targetAngle = target.angle;
-                    status.targetAngle2 = target.angle2;
-                    status.firstDetectionTime = nowMs;
-                    status.prioirty = 1;
-                    status.isHit = false;
-
-                    detectedTargetList.push_back(status);
+                    double az = calcBearing(mfrCoords, target->mockCoords);
+                    double diff = angleDiff(baseAz, az);
+
+                    if (std::abs(diff) <= ANGLE_MODE_HALF_WIDTH)
+                    {
+                        localDetectedTargets[target->mockId] = *target;
+
+                        MfrToLcTargetInfo status{};
+                        status.id = target->mockId;
+                        status.targetCoords = encode(target->mockCoords);
+                        status.targetSpeed = target->speed;
+                        status.targetAngle = target->angle;
+                        status.targetAngle2 = target->angle2;
+                        status.firstDetectionTime = targetFirstDetection.mark(status.id, nowMs);
+                        status.prioirty = 1;
+                        status.isHit = false;
+
+                        detectedTargetList.push_back(status);
+                    }
                 }
             }
 
-            for (const auto &[id, missile] : localMissiles)
+            for (uint16_t slot : localMissiles.active)
             {
-                long long distance = calcDistance(mfrCoords, missile.mockCoords);
-                if (distance > limitDetectionRange)
+                const auto &missile = localMissiles.slots[slot];
+                const unsigned int id = missile.mockId;
+                double distance = 0.0;
+                if (!checkDetectionRange(missile.mockCoords, distance))
                 {
                     continue;
                 }
@@ -203,7 +213,7 @@ void Mfr::mfrDetectionAlgo()
                 double az = calcBearing(mfrCoords, missile.mockCoords);
                 double diff = angleDiff(baseAz, az);
 
-                if (std::abs(diff) <= 15.0)
+                if (std::abs(diff) <= ANGLE_MODE_HALF_WIDTH)
                 {
                     localDetectedMissile[id] = missile;
 
@@ -212,7 +222,7 @@ void Mfr::mfrDetectionAlgo()
                     status.missileCoords = encode(missile.mockCoords);
                     status.missileSpeed = missile.speed;
                     status.missileAngle = missile.angle;
-                    status.firstDetectionTime = nowMs;
+                    status.firstDetectionTime = missileFirstDetection.mark(status.id, nowMs);
                     status.isHit = false;
 
                     detectedMissileList.push_back(status);
@@ -223,49 +233,104 @@ void Mfr::mfrDetectionAlgo()
 
     if (!detectedTargetList.empty() || !detectedMissileList.empty())
     {
-        std::vector<char> packet = serializeDetectionPacket(detectedTargetList, detectedMissileList);
-        Logger::log("[Mfr::mfrDetectionAlgo] Sending detection data to LC, Targets: " + std::to_string(detectedTargetList.size()) + ", Missiles: " + std::to_string(detectedMissileList.size()));
-        lcCommManager->send(packet);
+        detectionEncoder.encode(detectedTargetList, detectedMissileList, localTargets.trace, detectionPacket);
+        asynclog::info("[Mfr::mfrDetectionAlgo] Sending detection data to LC, Targets: {}, Missiles: {}, Bytes: {}",
+                       detectedTargetList.size(), detectedMissileList.size(), detectionPacket.size());
+        if (lcCommManager) // initialize() 전 (벤치마크 등 단독 실행)
+        {
+            lcCommManager->send(detectionPacket);
+        }
+
+        static auto &egress = trace::stage("mfr.egress");
+        egress.recordSince(localTargets.trace);
     }
 
+    targetFirstDetection.endCycle();
+    missileFirstDetection.endCycle();
+
     detectedTargets = std::move(localDetectedTargets);
     detectedMissile = std::move(localDetectedMissile);
 }
 
-// util
-double Mfr::deg2rad(const double &deg)
+unsigned long long Mfr::FirstDetection::mark(unsigned int id, unsigned long long nowMs)
 {
-    return deg * M_PI / 180.0;
+    auto it = current.find(id);
+    const unsigned long long first = (it != current.end()) ? it->second : nowMs;
+    next[id] = first;
+    return first;
 }
 
+void Mfr::FirstDetection::endCycle()
+{
+    // 이번 주기에 탐지되지 않은 ID는 다시 탐지되면 새로 시작
+    current.swap(next);
+    next.clear();
+}
+
+// util
 double Mfr::calcDistance(const Pos3D &mfrCoord, const Pos3D &mockCoord)
 {
-    // 위도, 경도 (단위: degree)
-    double mfrLatitudeDeg = mfrCoord.latitude;
-    double mfrLongitudeDeg = mfrCoord.longitude;
-    double mockLatitudeDeg = mockCoord.latitude;
-    double mockLongitudeDeg = mockCoord.longitude;
+    // Haversine (대권 거리) + 고도차
+    const geo::Position origin{mfrCoord.latitude, mfrCoord.longitude, mfrCoord.altitude};
+    return geo::haversineDistance(origin, mockCoord.latitude, mockCoord.longitude, mockCoord.altitude);
+}
 
-    // 위도, 경도 (단위: radian)
-    double mfrLatitudeRad = deg2rad(mfrLatitudeDeg);
-    double mockLatitudeRad = deg2rad(mockLatitudeDeg);
+void Mfr::scanDetectionRange(const MockTable &mocks)
+{
+    const size_t count = mocks.active.size();
+
+    scanMocks.clear();
+    scanLat.resize(count);
+    scanLon.resize(count);
+    scanAlt.resize(count);
+    scanEast.resize(count);
+    scanNorth.resize(count);
+    scanUp.resize(count);
+    scanDistSq.resize(count);
+
+    for (uint16_t slot : mocks.active)
+    {
+        const localMockSimData &mock = mocks.slots[slot];
+        const size_t i = scanMocks.size();
+        scanMocks.push_back(&mock);
+        scanLat[i] = mock.mockCoords.latitude;
+        scanLon[i] = mock.mockCoords.longitude;
+        scanAlt[i] = mock.mockCoords.altitude;
+    }
 
-    // 위도, 경도 변화율 (단위: radian)
-    double deltaLatitude = deg2rad(mockLatitudeDeg - mfrLatitudeDeg);
-    double deltaLongitude = deg2rad(mockLongitudeDeg - mfrLongitudeDeg);
+    geo::enuOffsetBatch(mfrPosition, scanLat.data(), scanLon.data(), scanAlt.data(), count,
+                        scanEast.data(), scanNorth.data(), scanUp.data(), scanDistSq.data());
+}
 
-    // Haversine Formula 적용
-    double sinDelataLatitude = std::sin(deltaLatitude / 2.0);
-    double sinDelataLongitude = std::sin(deltaLongitude / 2.0);
+bool Mfr::checkDetectionRange(const Pos3D &mockCoord, double flatDistSq, double &distance)
+{
+    // 평면 근사 거리 제곱 비교, 경계 부근(±5%)만 Haversine 정밀 판정
+    if (flatDistSq <= prefilterInnerSq)
+    {
+        distance = std::sqrt(flatDistSq);
+        return true;
+    }
+    if (flatDistSq > prefilterOuterSq)
+    {
+        return false;
+    }
 
-    double a = sinDelataLatitude * sinDelataLatitude + std::cos(mfrLatitudeRad) * std::cos(mockLatitudeRad) * sinDelataLongitude * sinDelataLongitude;
-    double c = 2.0 * std::asin(std::sqrt(a));
+    distance = calcDistance(mfrCoords, mockCoord);
+    return distance <= limitDetectionRange;
+}
 
-    double horizontal = EARTH_RADIUS_M * c;
-    double vertical = mockCoord.altitude - mfrCoord.altitude;
-    double dist = std::sqrt(horizontal * horizontal + vertical * vertical);
+bool Mfr::checkDetectionRange(const Pos3D &mockCoord, double &distance)
+{
+    const geo::Enu enu = geo::enuOffset(mfrPosition, mockCoord.latitude, mockCoord.longitude, mockCoord.altitude);
+    return checkDetectionRange(mockCoord, enu.east * enu.east + enu.north * enu.north + enu.up * enu.up, distance);
+}
+
+int Mfr::bearingSector(double east, double north)
+{
+    const double bearing = geo::flatBearing(geo::Enu{east, north, 0.0});
 
-    return dist;
+    int sector = static_cast<int>(bearing / BEARING_SECTOR_DEG);
+    return sector < BEARING_SECTOR_COUNT ? sector : BEARING_SECTOR_COUNT - 1;
 }
 
 EncodedPos3D Mfr::encode(const Pos3D &p)
@@ -293,48 +358,10 @@ unsigned long Mfr::toEpochMillis(const std::chrono::system_clock::time_point &tp
         .count();
 }
 
-std::vector<char> Mfr::serializeDetectionPacket(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles)
-{
-    std::vector<char> buffer;
-
-    buffer.push_back(static_cast<char>(DETECTED_INFO));
-    const char *idPtr = reinterpret_cast<const char *>(&mfrId);
-    buffer.insert(buffer.end(), idPtr, idPtr + sizeof(mfrId));
-    buffer.push_back(static_cast<unsigned char>(targets.size()));
-    buffer.push_back(static_cast<unsigned char>(missiles.size()));
-
-    for (const auto &target : targets)
-    {
-        size_t offset = buffer.size();
-        buffer.resize(offset + sizeof(MfrToLcTargetInfo));
-        std::memcpy(buffer.data() + offset, &target, sizeof(MfrToLcTargetInfo));
-    }
-
-    for (const auto &missile : missiles)
-    {
-        size_t offset = buffer.size();
-        buffer.resize(offset + sizeof(MfrToLcMissileInfo));
-        std::memcpy(buffer.data() + offset, &missile, sizeof(MfrToLcMissileInfo));
-    }
-
-    return buffer;
-}
-
 double Mfr::calcBearing(const Pos3D &mfrCoord, const Pos3D &mockCoord)
 {
-    double mfrLatitudeDeg = mfrCoord.latitude;
-    double mockLatitudeDeg = mockCoord.latitude;
-
-    double mfrLatitudeRad = deg2rad(mfrLatitudeDeg);
-    double mockLatitudeRad = deg2rad(mockLatitudeDeg);
-
-    double deltaLongitude = deg2rad(mockCoord.longitude - mfrCoord.longitude);
-
-    double y = std::sin(deltaLongitude) * std::cos(mockLatitudeRad);
-    double x = std::cos(mfrLatitudeRad) * std::sin(mockLatitudeRad) - std::sin(mfrLatitudeRad) * std::cos(mockLatitudeRad) * std::cos(deltaLongitude);
-    double theta = std::atan2(y, x) * 180.0 / M_PI; // rad → deg
-
-    return std::fmod(theta + 360.0, 360.0);
+    const geo::Position origin{mfrCoord.latitude, mfrCoord.longitude, mfrCoord.altitude};
+    return geo::initialBearing(origin, mockCoord.latitude, mockCoord.longitude);
 }
 
 double Mfr::angleDiff(const double &baseAngle, const double &targetAngle)
@@ -389,17 +416,17 @@ void Mfr::parsingSimData(const std::vector<char> &payload)
 
     if (localSimData.mockId >= 104001 && localSimData.mockId <= 104999) // 표적 정보
     {
-        Logger::log("Target Detected! ID: " + std::to_string(localSimData.mockId));
+        asynclog::info("Target Detected! ID: {}", localSimData.mockId);
         addMockTarget(localSimData);
     }
     else if (localSimData.mockId >= 105001 && localSimData.mockId <= 105999) // 미사일 정보
     {
-        Logger::log("Missile Detected! ID: " + std::to_string(localSimData.mockId));
+        asynclog::info("Missile Detected! ID: {}", localSimData.mockId);
         // addMockMissile(localSimData);
     }
     else
     {
-        Logger::log("[Mfr::handleSimDataPayload] 알 수 없는 ID 범위: " + std::to_string(localSimData.mockId));
+        asynclog::warn("[Mfr::handleSimDataPayload] 알 수 없는 ID 범위: {}", localSimData.mockId);
     }
 }
 
@@ -504,18 +531,54 @@ void Mfr::addMockTarget(const localMockSimData &target)
     //             ", Angle2: " + std::to_string(target.angle2) +
     //             ", Speed: " + std::to_string(target.speed) +
     //             ", is Hit?: " + (target.isHit ? "true" : "false"));
-    // std::lock_guard<std::mutex> lock(m_dataMutex);
-    mockTargets[target.mockId] = target;
+    // 수신 스레드 단일 쓰기, 갱신 즉시 탐지 스레드에 게시
+    mockTargets.upsert(target);
+    mockTargets.publish();
 }
 
 void Mfr::addMockMissile(const localMockSimData &missile)
 {
-    // std::lock_guard<std::mutex> lock(mockMissileMutex);
-    // mockMissile[missile.mockId] = missile;
+    // mockMissile.upsert(missile);
+    // mockMissile.publish();
     // detectedMissile[missile.mockId] = missile;
 }
 
 // public
+void Mfr::callBackTargetBatch(const TargetSimData *targets, size_t count, const trace::Context &batchTrace)
+{
+    static auto &ingress = trace::stage("mfr.ingress");
+    ingress.recordSince(batchTrace);
+
+    size_t rejected = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const TargetSimData &data = targets[i];
+
+        localMockSimData localSimData;
+        localSimData.mockId = data.mockId;
+        localSimData.mockCoords = decode(data.mockCoords);
+        localSimData.angle = data.angle;
+        localSimData.angle2 = data.angle2;
+        localSimData.speed = data.speed;
+        localSimData.isHit = data.isHit;
+
+        // 표적 ID 범위 밖이면 upsert가 거부
+        if (!mockTargets.upsert(localSimData))
+        {
+            ++rejected;
+        }
+    }
+
+    // 배치 전체를 한 번에 게시
+    mockTargets.setTrace(batchTrace);
+    mockTargets.publish();
+
+    if (rejected > 0)
+    {
+        asynclog::warn("[Mfr::callBackTargetBatch] 표적 ID 범위 밖 데이터 {}건 무시", rejected);
+    }
+}
+
 void Mfr::callBackData(const std::vector<char> &packet)
 {
     if (packet.size() < 1)
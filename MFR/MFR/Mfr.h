@@ -4,6 +4,9 @@
 #include "MfrLcCommManager.h"
 #include "StepMotorController.h"
 #include "MfrSimCommManager.h"
+#include "Geodesy.h"
+#include "MockTableBuffer.h"
+#include "DetectionEncoder.h"
 
 #include <thread>
 #include <atomic>
@@ -14,6 +17,7 @@
 #include <mutex>
 #include <shared_mutex>
 #include <map>
+#include <array>
 
 class Mfr : public IReceiver, public std::enable_shared_from_this<Mfr>
 {
@@ -22,20 +26,53 @@ private:
     const unsigned int mfrId = 101001;
     const long long limitDetectionRange = 4000000;
     const Pos3D mfrCoords = {7.5481160, 126.9961166, 244.0};
-    const double EARTH_RADIUS_M = 6'371'000.0; // 지구 반지름 (m)
-    const double SCALE = 1e7;
+    const geo::Position mfrPosition = {mfrCoords.latitude, mfrCoords.longitude, mfrCoords.altitude};
+    const double SCALE = geo::COORD_SCALE;
+
+    // 탐지 사전 필터: 평면 근사 거리가 이 비율 안쪽/바깥쪽이면 Haversine 없이 판정
+    const double PREFILTER_TOLERANCE = 0.05;
+    const double limitDetectionRangeSq = static_cast<double>(limitDetectionRange) * limitDetectionRange;
+    const double prefilterInnerSq = limitDetectionRangeSq * (1.0 - PREFILTER_TOLERANCE) * (1.0 - PREFILTER_TOLERANCE);
+    const double prefilterOuterSq = limitDetectionRangeSq * (1.0 + PREFILTER_TOLERANCE) * (1.0 + PREFILTER_TOLERANCE);
+
+    // ANGLE_MODE 방위 섹터 인덱스 (15도 단위)
+    static constexpr int BEARING_SECTOR_COUNT = 24;
+    static constexpr double BEARING_SECTOR_DEG = 360.0 / BEARING_SECTOR_COUNT;
+    static constexpr double ANGLE_MODE_HALF_WIDTH = 15.0;
 
     bool motorRotationFlag = false;
 
     // shared data
 private:
-    std::mutex m_dataMutex;
-    std::map<unsigned int, localMockSimData> mockTargets;
-    std::unordered_map<unsigned int, localMockSimData> mockMissile;
+    // 수신 스레드가 쓰고 탐지 스레드가 스냅샷으로 읽는 ID 인덱스 표
+    MockTableBuffer mockTargets{104001};
+    MockTableBuffer mockMissile{105001};
 
     std::unordered_map<unsigned int, localMockSimData> detectedTargets;
     std::unordered_map<unsigned int, localMockSimData> detectedMissile;
 
+    // 탐지 스레드 전용, 틱마다 재사용
+    std::array<std::vector<const localMockSimData *>, BEARING_SECTOR_COUNT> bearingSectors;
+    std::vector<const localMockSimData *> scanMocks;
+    std::vector<double> scanLat, scanLon, scanAlt;
+    std::vector<double> scanEast, scanNorth, scanUp, scanDistSq;
+
+    // LC 전송용 탐지 정보 v2 (키프레임 + 델타) 인코더와 송신 버퍼
+    DetectionEncoder detectionEncoder{mfrId};
+    std::vector<char> detectionPacket;
+
+    // ID별 최초 탐지 시각 (ms), 이번 주기에 탐지된 것만 다음 주기로 넘김 (탐지 스레드 전용)
+    struct FirstDetection
+    {
+        std::unordered_map<unsigned int, unsigned long long> current;
+        std::unordered_map<unsigned int, unsigned long long> next;
+
+        unsigned long long mark(unsigned int id, unsigned long long nowMs);
+        void endCycle();
+    };
+    FirstDetection targetFirstDetection;
+    FirstDetection missileFirstDetection;
+
     void addMockMissile(const localMockSimData &missile);
     void addMockTarget(const localMockSimData &target);
     void requestLcInitData();
@@ -56,13 +93,17 @@ private:
     std::thread detectionThread;
     Pos3D lcCoords;
 
-    double deg2rad(const double &deg);
     double calcDistance(const Pos3D &mfrCoord, const Pos3D &mockCoord);
     double calcBearing(const Pos3D &mfrCoord, const Pos3D &mockCoord);
+
+    // mfrCoords 기준 로컬 ENU 평면 근사를 배치로 계산 (scan* 배열에 기록)
+    void scanDetectionRange(const MockTable &mocks);
+    bool checkDetectionRange(const Pos3D &mockCoord, double flatDistSq, double &distance);
+    bool checkDetectionRange(const Pos3D &mockCoord, double &distance);
+    int bearingSector(double east, double north);
     EncodedPos3D encode(const Pos3D &p);
     Pos3D decode(const EncodedPos3D &e);
     unsigned long toEpochMillis(const std::chrono::system_clock::time_point &tp);
-    std::vector<char> serializeDetectionPacket(const std::vector<MfrToLcTargetInfo> &targets, const std::vector<MfrToLcMissileInfo> &missiles);
     double angleDiff(const double &baseAngle, const double &targetAngle);
 
     template <typename T>
@@ -99,4 +140,5 @@ public:
     void stopDetectionThread();
 
     void callBackData(const std::vector<char> &packet) override;
+    void callBackTargetBatch(const TargetSimData *targets, size_t count, const trace::Context &batchTrace) override;
 };
\ No newline at end of file
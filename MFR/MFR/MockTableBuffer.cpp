@@ -0,0 +1,96 @@
+#include "MockTableBuffer.h"
+
+const localMockSimData *MockTable::find(unsigned int id) const
+{
+    if (id < idBase || id - idBase >= SLOT_COUNT)
+    {
+        return nullptr;
+    }
+
+    const size_t slot = id - idBase;
+    return present[slot] ? &slots[slot] : nullptr;
+}
+
+MockTableBuffer::MockTableBuffer(unsigned int idBase)
+    : middle_(2)
+{
+    master_.idBase = idBase;
+    master_.active.reserve(MockTable::SLOT_COUNT);
+
+    for (auto &table : buffers_)
+    {
+        table.idBase = idBase;
+        table.active.reserve(MockTable::SLOT_COUNT);
+    }
+}
+
+bool MockTableBuffer::upsert(const localMockSimData &mock)
+{
+    if (mock.mockId < master_.idBase || mock.mockId - master_.idBase >= MockTable::SLOT_COUNT)
+    {
+        return false;
+    }
+
+    const uint16_t slot = static_cast<uint16_t>(mock.mockId - master_.idBase);
+    if (!master_.present[slot])
+    {
+        master_.present[slot] = 1;
+        master_.active.push_back(slot);
+    }
+    master_.slots[slot] = mock;
+
+    writeLog_[logHead_ & (LOG_CAPACITY - 1)] = slot;
+    ++logHead_;
+    return true;
+}
+
+void MockTableBuffer::syncFromMaster(MockTable &table)
+{
+    if (logHead_ - table.syncedHead > LOG_CAPACITY)
+    {
+        // 로그가 덮어써질 만큼 뒤처졌으면 전체 활성 슬롯 복사
+        for (uint16_t slot : master_.active)
+        {
+            table.slots[slot] = master_.slots[slot];
+        }
+    }
+    else
+    {
+        // 마지막 동기화 이후 갱신된 슬롯만 복사
+        for (uint64_t pos = table.syncedHead; pos != logHead_; ++pos)
+        {
+            const uint16_t slot = writeLog_[pos & (LOG_CAPACITY - 1)];
+            table.slots[slot] = master_.slots[slot];
+        }
+    }
+
+    table.present = master_.present;
+    table.active.assign(master_.active.begin(), master_.active.end()); // 용량 예약으로 재할당 없음
+    table.syncedHead = logHead_;
+    table.trace = master_.trace;
+}
+
+void MockTableBuffer::publish()
+{
+    MockTable &back = buffers_[back_];
+    if (back.syncedHead == logHead_)
+    {
+        return;
+    }
+
+    syncFromMaster(back);
+
+    // 뒤 버퍼를 게시하고 이전 게시 버퍼(또는 읽기 측이 반납한 버퍼)를 새 뒤 버퍼로 가져옴
+    const uint8_t previous = middle_.exchange(static_cast<uint8_t>(back_ | DIRTY_BIT), std::memory_order_acq_rel);
+    back_ = previous & INDEX_MASK;
+}
+
+const MockTable &MockTableBuffer::acquire()
+{
+    if (middle_.load(std::memory_order_relaxed) & DIRTY_BIT)
+    {
+        const uint8_t previous = middle_.exchange(front_, std::memory_order_acq_rel);
+        front_ = previous & INDEX_MASK;
+    }
+    return buffers_[front_];
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "PacketProtocol.h"
+#include "Trace.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ID 범위(xxx001 ~ xxx999)를 슬롯 번호로 직접 매핑하는 평면 표
+struct MockTable
+{
+    static constexpr size_t SLOT_COUNT = 999;
+
+    unsigned int idBase = 0; // 슬롯 0에 대응하는 ID (예: 104001)
+    std::array<localMockSimData, SLOT_COUNT> slots{};
+    std::array<uint8_t, SLOT_COUNT> present{};
+    std::vector<uint16_t> active; // 사용 중인 슬롯 목록 (등록 순)
+    uint64_t syncedHead = 0;      // 이 버퍼에 반영된 쓰기 로그 위치
+    trace::Context trace;         // 마지막으로 반영한 배치의 지연 추적 정보
+
+    // 없는 ID면 nullptr
+    const localMockSimData *find(unsigned int id) const;
+};
+
+// 수신 스레드(쓰기 1개) → 탐지 스레드(읽기 1개) 무잠금 3중 버퍼
+// 쓰기 측은 원본 표를 갱신한 뒤 publish()로 변경 슬롯만 뒤 버퍼에 반영하고 인덱스를 교환하며,
+// 읽기 측은 acquire()로 가장 최근에 게시된 표를 복사 없이 참조한다.
+// acquire()가 반환한 표는 다음 acquire() 호출 전까지 쓰기 측이 건드리지 않는다.
+class MockTableBuffer
+{
+public:
+    explicit MockTableBuffer(unsigned int idBase);
+
+    MockTableBuffer(const MockTableBuffer &) = delete;
+    MockTableBuffer &operator=(const MockTableBuffer &) = delete;
+
+    // 쓰기 스레드 전용
+    bool upsert(const localMockSimData &mock); // ID 범위 밖이면 false
+    void setTrace(const trace::Context &trace) { master_.trace = trace; }
+    void publish();
+
+    // 읽기 스레드 전용
+    const MockTable &acquire();
+
+private:
+    static constexpr size_t LOG_CAPACITY = 4096; // 2의 거듭제곱
+    static constexpr uint8_t INDEX_MASK = 0x03;
+    static constexpr uint8_t DIRTY_BIT = 0x04;
+
+    MockTable master_;                 // 쓰기 측 원본
+    std::array<MockTable, 3> buffers_; // back / middle / front
+    std::atomic<uint8_t> middle_;      // 게시된 버퍼 인덱스 | DIRTY_BIT
+    uint8_t back_ = 0;                 // 쓰기 측 소유
+    uint8_t front_ = 1;                // 읽기 측 소유
+
+    std::array<uint16_t, LOG_CAPACITY> writeLog_{}; // 갱신된 슬롯 기록 (링)
+    uint64_t logHead_ = 0;
+
+    void syncFromMaster(MockTable &table);
+};
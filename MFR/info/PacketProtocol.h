@@ -92,7 +92,7 @@ struct MfrToLcMissileInfo   // 4 + (8*3) + 4 + 8 + 8 + 8 + 1 = 57 bytes
     bool isHit;
 };
 
-struct MfrToLcTargetInfo    // 4 + (8*3) + 4 + 8 + 8 + 1 + 1 = 50 bytes
+struct MfrToLcTargetInfo    // 4 + (8*3) + 4 + 8 + 8 + 8 + 1 + 1 = 58 bytes
 {
     unsigned int id;       
     EncodedPos3D targetCoords;
@@ -108,7 +108,8 @@ enum sendPacketType : uint8_t
 {
     STATUS_RES = 0x21,
     DETECTED_INFO = 0x22,
-    LC_INIT_REQ = 0x23
+    LC_INIT_REQ = 0x23,
+    DETECTED_INFO_V2 = 0x24 // 키프레임 + 델타 (Common/DetectionDelta.h)
 };
 
 enum RadarMode : uint8_t 
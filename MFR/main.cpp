@@ -2,9 +2,13 @@
 
 #include "Mfr.h"
 #include "MfrConfig.h"
+#include "Trace.h"
 
 int main()
 {
+    // 스레드를 만들기 전에 등록 (SIGUSR1 → 단계별 지연 출력)
+    trace::installDumpSignal();
+
     MfrConfig &config = MfrConfig::getInstance();
     if (!config.loadConfig("./../Config/MFR.ini"))
     {
@@ -78,6 +78,40 @@ bool loadConfig(const std::string &filepath, ConfigCommon &config)
                 config.LSRecvPort = std::stoi(value);
             }
         }
+        else if (currentSection == "Engine")
+        {
+            if (key == "StepMs")
+            {
+                config.EngineStepMs = std::stoi(value);
+            }
+            else if (key == "PublishMs")
+            {
+                config.EnginePublishMs = std::stoi(value);
+            }
+            else if (key == "TimeScale")
+            {
+                config.EngineTimeScale = std::stod(value);
+            }
+            else if (key == "Workers")
+            {
+                config.EngineWorkers = std::stoi(value);
+            }
+            else if (key == "ChunkSize")
+            {
+                config.EngineChunkSize = std::stoi(value);
+            }
+        }
+        else if (currentSection == "Missile")
+        {
+            if (key == "MaxInFlight")
+            {
+                config.MissileMaxInFlight = std::stoi(value);
+            }
+            else if (key == "MaxFlightSec")
+            {
+                config.MissileMaxFlightSec = std::stod(value);
+            }
+        }
     }
 
     file.close();
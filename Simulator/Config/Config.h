@@ -9,6 +9,15 @@ struct ConfigCommon
     int LSRecvPort = 0;    // Launch Simulator Port
     std::string MFRSendIP; // Launch Controller IP
     int MFRSendPort = 0;   // Launch Controller Port
+
+    int EngineStepMs = 10;       // 물리 고정 스텝 (ms)
+    int EnginePublishMs = 100;   // MFR 송신 주기 (ms)
+    double EngineTimeScale = 1.0; // 실시간 대비 배속
+    int EngineWorkers = 0;       // 작업 스레드 수 (0: 자동)
+    int EngineChunkSize = 1024;  // 작업 스레드 청크 크기
+
+    int MissileMaxInFlight = 64;      // 동시 비행 미사일 수
+    double MissileMaxFlightSec = 120; // 미사일 최대 비행 시간 (s)
 };
 
 // 공백 제거 및 문자열 처리 유틸 함수 선언
@@ -0,0 +1,107 @@
+#include "EntityTable.h"
+
+#include <cmath>
+
+#include "Geodesy.h"
+
+void EntityTable::reserve(size_t n)
+{
+	id.reserve(n);
+	lat.reserve(n);
+	lon.reserve(n);
+	alt.reserve(n);
+	v_north.reserve(n);
+	v_east.reserve(n);
+	v_up.reserve(n);
+	speed.reserve(n);
+	angle.reserve(n);
+	angle2.reserve(n);
+	is_hit.reserve(n);
+	spawn_time.reserve(n);
+}
+
+void EntityTable::clear()
+{
+	id.clear();
+	lat.clear();
+	lon.clear();
+	alt.clear();
+	v_north.clear();
+	v_east.clear();
+	v_up.clear();
+	speed.clear();
+	angle.clear();
+	angle2.clear();
+	is_hit.clear();
+	spawn_time.clear();
+}
+
+size_t EntityTable::push(unsigned int entity_id, long long x, long long y, long long z, int speed_kmh, double angle_deg, double angle2_deg, double spawn_sec)
+{
+	const double speed_mps = speed_kmh * geo::KMH_TO_MPS;
+	const double angle_rad = angle_deg * geo::DEG_TO_RAD;
+	const double angle_z_rad = angle2_deg * geo::DEG_TO_RAD;
+
+	id.push_back(entity_id);
+	lat.push_back(static_cast<double>(x) / geo::COORD_SCALE);
+	lon.push_back(static_cast<double>(y) / geo::COORD_SCALE);
+	alt.push_back(static_cast<double>(z));
+	v_north.push_back(std::cos(angle_rad) * speed_mps);
+	v_east.push_back(std::sin(angle_rad) * speed_mps);
+	v_up.push_back(std::tan(angle_z_rad) * speed_mps);
+	speed.push_back(speed_kmh);
+	angle.push_back(angle_deg);
+	angle2.push_back(angle2_deg);
+	is_hit.push_back(0);
+	spawn_time.push_back(spawn_sec);
+
+	return id.size() - 1;
+}
+
+void EntityTable::swapRemove(size_t index)
+{
+	const size_t last = id.size() - 1;
+	if (index != last)
+	{
+		id[index] = id[last];
+		lat[index] = lat[last];
+		lon[index] = lon[last];
+		alt[index] = alt[last];
+		v_north[index] = v_north[last];
+		v_east[index] = v_east[last];
+		v_up[index] = v_up[last];
+		speed[index] = speed[last];
+		angle[index] = angle[last];
+		angle2[index] = angle2[last];
+		is_hit[index] = is_hit[last];
+		spawn_time[index] = spawn_time[last];
+	}
+
+	id.pop_back();
+	lat.pop_back();
+	lon.pop_back();
+	alt.pop_back();
+	v_north.pop_back();
+	v_east.pop_back();
+	v_up.pop_back();
+	speed.pop_back();
+	angle.pop_back();
+	angle2.pop_back();
+	is_hit.pop_back();
+	spawn_time.pop_back();
+}
+
+long long EntityTable::encodedLat(size_t index) const
+{
+	return static_cast<long long>(lat[index] * geo::COORD_SCALE);
+}
+
+long long EntityTable::encodedLon(size_t index) const
+{
+	return static_cast<long long>(lon[index] * geo::COORD_SCALE);
+}
+
+long long EntityTable::encodedAlt(size_t index) const
+{
+	return static_cast<long long>(alt[index]);
+}
@@ -0,0 +1,43 @@
+#ifndef ENTITY_TABLE_H
+#define ENTITY_TABLE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// 표적/미사일 상태를 필드별 배열(SoA)로 보관하는 테이블
+// 위치는 내부적으로 실수(도, m)로 유지하고, 송신 시에만 1e7 정수로 인코딩한다.
+struct EntityTable
+{
+	std::vector<unsigned int> id;
+	std::vector<double> lat;	 // 위도 (deg)
+	std::vector<double> lon;	 // 경도 (deg)
+	std::vector<double> alt;	 // 고도 (m)
+	std::vector<double> v_north; // 북쪽 속도 성분 (m/s)
+	std::vector<double> v_east;	 // 동쪽 속도 성분 (m/s)
+	std::vector<double> v_up;	 // 수직 속도 성분 (m/s)
+	std::vector<int> speed;		 // 속도 (km/h, 송신용 원본)
+	std::vector<double> angle;	 // 방위각 (deg)
+	std::vector<double> angle2;	 // 고도각 (deg)
+	std::vector<uint8_t> is_hit;
+	std::vector<double> spawn_time; // 생성 시각 (시뮬레이션 시간, s)
+
+	size_t size() const { return id.size(); }
+	bool empty() const { return id.empty(); }
+
+	void reserve(size_t n);
+	void clear();
+
+	// 1e7 스케일 정수 좌표로 행 추가, 추가된 인덱스 반환
+	size_t push(unsigned int entity_id, long long x, long long y, long long z, int speed_kmh, double angle_deg, double angle2_deg, double spawn_sec = 0.0);
+
+	// 마지막 행과 자리를 바꿔 O(1) 삭제 (순서는 유지되지 않음)
+	void swapRemove(size_t index);
+
+	// 송신용 1e7 스케일 정수 좌표
+	long long encodedLat(size_t index) const;
+	long long encodedLon(size_t index) const;
+	long long encodedAlt(size_t index) const;
+};
+
+#endif // ENTITY_TABLE_H
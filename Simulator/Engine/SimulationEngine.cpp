@@ -0,0 +1,154 @@
+#include "SimulationEngine.h"
+
+#include <cmath>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+
+#include "Geodesy.h"
+
+namespace
+{
+	size_t resolveWorkerCount(int requested)
+	{
+		if (requested > 0)
+		{
+			return static_cast<size_t>(requested);
+		}
+		const unsigned int cores = std::thread::hardware_concurrency();
+		return cores > 1 ? cores - 1 : 0; // 호출(엔진) 스레드도 청크를 처리함
+	}
+}
+
+SimulationEngine::SimulationEngine(const EngineOptions &options)
+	: options_(options),
+	  step_sec_(std::max(options.step_ms, 1) / 1000.0),
+	  pool_(resolveWorkerCount(options.workers))
+{
+}
+
+SimulationEngine::~SimulationEngine()
+{
+	stop();
+}
+
+void SimulationEngine::start()
+{
+	if (running_)
+	{
+		return;
+	}
+
+	std::cout << "[SimulationEngine] step " << step_sec_ * 1000.0 << " ms, x" << options_.time_scale
+			  << ", workers " << pool_.workerCount() << std::endl;
+
+	running_ = true;
+	engine_thread_ = std::thread(&SimulationEngine::run, this);
+}
+
+void SimulationEngine::stop()
+{
+	running_ = false;
+	if (engine_thread_.joinable())
+	{
+		engine_thread_.join();
+	}
+}
+
+void SimulationEngine::run()
+{
+	using clock = std::chrono::steady_clock;
+
+	const bool paced = options_.time_scale > 0.0;
+	const auto wall_step = std::chrono::duration_cast<clock::duration>(
+		std::chrono::duration<double>(paced ? step_sec_ / options_.time_scale : 0.0));
+
+	auto next_tick = clock::now();
+	while (running_)
+	{
+		step();
+
+		if (!paced)
+		{
+			continue;
+		}
+
+		// 드리프트 없이 절대 시각 기준으로 대기, 1초 이상 밀리면 따라잡지 않고 재동기화
+		next_tick += wall_step;
+		const auto now = clock::now();
+		if (now - next_tick > std::chrono::seconds(1))
+		{
+			next_tick = now;
+		}
+		std::this_thread::sleep_until(next_tick);
+	}
+}
+
+void SimulationEngine::step()
+{
+	applyPendingSpawns();
+
+	integrate(targets_);
+	integrate(missiles_);
+
+	++tick_;
+
+	if (tick_handler_)
+	{
+		tick_handler_(tick_);
+	}
+}
+
+void SimulationEngine::spawnMissile(const MissileInfo &missile)
+{
+	std::lock_guard<std::mutex> lock(spawn_mutex_);
+	pending_missiles_.push_back(missile);
+}
+
+void SimulationEngine::reserveMissiles(size_t capacity)
+{
+	std::lock_guard<std::mutex> lock(spawn_mutex_);
+	missiles_.reserve(capacity);
+	pending_missiles_.reserve(capacity);
+}
+
+void SimulationEngine::applyPendingSpawns()
+{
+	std::lock_guard<std::mutex> lock(spawn_mutex_);
+	const double now = simTime();
+	for (const auto &m : pending_missiles_)
+	{
+		missiles_.push(m.id, m.x, m.y, m.z, m.speed, m.angle, m.angle2, now);
+	}
+	pending_missiles_.clear();
+}
+
+void SimulationEngine::integrate(EntityTable &table)
+{
+	const double dt = step_sec_;
+
+	double *lat = table.lat.data();
+	double *lon = table.lon.data();
+	double *alt = table.alt.data();
+	const double *v_north = table.v_north.data();
+	const double *v_east = table.v_east.data();
+	const double *v_up = table.v_up.data();
+	const uint8_t *is_hit = table.is_hit.data();
+
+	pool_.parallelFor(table.size(), options_.chunk_size, [=](size_t begin, size_t end)
+					  {
+		for (size_t i = begin; i < end; ++i)
+		{
+			if (is_hit[i])
+			{
+				continue;
+			}
+
+			// 현재 위도 기준 경도 m/deg 계산
+			const double meters_per_deg_lon = geo::metersPerDegLon(lat[i]);
+
+			lat[i] += v_north[i] * dt / geo::METERS_PER_DEG_LAT;
+			lon[i] += v_east[i] * dt / meters_per_deg_lon;
+			alt[i] += v_up[i] * dt;
+		} });
+}
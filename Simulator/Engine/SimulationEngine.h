@@ -0,0 +1,81 @@
+#ifndef SIMULATION_ENGINE_H
+#define SIMULATION_ENGINE_H
+
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <functional>
+#include <vector>
+#include <cstdint>
+
+#include "EntityTable.h"
+#include "WorkerPool.h"
+#include "MissileInfo.h"
+
+struct EngineOptions
+{
+	int step_ms = 10;		  // 물리 고정 스텝 (ms, 시뮬레이션 시간)
+	double time_scale = 1.0;  // 실시간 대비 배속, 0 이하이면 대기 없이 최대 속도로 진행
+	int workers = 0;		  // 작업 스레드 수, 0이면 (코어 수 - 1)
+	size_t chunk_size = 1024; // 작업 스레드에 한 번에 나눠주는 엔티티 수
+};
+
+// 모든 표적/미사일을 고정 스텝으로 갱신하는 단일 시뮬레이션 엔진
+// 상태 테이블은 엔진 스레드만 수정하며, 외부 스레드의 미사일 생성은 큐를 거쳐 다음 틱에 반영된다.
+class SimulationEngine
+{
+public:
+	using TickHandler = std::function<void(uint64_t tick)>;
+
+	explicit SimulationEngine(const EngineOptions &options);
+	~SimulationEngine();
+
+	SimulationEngine(const SimulationEngine &) = delete;
+	SimulationEngine &operator=(const SimulationEngine &) = delete;
+
+	void start();
+	void stop();
+
+	// 한 스텝 진행 (적분 후 틱 핸들러 호출)
+	void step();
+
+	// 매 스텝 적분이 끝난 뒤 엔진 스레드에서 호출됨
+	void setTickHandler(TickHandler handler) { tick_handler_ = std::move(handler); }
+
+	// 다른 스레드에서 호출 가능, 다음 스텝 시작 시 미사일 테이블에 추가됨
+	void spawnMissile(const MissileInfo &missile);
+
+	// 시작 전 호출, 미사일 테이블과 생성 큐를 최대 동시 비행 수만큼 미리 할당
+	void reserveMissiles(size_t capacity);
+
+	EntityTable &targets() { return targets_; }
+	EntityTable &missiles() { return missiles_; }
+
+	double stepSeconds() const { return step_sec_; }
+	uint64_t tickCount() const { return tick_; }
+	double simTime() const { return tick_ * step_sec_; }
+
+private:
+	EngineOptions options_;
+	double step_sec_;
+
+	EntityTable targets_;
+	EntityTable missiles_;
+
+	WorkerPool pool_;
+	TickHandler tick_handler_;
+	uint64_t tick_ = 0;
+
+	std::mutex spawn_mutex_;
+	std::vector<MissileInfo> pending_missiles_;
+
+	std::atomic<bool> running_{false};
+	std::thread engine_thread_;
+
+	void run();
+	void applyPendingSpawns();
+	void integrate(EntityTable &table);
+};
+
+#endif // SIMULATION_ENGINE_H
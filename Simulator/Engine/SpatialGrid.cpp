@@ -0,0 +1,52 @@
+#include "SpatialGrid.h"
+
+#include <cmath>
+
+#include "Geodesy.h"
+
+constexpr double MIN_COS_LAT = 0.01;			   // 극지방에서 경도 셀 크기 상한
+constexpr double CELL_BIAS = 2147483648.0;		   // 음수 셀 좌표를 부호 없는 키 순서로 맞추기 위한 오프셋 (2^31)
+
+SpatialGrid::SpatialGrid(double cell_size_m)
+	: cell_size_m_(cell_size_m)
+{
+}
+
+uint32_t SpatialGrid::cellX(double lon) const
+{
+	return static_cast<uint32_t>(static_cast<int64_t>(std::floor(lon / cell_lon_deg_) + CELL_BIAS));
+}
+
+uint32_t SpatialGrid::cellY(double lat) const
+{
+	return static_cast<uint32_t>(static_cast<int64_t>(std::floor(lat / cell_lat_deg_) + CELL_BIAS));
+}
+
+void SpatialGrid::rebuild(const EntityTable &table)
+{
+	entries_.clear();
+
+	// 경도 1도당 거리는 고위도일수록 짧아지므로 가장 높은 위도 기준으로 셀 폭을 잡아야 반경을 놓치지 않음
+	double max_abs_lat = 0.0;
+	for (size_t i = 0; i < table.size(); ++i)
+	{
+		max_abs_lat = std::max(max_abs_lat, std::fabs(table.lat[i]));
+	}
+	const double cos_lat = std::max(std::cos(max_abs_lat * geo::DEG_TO_RAD), MIN_COS_LAT);
+
+	cell_lat_deg_ = cell_size_m_ / geo::METERS_PER_DEG_LAT;
+	cell_lon_deg_ = cell_size_m_ / (geo::METERS_PER_DEG_LAT * cos_lat);
+
+	entries_.reserve(table.size());
+	for (size_t i = 0; i < table.size(); ++i)
+	{
+		if (table.is_hit[i])
+		{
+			continue;
+		}
+		entries_.push_back({makeKey(cellX(table.lon[i]), cellY(table.lat[i])), static_cast<uint32_t>(i)});
+	}
+
+	std::sort(entries_.begin(), entries_.end(), [](const Entry &a, const Entry &b)
+			  { return a.key < b.key; });
+}
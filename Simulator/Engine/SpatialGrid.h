@@ -0,0 +1,66 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include "EntityTable.h"
+
+// 위도/경도 균일 격자 인덱스 (셀 크기 >= 탐색 반경)
+// 매 스텝 rebuild 후 질의 지점이 속한 셀과 주변 8개 셀의 항목만 후보로 돌려준다.
+// 반환하는 인덱스는 rebuild 이후 테이블 행 삭제/추가 전까지만 유효하다.
+class SpatialGrid
+{
+public:
+	explicit SpatialGrid(double cell_size_m);
+
+	void rebuild(const EntityTable &table);
+
+	// (lat, lon) 주변 3x3 셀의 행 인덱스마다 func(index) 호출
+	template <typename Func>
+	void forEachNear(double lat, double lon, Func &&func) const
+	{
+		if (entries_.empty())
+		{
+			return;
+		}
+
+		const uint32_t cx = cellX(lon);
+		const uint32_t cy = cellY(lat);
+
+		// 같은 cx 안에서 cy-1 ~ cy+1 은 키가 연속이므로 열마다 구간 하나만 탐색
+		for (uint32_t x = cx - 1; x != cx + 2; ++x)
+		{
+			auto it = std::lower_bound(entries_.begin(), entries_.end(), makeKey(x, cy - 1), keyLess);
+			const uint64_t last = makeKey(x, cy + 1);
+			for (; it != entries_.end() && it->key <= last; ++it)
+			{
+				func(static_cast<size_t>(it->index));
+			}
+		}
+	}
+
+	double cellSize() const { return cell_size_m_; }
+
+private:
+	struct Entry
+	{
+		uint64_t key;
+		uint32_t index;
+	};
+
+	double cell_size_m_;
+	double cell_lat_deg_ = 0.0;
+	double cell_lon_deg_ = 0.0;
+	std::vector<Entry> entries_; // key 기준 정렬
+
+	uint32_t cellX(double lon) const;
+	uint32_t cellY(double lat) const;
+
+	static uint64_t makeKey(uint32_t cx, uint32_t cy) { return (static_cast<uint64_t>(cx) << 32) | cy; }
+	static bool keyLess(const Entry &entry, uint64_t key) { return entry.key < key; }
+};
+
+#endif // SPATIAL_GRID_H
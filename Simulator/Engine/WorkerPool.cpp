@@ -0,0 +1,106 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(size_t worker_count)
+{
+	workers_.reserve(worker_count);
+	for (size_t i = 0; i < worker_count; ++i)
+	{
+		workers_.emplace_back(&WorkerPool::workerLoop, this);
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		stop_ = true;
+	}
+	start_cv_.notify_all();
+
+	for (auto &worker : workers_)
+	{
+		if (worker.joinable())
+		{
+			worker.join();
+		}
+	}
+}
+
+void WorkerPool::parallelFor(size_t count, size_t chunk_size, const RangeFunc &func)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	chunk_size = std::max<size_t>(chunk_size, 1);
+
+	// 청크 하나 분량이거나 작업 스레드가 없으면 호출 스레드에서 바로 처리
+	if (workers_.empty() || count <= chunk_size)
+	{
+		func(0, count);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		job_ = &func;
+		job_count_ = count;
+		job_chunk_ = chunk_size;
+		next_begin_.store(0, std::memory_order_relaxed);
+		busy_workers_ = workers_.size();
+		++generation_;
+	}
+	start_cv_.notify_all();
+
+	runChunks();
+
+	std::unique_lock<std::mutex> lock(mutex_);
+	done_cv_.wait(lock, [this]()
+				  { return busy_workers_ == 0; });
+	job_ = nullptr;
+}
+
+void WorkerPool::workerLoop()
+{
+	unsigned long long seen_generation = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			start_cv_.wait(lock, [&]()
+						   { return stop_ || generation_ != seen_generation; });
+			if (stop_)
+			{
+				return;
+			}
+			seen_generation = generation_;
+		}
+
+		runChunks();
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (--busy_workers_ == 0)
+			{
+				done_cv_.notify_one();
+			}
+		}
+	}
+}
+
+void WorkerPool::runChunks()
+{
+	while (true)
+	{
+		const size_t begin = next_begin_.fetch_add(job_chunk_, std::memory_order_relaxed);
+		if (begin >= job_count_)
+		{
+			break;
+		}
+		(*job_)(begin, std::min(begin + job_chunk_, job_count_));
+	}
+}
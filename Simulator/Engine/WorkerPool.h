@@ -0,0 +1,49 @@
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstddef>
+
+// 고정 개수의 작업 스레드에 [begin, end) 구간을 청크 단위로 분배하는 풀
+// 호출 스레드도 청크 처리에 참여하며, parallelFor는 모든 청크가 끝난 뒤 반환한다.
+class WorkerPool
+{
+public:
+	using RangeFunc = std::function<void(size_t begin, size_t end)>;
+
+	explicit WorkerPool(size_t worker_count);
+	~WorkerPool();
+
+	WorkerPool(const WorkerPool &) = delete;
+	WorkerPool &operator=(const WorkerPool &) = delete;
+
+	void parallelFor(size_t count, size_t chunk_size, const RangeFunc &func);
+
+	size_t workerCount() const { return workers_.size(); }
+
+private:
+	std::vector<std::thread> workers_;
+
+	std::mutex mutex_;
+	std::condition_variable start_cv_;
+	std::condition_variable done_cv_;
+
+	const RangeFunc *job_ = nullptr;
+	size_t job_count_ = 0;
+	size_t job_chunk_ = 1;
+	std::atomic<size_t> next_begin_{0};
+
+	unsigned long long generation_ = 0; // parallelFor 호출마다 증가
+	size_t busy_workers_ = 0;
+	bool stop_ = false;
+
+	void workerLoop();
+	void runChunks();
+};
+
+#endif // WORKER_POOL_H
@@ -1,58 +1,130 @@
 #include <iostream>
+#include <algorithm>
 #include "MockMissileManager.h"
 #include "CommonPacket.h"
 #include "MissileInfo.h"
-#include "MockMissile.h"
+#include "AsyncLog.h"
 
 // 생성자 정의
 MockMissileManager::MockMissileManager(std::shared_ptr<MockTargetManager> target_manager,
-									   std::shared_ptr<MFRSendUDPManager> mfr_send_manager)
-	: mock_target_manager_(target_manager), mfr_send_manager_(mfr_send_manager)
+									   std::shared_ptr<MFRSendUDPManager> mfr_send_manager,
+									   std::shared_ptr<SimulationEngine> engine,
+									   const MissilePoolOptions &options)
+	: mock_target_manager_(target_manager), mfr_send_manager_(mfr_send_manager), engine_(engine), options_(options)
 {
+	options_.max_in_flight = std::min<size_t>(std::max<size_t>(options_.max_in_flight, 1), MISSILE_ID_MAX);
+
+	// 비행 중 재할당이 없도록 미사일 슬랩을 미리 확보
+	engine_->reserveMissiles(options_.max_in_flight);
+
+	for (int i = 1; i <= MISSILE_ID_MAX; ++i)
+	{
+		free_ids_.push_back(i);
+	}
 }
 
-// 미사일 ID 업데이트
-void MockMissileManager::updateMissileID()
+// 미사일 ID 할당
+bool MockMissileManager::acquireMissileID(int &missile_id)
 {
-	// 미사일 ID를 업데이트하는 로직을 구현합니다.
-	// 예를 들어, 마지막 미사일 ID를 증가시킬 수 있습니다.
-	if (last_missile_id_ >= 999)
+	std::lock_guard<std::mutex> lock(id_mutex_);
+	if (in_flight_ >= options_.max_in_flight || free_ids_.empty())
 	{
-		std::cerr << "Error: Maximum missile ID reached." << std::endl;
-		return;
+		return false;
 	}
-	last_missile_id_++;
 
-	// 식별자 100을 앞에 추가하여 ID 생성
-	last_missile_info_.id = 105 * 1000 + last_missile_id_;
+	// 식별자 105를 앞에 추가하여 ID 생성
+	missile_id = MISSILE_ID_BASE + free_ids_.front();
+	free_ids_.pop_front();
+	++in_flight_;
+	return true;
 }
 
-void MockMissileManager::flightMissile(const MissileInfo &MissileInfo)
+// 미사일 ID 반납
+void MockMissileManager::releaseMissileID(unsigned int missile_id)
 {
-	if (is_flight_)
+	std::lock_guard<std::mutex> lock(id_mutex_);
+	free_ids_.push_back(static_cast<int>(missile_id) - MISSILE_ID_BASE);
+	--in_flight_;
+}
+
+void MockMissileManager::flightMissile(const MissileInfo &missile_info)
+{
+	int missile_id = 0;
+	if (!acquireMissileID(missile_id))
 	{
-		std::cout << "Missile is already in flight." << std::endl;
+		asynclog::warn("Missile pool is full ({} in flight).", options_.max_in_flight);
 		return;
 	}
-	else
+
+	asynclog::info("Missile flight success. ID {} ({} in flight)", missile_id, in_flight_.load());
+
+	MissileInfo missile = missile_info;
+	missile.cmd = recvPacketType::SIM_MOCK_DATA;
+	missile.id = missile_id;
+
+	// 다음 엔진 스텝부터 공용 시뮬레이션 틱에서 갱신됨
+	engine_->spawnMissile(missile);
+}
+
+void MockMissileManager::updatePosMissile()
+{
+	auto &missiles = engine_->missiles();
+	if (missiles.empty())
 	{
-		std::cout << "Missile flight success." << std::endl;
+		return;
 	}
 
-	// flight_thread동작중인지 체크
-	last_missile_info_ = MissileInfo;
-	last_missile_info_.cmd = recvPacketType::SIM_MOCK_DATA;
+	// 이번 스텝 표적 위치로 격자를 한 번만 재구성, 이후 미사일별로 주변 셀만 조회
+	mock_target_manager_->updateTargetIndex();
 
-	updateMissileID();
+	const double now = engine_->simTime();
+	for (size_t i = missiles.size(); i-- > 0;)
+	{
+		// 명중 판정
+		if (mock_target_manager_->downTargetStatus(missiles.lat[i], missiles.lon[i], missiles.alt[i]) > 0)
+		{
+			asynclog::info("Missile {} hit target!", missiles.id[i]);
+			missiles.is_hit[i] = 1;
+			sendData(i);
+		}
+		// 지면 충돌 또는 최대 비행 시간 초과 시 소멸
+		else if (missiles.alt[i] < 0.0 || now - missiles.spawn_time[i] > options_.max_flight_sec)
+		{
+			asynclog::info("Missile {} lost.", missiles.id[i]);
+		}
+		else
+		{
+			continue;
+		}
 
-	std::cout << last_missile_info_.id << std::endl;
+		releaseMissileID(missiles.id[i]);
+		missiles.swapRemove(i);
+	}
+}
 
-	is_flight_ = true;
+void MockMissileManager::sendMissileData()
+{
+	const auto &missiles = engine_->missiles();
+	for (size_t i = 0; i < missiles.size(); ++i)
+	{
+		sendData(i);
+	}
+}
+
+void MockMissileManager::sendData(size_t index)
+{
+	const auto &missiles = engine_->missiles();
+
+	MissileInfo info;
+	info.cmd = recvPacketType::SIM_MOCK_DATA;
+	info.id = missiles.id[index];
+	info.x = missiles.encodedLat(index);
+	info.y = missiles.encodedLon(index);
+	info.z = missiles.encodedAlt(index);
+	info.speed = missiles.speed[index];
+	info.angle = missiles.angle[index];
+	info.angle2 = missiles.angle2[index];
+	info.is_hit = missiles.is_hit[index] != 0;
 
-	// Start the flight thread
-	flight_thread_ = std::thread([this, MissileInfo]()
-								 {
-        MockMissile missile(last_missile_info_, mfr_send_manager_, mock_target_manager_, this->shared_from_this());
-        missile.updatePosMissile(); });
-	flight_thread_.detach();
-}
\ No newline at end of file
+	mfr_send_manager_->sendData(reinterpret_cast<const char *>(&info), sizeof(info));
+}
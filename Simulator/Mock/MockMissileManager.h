@@ -1,34 +1,54 @@
 #ifndef MOCK_MISSILE_MANAGER_H
 #define MOCK_MISSILE_MANAGER_H
 
-#include <thread>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
 
 #include "MissileInfo.h"
 #include "MockTargetManager.h"
 #include "MFRSendUDPManager.h"
+#include "SimulationEngine.h"
 
-class MockMissileManager : public std::enable_shared_from_this<MockMissileManager>
+struct MissilePoolOptions
+{
+	size_t max_in_flight = 64;	   // 동시 비행 가능한 최대 미사일 수
+	double max_flight_sec = 120.0; // 명중하지 못한 미사일의 최대 비행 시간 (시뮬레이션 시간, s)
+};
+
+class MockMissileManager
 {
 private:
+	static constexpr int MISSILE_ID_BASE = 105 * 1000; // 미사일 ID 식별자 105xxx
+	static constexpr int MISSILE_ID_MAX = 999;
+
 	std::shared_ptr<MockTargetManager> mock_target_manager_;
 	std::shared_ptr<MFRSendUDPManager> mfr_send_manager_;
+	std::shared_ptr<SimulationEngine> engine_; // 미사일 상태는 엔진의 SoA 테이블(슬랩)이 보관
 
-	bool is_flight_ = false;
-	std::thread flight_thread_;
+	MissilePoolOptions options_;
 
-	int last_missile_id_ = 0;		// 마지막 미사일 ID
-	MissileInfo last_missile_info_; // 마지막 미사일 정보
+	// LS 수신 스레드(발사)와 엔진 스레드(소멸)가 함께 사용
+	std::mutex id_mutex_;
+	std::deque<int> free_ids_; // 재사용 대기 ID (가장 오래 전에 반납된 ID부터 재사용)
+	std::atomic<size_t> in_flight_{0};
 
-	void updateMissileID();
+	bool acquireMissileID(int &missile_id);
+	void releaseMissileID(unsigned int missile_id);
+	void sendData(size_t index); // index 번째 미사일 상태 전송
 
 public:
-	// 생성자 선언 (정의 제거)
-	MockMissileManager(std::shared_ptr<MockTargetManager> target_manager, std::shared_ptr<MFRSendUDPManager> mfr_send_manager);
+	MockMissileManager(std::shared_ptr<MockTargetManager> target_manager, std::shared_ptr<MFRSendUDPManager> mfr_send_manager, std::shared_ptr<SimulationEngine> engine, const MissilePoolOptions &options);
+
+	// 비행 미사일 관리 함수 (LS 수신 스레드에서 호출)
+	void flightMissile(const MissileInfo &missile_info);
 
-	// 비행 미사일 관리 함수
-	void flightMissile(const MissileInfo &MissileInfo);
+	// 엔진 스레드에서 호출: 매 스텝 명중/소멸 판정 / 송신 주기마다 상태 전송
+	void updatePosMissile();
+	void sendMissileData();
 
-	void setFlightStatus(bool status) { is_flight_ = status; }
+	size_t inFlightCount() const { return in_flight_; }
 };
 
-#endif // MOCK_MISSILE_MANAGER_H
\ No newline at end of file
+#endif // MOCK_MISSILE_MANAGER_H
@@ -4,10 +4,17 @@
 #include <fstream>
 #include <sstream>
 #include <algorithm>
+#include <cmath>
+
+#include "Geodesy.h"
+#include "AsyncLog.h"
+#include "Trace.h"
+
+constexpr double MISSILE_RANGE = 200.0;			   // 명중 판정 반경 (m)
 
 // 생성자 수정: MFRSendUDPManager 포인터를 받도록 변경
-MockTargetManager::MockTargetManager(std::shared_ptr<MFRSendUDPManager> mfr_send_manager)
-	: mfr_send_manager_(mfr_send_manager)
+MockTargetManager::MockTargetManager(std::shared_ptr<MFRSendUDPManager> mfr_send_manager, std::shared_ptr<SimulationEngine> engine)
+	: engine_(engine), mfr_send_manager_(mfr_send_manager), target_grid_(MISSILE_RANGE)
 {
 	// Constructor implementation
 }
@@ -64,11 +71,8 @@ void MockTargetManager::RaedTargetIni()
 				targetInfo.angle2 = angle2;
 				targetInfo.speed = speed;
 
-				// MockTarget 객체 생성 및 TargetInfo, MFRSendUDPManager 설정
-				std::shared_ptr<MockTarget> target = std::make_shared<MockTarget>(targetInfo, mfr_send_manager_);
-
 				// 타겟 추가
-				addTarget(target);
+				addTarget(targetInfo);
 			}
 			catch (const std::invalid_argument &e)
 			{
@@ -90,72 +94,87 @@ void MockTargetManager::RaedTargetIni()
 	// std::cout << "Target list loaded successfully." << std::endl;
 }
 
-void MockTargetManager::addTarget(std::shared_ptr<MockTarget> &target)
+void MockTargetManager::addTarget(const TargetInfo &target)
 {
-	targets.push_back(target);
+	engine_->targets().push(target.id, target.x, target.y, target.z, target.speed, target.angle, target.angle2);
 }
 
-void MockTargetManager::removeTarget(const std::vector<TargetInfo> &target_list)
+void MockTargetManager::removeTarget()
 {
-	// 무효한 타겟 제거
-	targets.erase(
-		std::remove_if(targets.begin(), targets.end(),
-					   [](const std::shared_ptr<MockTarget> &target)
-					   {
-						   return !target;
-					   }),
-		targets.end());
-
-	for (const auto &target : target_list)
+	// 격추된 타겟 제거 (뒤에서부터 swap-remove)
+	auto &table = engine_->targets();
+	for (size_t i = table.size(); i-- > 0;)
 	{
-		targets.erase(
-			std::remove_if(targets.begin(), targets.end(),
-						   [&target](const std::shared_ptr<MockTarget> &t)
-						   {
-							   return t && t->getTargetInfo().id == target.id;
-						   }),
-			targets.end());
+		if (table.is_hit[i])
+		{
+			asynclog::info("[Target ID {}] 격추됨. 전송 및 위치 갱신 중단.", table.id[i]);
+			table.swapRemove(i);
+		}
 	}
 }
 
 void MockTargetManager::flitghtTarget()
 {
-	std::vector<TargetInfo> target_info_list;
-	// 유효한 타겟만 업데이트
-	for (auto &target : targets)
+	// 엔진이 갱신한 표적 상태를 배치 버퍼에 적재 (cmd 바이트 제외 TargetSimData 형식)
+	const auto &table = engine_->targets();
+
+	target_batch_.clear();
+	target_batch_.reserve(table.size());
+	for (size_t i = 0; i < table.size(); ++i)
 	{
-		if (target)
-		{
-			auto tmp = target->updatePos();
-			target_info_list.push_back(tmp);
-		}
+		TargetSimData data;
+		data.mockId = table.id[i];
+		data.mockCoords = {table.encodedLat(i), table.encodedLon(i), table.encodedAlt(i)};
+		data.speed = table.speed[i];
+		data.angle = table.angle[i];
+		data.angle2 = table.angle2[i];
+		data.isHit = table.is_hit[i] != 0;
+		target_batch_.push_back(data);
 	}
 
-	for (const auto target_info : target_info_list)
+	// 지연 추적 시작점: 이 틱의 표적 상태가 만들어진 시각
+	if (++trace_id_ == 0)
 	{
-		char buffer[1024];
-		std::memcpy(buffer, &target_info, sizeof(target_info));
-		mfr_send_manager_->sendData(buffer, sizeof(target_info));
-		std::cout << "test id : " << target_info.id << std::endl;
+		trace_id_ = 1;
 	}
-	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	const trace::Context tick_trace{trace_id_, trace::nowUs()};
+
+	// 29개 단위 배치 패킷(PacketHeader + CRC)으로 전송
+	mfr_send_manager_->sendTargetBatch(target_batch_, tick_trace);
+
+	static trace::LatencyHistogram &egress = trace::stage("sim.egress");
+	egress.recordSince(tick_trace);
+
+	// 격추 상태를 한 번 전송한 타겟은 제거
+	removeTarget();
 }
 
-int MockTargetManager::downTargetStatus(const MissileInfo &missileInfo)
+void MockTargetManager::updateTargetIndex()
 {
+	target_grid_.rebuild(engine_->targets());
+}
+
+int MockTargetManager::downTargetStatus(double lat, double lon, double alt)
+{
+	auto &table = engine_->targets();
+	const geo::Position missile{lat, lon, alt};
 	int down_count = 0;
-	std::vector<TargetInfo> down_targets;
-	for (auto &target : targets)
-	{
-		if (target->downTargetStatus(missileInfo))
+
+	// 주변 셀의 표적만 거리 비교
+	target_grid_.forEachNear(lat, lon, [&](size_t i)
+							 {
+		if (table.is_hit[i])
 		{
-			++down_count;
-			down_targets.push_back(target->getTargetInfo());
-			target->updatePos();
+			return;
 		}
-	}
 
-	removeTarget(down_targets);
+		// 미사일 기준 표적까지의 평면 근사 거리(m)
+		const geo::Enu d = geo::enuOffset(missile, table.lat[i], table.lon[i], table.alt[i]);
+		if (d.east * d.east + d.north * d.north + d.up * d.up <= MISSILE_RANGE * MISSILE_RANGE)
+		{
+			table.is_hit[i] = 1;
+			++down_count;
+		} });
 
 	return down_count;
 }
@@ -3,29 +3,35 @@
 
 #include <vector>
 #include <memory>
-#include <thread>
 
-#include "MockTarget.h"
 #include "TargetInfo.h"
-#include "MissileInfo.h"
+#include "SimulationEngine.h"
+#include "SpatialGrid.h"
 
 #include "MFRSendUDPManager.h"
 
 class MockTargetManager
 {
 public:
-	MockTargetManager(std::shared_ptr<MFRSendUDPManager> mfr_send_manager); // 생성자 수정
+	MockTargetManager(std::shared_ptr<MFRSendUDPManager> mfr_send_manager, std::shared_ptr<SimulationEngine> engine);
 	~MockTargetManager();
 
 	void RaedTargetIni();
-	void addTarget(std::shared_ptr<MockTarget> &target);
-	void removeTarget(const std::vector<TargetInfo> &target_list);
+	void addTarget(const TargetInfo &target);
+	void removeTarget();
 	void flitghtTarget();
-	int downTargetStatus(const MissileInfo &missileInfo);
+	int downTargetStatus(double lat, double lon, double alt);
+
+	// 명중 판정 전 스텝마다 한 번 호출 (표적 위치 격자 재구성)
+	void updateTargetIndex();
 
 private:
-	std::vector<std::shared_ptr<MockTarget>> targets;
+	std::shared_ptr<SimulationEngine> engine_;			  // 표적 상태는 엔진의 SoA 테이블이 보관
 	std::shared_ptr<MFRSendUDPManager> mfr_send_manager_; // MFRSendUDPManager 추가
+
+	std::vector<TargetSimData> target_batch_; // 틱마다 재사용하는 배치 송신 버퍼
+	uint32_t trace_id_ = 0;					  // 지연 추적 id (틱마다 증가, 0은 건너뜀)
+	SpatialGrid target_grid_;				  // 명중 판정용 표적 격자 인덱스
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -12,6 +12,7 @@
 #include <string>
 #include <stdexcept>
 #include <thread>
+#include <algorithm>
 
 #include "Config.h"
 #include "MissileInfo.h"
@@ -58,13 +59,34 @@ bool Simulator::init()
 		return false;
 	}
 
+	// Initialize the simulation engine
+	EngineOptions engine_options;
+	engine_options.step_ms = config.EngineStepMs;
+	engine_options.time_scale = config.EngineTimeScale;
+	engine_options.workers = config.EngineWorkers;
+	engine_options.chunk_size = static_cast<size_t>(std::max(config.EngineChunkSize, 1));
+	engine_ = std::make_shared<SimulationEngine>(engine_options);
+
 	// Initialize the mock target manager
-	mock_target_manager_ = std::make_shared<MockTargetManager>(mfr_send_manager_);
+	mock_target_manager_ = std::make_shared<MockTargetManager>(mfr_send_manager_, engine_);
 	mock_target_manager_->RaedTargetIni();
 
 	// Initialize the mock missile
-	mock_missile_manager_ = std::make_shared<MockMissileManager>(mock_target_manager_, mfr_send_manager_);
-	// mock_target_manager_->SetMockMissileManager(mock_missile_manager_);
+	MissilePoolOptions missile_options;
+	missile_options.max_in_flight = static_cast<size_t>(std::max(config.MissileMaxInFlight, 1));
+	missile_options.max_flight_sec = config.MissileMaxFlightSec;
+	mock_missile_manager_ = std::make_shared<MockMissileManager>(mock_target_manager_, mfr_send_manager_, engine_, missile_options);
+
+	// 매 스텝 명중 판정, PublishMs 주기마다 MFR로 상태 송신 (시뮬레이션 시간 기준)
+	const uint64_t publish_every = std::max(1, config.EnginePublishMs / std::max(config.EngineStepMs, 1));
+	engine_->setTickHandler([this, publish_every](uint64_t tick)
+							{
+		mock_missile_manager_->updatePosMissile();
+		if (tick % publish_every == 0)
+		{
+			mock_target_manager_->flitghtTarget();
+			mock_missile_manager_->sendMissileData();
+		} });
 
 	return true;
 }
@@ -96,12 +118,5 @@ void Simulator::start()
 		} });
 	recv_thread_.detach();
 
-	flight_target_thread_ = std::thread([this]()
-										{
-		while (true)
-		{
-			mock_target_manager_->flitghtTarget();
-			std::this_thread::sleep_for(std::chrono::milliseconds(100));
-		} });
-	flight_target_thread_.detach();
+	engine_->start();
 }
\ No newline at end of file
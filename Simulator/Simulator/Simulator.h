@@ -5,6 +5,7 @@
 #include "MFRSendUDPManager.h"
 #include "MockTargetManager.h"
 #include "MockMissileManager.h"
+#include "SimulationEngine.h"
 
 class Simulator
 {
@@ -15,8 +16,9 @@ private:
 	std::shared_ptr<MockTargetManager> mock_target_manager_;
 	std::shared_ptr<MockMissileManager> mock_missile_manager_;
 
+	std::shared_ptr<SimulationEngine> engine_; // 표적/미사일 공용 물리 엔진
+
 	std::thread recv_thread_;
-	std::thread flight_target_thread_;
 
 public:
 	Simulator();
@@ -1,5 +1,7 @@
 #include "MFRSendUDPManager.h"
 
+#include <algorithm>
+
 MFRSendUDPManager::MFRSendUDPManager(/* args */)
 {
 	// Constructor implementation
@@ -58,45 +60,32 @@ bool MFRSendUDPManager::sendData(const char *data, int dataSize)
 	return true;
 }
 
-void MFRSendUDPManager::sendTargetBatch(const std::vector<TargetSimData>& allTargets)
+void MFRSendUDPManager::sendTargetBatch(const std::vector<TargetSimData> &allTargets, const trace::Context &tick_trace)
 {
-    static uint32_t globalSeqID = 0; // 패킷 순서 번호 (계속 증가)
-    
-    // UDP 패킷 하나당 보낼 표적 개수 (MTU 1500 byte 고려)
-    // TargetSimData가 약 40~50바이트라면, 30개 정도가 적당 (30 * 50 = 1500 이하)
-    const size_t TARGETS_PER_PACKET = 30;
-    size_t total = allTargets.size();
-
-    for (size_t i = 0; i < total; i += TARGETS_PER_PACKET)
-    {
-        // 1. 이번 패킷에 담을 개수 계산
-        size_t count = std::min(TARGETS_PER_PACKET, total - i);
-        size_t payloadSize = count * sizeof(TargetSimData);
-        size_t totalPacketSize = sizeof(PacketHeader) + payloadSize;
+	const size_t total = allTargets.size();
 
-        // 2. 버퍼 생성 (Header + Payload)
-        std::vector<char> buffer(totalPacketSize);
-        
-        // 포인터 설정
-        PacketHeader* header = reinterpret_cast<PacketHeader*>(buffer.data());
-        TargetSimData* payload = reinterpret_cast<TargetSimData*>(buffer.data() + sizeof(PacketHeader));
+	for (size_t i = 0; i < total; i += TARGETS_PER_PACKET)
+	{
+		// 1. 이번 패킷에 담을 개수 계산
+		const size_t count = std::min(TARGETS_PER_PACKET, total - i);
+		const size_t payloadSize = count * sizeof(TargetSimData);
+		const size_t totalPacketSize = sizeof(PacketHeader) + payloadSize;
 
-        // 3. 데이터 복사 (Payload 채우기)
-        // allTargets 벡터의 i번째부터 count개만큼 복사
-        std::memcpy(payload, &allTargets[i], payloadSize);
+		// 2. 재사용 버퍼에 Header + Payload 배치 (매 패킷 할당 없음)
+		char *payload = batch_buffer_.data() + sizeof(PacketHeader);
+		std::memcpy(payload, &allTargets[i], payloadSize);
 
-        // 4. 헤더 작성 (검증 정보 기입)
-        header->magic = 0xA1B2C3D4;        // 매직 넘버
-        header->seqID = globalSeqID++;     // 순서 번호 증가
-        header->count = (uint32_t)count;   // 개수
-        
-        // [핵심] CRC 계산: Payload 데이터에 대해서만 계산하여 헤더에 기록
-        header->payloadCRC = calculateCRC32(payload, payloadSize);
+		// 3. 헤더 작성 (검증 정보 기입), CRC는 Payload 데이터에 대해서만 계산
+		PacketHeader header{};
+		header.magic = 0xA1B2C3D4;
+		header.seqID = batch_seq_id_++;
+		header.count = static_cast<uint32_t>(count);
+		header.payloadCRC = calculateCRC32(payload, payloadSize);
+		header.traceId = tick_trace.id;
+		header.traceOriginUs = tick_trace.originUs;
+		std::memcpy(batch_buffer_.data(), &header, sizeof(PacketHeader));
 
-        // 5. 기존 sendData 함수 호출 (char* 로 변환하여 전송)
-        sendData(buffer.data(), (int)buffer.size());
-        
-        // (옵션) CPU 과부하 방지를 위한 미세 딜레이
-        // std::this_thread::sleep_for(std::chrono::microseconds(100));
-    }
-}
\ No newline at end of file
+		// 4. 기존 sendData 함수 호출
+		sendData(batch_buffer_.data(), static_cast<int>(totalPacketSize));
+	}
+}
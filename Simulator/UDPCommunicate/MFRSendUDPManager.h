@@ -6,21 +6,32 @@
 #include <cstring>
 #include <arpa/inet.h>
 #include <unistd.h>
+#include <array>
 #include "CommonPacket.h"
+#include "Trace.h"
 
 class MFRSendUDPManager
 {
+public:
+	// UDP 패킷 하나당 보낼 표적 개수 (MTU 1500 byte - IP/UDP 28 byte 고려, 28 + 29 * 49 = 1449 byte)
+	static constexpr size_t TARGETS_PER_PACKET = 29;
+	static constexpr size_t MAX_BATCH_PACKET_SIZE = sizeof(PacketHeader) + TARGETS_PER_PACKET * sizeof(TargetSimData);
+
 private:
 	int mfr_socket_;				 // UDP 소켓 파일 디스크립터
 	struct sockaddr_in client_addr_; // 클라이언트 주소 구조체
 
+	uint32_t batch_seq_id_ = 0;								 // 배치 패킷 순서 번호 (계속 증가)
+	std::array<char, MAX_BATCH_PACKET_SIZE> batch_buffer_{}; // 배치 패킷 송신용 재사용 버퍼
+
 public:
 	MFRSendUDPManager(/* args */);
 	~MFRSendUDPManager();
 
 	bool MFRSocketOpen(const std::string &ip, int port);
 	bool sendData(const char *data, int dataSize);
-	void sendTargetBatch(const std::vector<TargetSimData>& allTargets);
+	// 한 틱의 표적을 배치 패킷으로 나눠 전송, 모든 패킷에 같은 추적 정보를 실음
+	void sendTargetBatch(const std::vector<TargetSimData>& allTargets, const trace::Context &tick_trace = {});
 };
 
 #endif // MFR_SEND_UDP_MANAGER_H
\ No newline at end of file
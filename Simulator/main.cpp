@@ -1,10 +1,14 @@
 #include "Simulator.h"
+#include "Trace.h"
 
 #include <error.h>
 #include <iostream>
 
 int main()
 {
+	// SIGUSR1 → 구간별 지연 히스토그램 출력 (스레드 생성 전에 설치)
+	trace::installDumpSignal();
+
 	// Create an instance of the Simulator
 	Simulator simulator;
 
@@ -0,0 +1,337 @@
+// 프로토콜/계산 경로 마이크로벤치마크 실행기
+//   ./bench [--targets 10,100,999,4000] [--filter 이름일부] [--min-time-ms 200]
+//           [--out bench.json] [--compare 이전결과.json] [--list]
+// - 케이스 × 표적 수마다 워밍업 1회 후, 배치 1회가 50us 이상 되도록 반복 횟수를 잡고
+//   최소 시간(최소 5개 표본)을 채울 때까지 배치 단위 ns/op 표본을 모은다.
+// - 결과는 JSON (결과 1건 = 1줄), --compare로 이전 결과와 중앙값 비교
+#include "Bench.h"
+#include "AsyncLog.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#ifndef BENCH_BUILD_TYPE
+#define BENCH_BUILD_TYPE "unknown"
+#endif
+
+namespace bench
+{
+    namespace
+    {
+        struct Case
+        {
+            std::string name;
+            Setup setup;
+            size_t maxN;
+        };
+
+        std::vector<Case> &cases()
+        {
+            static std::vector<Case> list;
+            return list;
+        }
+    }
+
+    void add(const std::string &name, Setup setup, size_t maxN)
+    {
+        cases().push_back(Case{name, std::move(setup), maxN});
+    }
+}
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr double MIN_BATCH_NS = 50000.0;
+    constexpr uint64_t MAX_BATCH = uint64_t(1) << 24;
+    constexpr size_t MIN_SAMPLES = 5;
+    constexpr size_t MAX_SAMPLES = 2000;
+
+    struct Options
+    {
+        std::vector<size_t> targets{10, 100, 999, 4000};
+        std::string filter;
+        double minTimeMs = 200.0;
+        std::string out = "bench.json";
+        std::string compare;
+        bool list = false;
+    };
+
+    struct Result
+    {
+        std::string name;
+        size_t targets = 0;
+        uint64_t iterations = 0;
+        size_t samples = 0;
+        double medianNs = 0.0;
+        double minNs = 0.0;
+        double meanNs = 0.0;
+        size_t bytes = 0;
+    };
+
+    double timeBatch(const std::function<void()> &run, uint64_t batch)
+    {
+        const Clock::time_point start = Clock::now();
+        for (uint64_t i = 0; i < batch; ++i)
+            run();
+        return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    bool measure(const bench::Fixture &fixture, double minTimeMs, Result &r)
+    {
+        if (!fixture.run)
+            return false;
+
+        fixture.run(); // 워밍업 (지연 할당, 캐시)
+
+        uint64_t batch = 1;
+        while (batch < MAX_BATCH && timeBatch(fixture.run, batch) < MIN_BATCH_NS)
+            batch *= 2;
+
+        std::vector<double> samples;
+        double totalNs = 0.0;
+        while (samples.size() < MIN_SAMPLES || (totalNs < minTimeMs * 1e6 && samples.size() < MAX_SAMPLES))
+        {
+            const double ns = timeBatch(fixture.run, batch);
+            samples.push_back(ns / static_cast<double>(batch));
+            totalNs += ns;
+            r.iterations += batch;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        r.samples = samples.size();
+        r.minNs = samples.front();
+        r.medianNs = samples[samples.size() / 2];
+        r.meanNs = totalNs / static_cast<double>(r.iterations);
+        r.bytes = fixture.bytes;
+        return true;
+    }
+
+    std::vector<size_t> parseList(const std::string &text)
+    {
+        std::vector<size_t> values;
+        std::stringstream ss(text);
+        std::string token;
+        while (std::getline(ss, token, ','))
+        {
+            if (!token.empty())
+                values.push_back(static_cast<size_t>(std::strtoull(token.c_str(), nullptr, 10)));
+        }
+        return values;
+    }
+
+    bool parseArgs(int argc, char **argv, Options &opt)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const bool hasValue = i + 1 < argc;
+            if (arg == "--targets" && hasValue)
+                opt.targets = parseList(argv[++i]);
+            else if (arg == "--filter" && hasValue)
+                opt.filter = argv[++i];
+            else if (arg == "--min-time-ms" && hasValue)
+                opt.minTimeMs = std::atof(argv[++i]);
+            else if (arg == "--out" && hasValue)
+                opt.out = argv[++i];
+            else if (arg == "--compare" && hasValue)
+                opt.compare = argv[++i];
+            else if (arg == "--list")
+                opt.list = true;
+            else
+            {
+                std::cerr << "사용법: " << argv[0]
+                          << " [--targets 10,100,999] [--filter 이름] [--min-time-ms 200] [--out bench.json]"
+                             " [--compare 이전결과.json] [--list]\n";
+                return false;
+            }
+        }
+        if (opt.targets.empty())
+        {
+            std::cerr << "[bench] --targets 값이 비었습니다\n";
+            return false;
+        }
+        return true;
+    }
+
+    std::string timestamp()
+    {
+        char stamp[32];
+        const std::time_t now = std::time(nullptr);
+        std::tm tm{};
+        gmtime_r(&now, &tm);
+        std::strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", &tm);
+        return stamp;
+    }
+
+    bool writeJson(const std::string &path, const Options &opt, const std::vector<Result> &results)
+    {
+        std::ofstream out(path);
+        if (!out)
+        {
+            std::cerr << "[bench] 결과 파일 열기 실패: " << path << "\n";
+            return false;
+        }
+
+        char line[512];
+        out << "{\n";
+        out << "  \"schema\": 1,\n";
+        out << "  \"timestamp\": \"" << timestamp() << "\",\n";
+        out << "  \"compiler\": \"" << __VERSION__ << "\",\n";
+        out << "  \"build_type\": \"" << BENCH_BUILD_TYPE << "\",\n";
+        out << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+        out << "  \"min_time_ms\": " << opt.minTimeMs << ",\n";
+        out << "  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result &r = results[i];
+            // --compare가 줄 단위로 읽으므로 결과 1건은 반드시 한 줄
+            std::snprintf(line, sizeof(line),
+                          "    {\"name\": \"%s\", \"targets\": %zu, \"iterations\": %llu, \"samples\": %zu, "
+                          "\"ns_per_op_median\": %.1f, \"ns_per_op_min\": %.1f, \"ns_per_op_mean\": %.1f, "
+                          "\"ns_per_target\": %.2f, \"bytes_per_op\": %zu}%s\n",
+                          r.name.c_str(), r.targets, static_cast<unsigned long long>(r.iterations), r.samples,
+                          r.medianNs, r.minNs, r.meanNs, r.medianNs / static_cast<double>(std::max<size_t>(r.targets, 1)),
+                          r.bytes, i + 1 < results.size() ? "," : "");
+            out << line;
+        }
+        out << "  ]\n}\n";
+        return static_cast<bool>(out);
+    }
+
+    // 이 실행기가 쓴 JSON만 읽음 (결과 1줄에서 필드 값만 찾음)
+    bool findField(const std::string &line, const char *key, std::string &value)
+    {
+        const std::string pattern = std::string("\"") + key + "\": ";
+        const size_t pos = line.find(pattern);
+        if (pos == std::string::npos)
+            return false;
+        size_t begin = pos + pattern.size();
+        size_t end;
+        if (line[begin] == '"')
+        {
+            ++begin;
+            end = line.find('"', begin);
+        }
+        else
+        {
+            end = line.find_first_of(",}", begin);
+        }
+        if (end == std::string::npos)
+            return false;
+        value = line.substr(begin, end - begin);
+        return true;
+    }
+
+    bool loadBaseline(const std::string &path, std::map<std::pair<std::string, size_t>, double> &baseline)
+    {
+        std::ifstream in(path);
+        if (!in)
+        {
+            std::cerr << "[bench] 비교 파일 열기 실패: " << path << "\n";
+            return false;
+        }
+        std::string line, name, targets, median;
+        while (std::getline(in, line))
+        {
+            if (findField(line, "name", name) && findField(line, "targets", targets) &&
+                findField(line, "ns_per_op_median", median))
+            {
+                baseline[{name, static_cast<size_t>(std::strtoull(targets.c_str(), nullptr, 10))}] = std::atof(median.c_str());
+            }
+        }
+        return true;
+    }
+
+    void printCompare(const std::map<std::pair<std::string, size_t>, double> &baseline, const std::vector<Result> &results)
+    {
+        std::printf("\n%-34s %8s %14s %14s %9s\n", "compare", "targets", "base ns/op", "now ns/op", "change");
+        for (const Result &r : results)
+        {
+            auto it = baseline.find({r.name, r.targets});
+            if (it == baseline.end() || it->second <= 0.0)
+            {
+                std::printf("%-34s %8zu %14s %14.1f %9s\n", r.name.c_str(), r.targets, "-", r.medianNs, "new");
+                continue;
+            }
+            const double change = (r.medianNs - it->second) / it->second * 100.0;
+            std::printf("%-34s %8zu %14.1f %14.1f %+8.1f%%\n", r.name.c_str(), r.targets, it->second, r.medianNs, change);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+        return 2;
+
+    // 측정 대상 코드의 로그는 버림 (포맷/적재 비용은 그대로 포함됨)
+    asynclog::setFile("/dev/null");
+
+    bench::registerLC();
+    bench::registerMFR();
+    bench::registerSim();
+
+    if (opt.list)
+    {
+        for (const auto &c : bench::cases())
+            std::printf("%s\n", c.name.c_str());
+        return 0;
+    }
+
+    std::map<std::pair<std::string, size_t>, double> baseline;
+    if (!opt.compare.empty() && !loadBaseline(opt.compare, baseline))
+        return 2;
+
+    std::printf("%-34s %8s %14s %14s %12s %10s\n", "benchmark", "targets", "ns/op (med)", "ns/op (min)", "ns/target", "MB/s");
+
+    std::vector<Result> results;
+    for (const auto &c : bench::cases())
+    {
+        if (!opt.filter.empty() && c.name.find(opt.filter) == std::string::npos)
+            continue;
+
+        for (size_t n : opt.targets)
+        {
+            if (n > c.maxN)
+            {
+                std::printf("%-34s %8zu %14s (최대 %zu)\n", c.name.c_str(), n, "skip", c.maxN);
+                continue;
+            }
+
+            Result r;
+            r.name = c.name;
+            r.targets = n;
+            if (!measure(c.setup(n), opt.minTimeMs, r))
+            {
+                std::printf("%-34s %8zu %14s\n", c.name.c_str(), n, "skip");
+                continue;
+            }
+
+            const double mbps = r.bytes ? static_cast<double>(r.bytes) / r.medianNs * 1e3 : 0.0;
+            std::printf("%-34s %8zu %14.1f %14.1f %12.2f %10.1f\n", r.name.c_str(), n, r.medianNs, r.minNs,
+                        r.medianNs / static_cast<double>(std::max<size_t>(n, 1)), mbps);
+            std::fflush(stdout);
+            results.push_back(r);
+        }
+    }
+
+    if (!baseline.empty())
+        printCompare(baseline, results);
+
+    if (!writeJson(opt.out, opt, results))
+        return 1;
+    std::printf("\n%zu results → %s\n", results.size(), opt.out.c_str());
+    return 0;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// 표적 수(n)를 매개변수로 하는 마이크로벤치마크 등록/실행
+// 구성요소(LC/MFR/Simulator)마다 헤더 이름과 include 경로가 겹치므로 각자 정적 라이브러리로 빌드하고,
+// 이 헤더에는 프로젝트 헤더를 넣지 않는다.
+namespace bench
+{
+    // 측정 대상 (준비가 끝난 상태에서 1회 실행)
+    struct Fixture
+    {
+        std::function<void()> run;
+        size_t bytes = 0; // 1회당 처리 바이트 (0이면 처리량 출력 안 함)
+    };
+
+    // n에 맞춰 입력을 준비하고 Fixture를 반환 (준비 비용은 측정에서 제외)
+    using Setup = std::function<Fixture(size_t n)>;
+
+    // maxN: 프로토콜상 n의 상한 (ID 범위 xxx001 ~ xxx999 등), 넘는 n은 건너뜀
+    void add(const std::string &name, Setup setup, size_t maxN = SIZE_MAX);
+
+    // 결과를 버리지 않게 컴파일러에 알림
+    template <typename T>
+    inline void doNotOptimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    void registerLC();
+    void registerMFR();
+    void registerSim();
+
+    // MFR DetectionEncoder로 만든 0x24 프레임 (0번은 키프레임, 이후는 표적이 움직인 델타 프레임)
+    std::vector<std::vector<uint8_t>> makeDetectionFrames(size_t numTargets, size_t frameCount);
+}
@@ -0,0 +1,161 @@
+// LC: 탐지 보고(0x24) 파싱, 상태 응답(0x56) 직렬화, 교전 계획(요격 해 탐색), 표적 추적 필터
+#include "Bench.h"
+#include "FirePlanner.h"
+#include "MessageParser.h"
+#include "Serializer.h"
+#include "StatusFixture.h"
+#include "TrackFilter.h"
+
+#include <memory>
+#include <random>
+
+using Common::ByteSpan;
+using Common::MessageParser;
+using Common::Serializer;
+
+namespace
+{
+    // 0x24는 MFR ID 범위(104001 ~ 104999)를 넘는 표적을 보낼 수 없음
+    constexpr size_t MAX_DETECTION_TARGETS = 999;
+
+    struct ParseInput
+    {
+        std::vector<std::vector<uint8_t>> frames;
+        MessageParser parser;
+    };
+
+    bench::Fixture parseFrame(size_t n, bool delta)
+    {
+        auto in = std::make_shared<ParseInput>();
+        in->frames = bench::makeDetectionFrames(n, delta ? 2 : 1);
+        // 델타 프레임은 파서가 키프레임을 먼저 봐야 풀 수 있음
+        in->parser.parse(ByteSpan(in->frames[0]), SenderType::MFR);
+
+        const std::vector<uint8_t> &frame = in->frames.back();
+        return bench::Fixture{[in, &frame]()
+                              {
+                                  const Common::CommonMessage msg = in->parser.parse(ByteSpan(frame), SenderType::MFR);
+                                  bench::doNotOptimize(msg);
+                              },
+                              frame.size()};
+    }
+
+    bench::Fixture serializeStatus(size_t n, int version)
+    {
+        struct Input
+        {
+            SystemStatus status;
+            std::vector<uint8_t> out;
+        };
+        auto in = std::make_shared<Input>();
+        in->status = makeStatus(n, 4);
+        Serializer::serializeStatusResponse(in->status, in->out, version);
+
+        return bench::Fixture{[in, version]()
+                              {
+                                  Serializer::serializeStatusResponse(in->status, in->out, version);
+                                  bench::doNotOptimize(in->out.data());
+                              },
+                              in->out.size()};
+    }
+
+    // 발사대 주변 5 ~ 80 km, 요격 가능한 고도/속도의 표적 (makeStatus의 무작위 좌표로는 해가 없음)
+    SystemStatus makeEngagement(size_t n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> offsetDeg(-0.7, 0.7);
+        std::uniform_real_distribution<double> angle(0.0, 360.0);
+        std::uniform_real_distribution<double> climb(-10.0, 10.0);
+        std::uniform_int_distribution<long long> altitude(500, 12000);
+        std::uniform_int_distribution<int> speed(300, 2500);
+        std::uniform_int_distribution<int> priority(0, 5);
+
+        SystemStatus s;
+        s.ls = LSStatus{106001, LauncherMode::WAR, 0.0, Pos2D{375000000, 1270000000}, 50, 4000};
+        for (size_t i = 0; i < n; ++i)
+        {
+            TargetStatus t{};
+            t.id = 104001 + static_cast<unsigned>(i);
+            t.posX = s.ls.position.x + static_cast<long long>(offsetDeg(rng) * geo::COORD_SCALE);
+            t.posY = s.ls.position.y + static_cast<long long>(offsetDeg(rng) * geo::COORD_SCALE);
+            t.altitude = altitude(rng);
+            t.speed = speed(rng);
+            t.angle1 = angle(rng);
+            t.angle2 = climb(rng);
+            t.priority = static_cast<uint8_t>(priority(rng));
+            s.targets.upsert(t);
+        }
+        return s;
+    }
+}
+
+namespace bench
+{
+    void registerLC()
+    {
+        add("lc.parse.detection_v2.keyframe", [](size_t n)
+            { return parseFrame(n, false); }, MAX_DETECTION_TARGETS);
+        add("lc.parse.detection_v2.delta", [](size_t n)
+            { return parseFrame(n, true); }, MAX_DETECTION_TARGETS);
+
+        add("lc.serialize.status_v1", [](size_t n)
+            { return serializeStatus(n, Serializer::STATUS_V1); });
+        add("lc.serialize.status_v2", [](size_t n)
+            { return serializeStatus(n, Serializer::STATUS_V2); });
+
+        // ECC FireCommand 전체 교전(ENGAGE_ALL) 처리의 본체
+        add("lc.fire.plan", [](size_t n)
+            {
+                auto status = std::make_shared<SystemStatus>(makeEngagement(n));
+                auto planner = std::make_shared<FirePlanner>();
+                return Fixture{[status, planner]()
+                               {
+                                   const FirePlanner::Plan plan = planner->plan(*status, 1.0);
+                                   doNotOptimize(plan.shots.data());
+                               }};
+            });
+
+        // 탐지 보고 1건을 추적 필터에 반영 (보고 간격 100ms)
+        add("lc.track.update", [](size_t n)
+            {
+                struct Input
+                {
+                    SystemStatus status;
+                    TrackFilter filter;
+                    uint64_t timeUs = 1700000000000000ULL;
+                };
+                auto in = std::make_shared<Input>();
+                in->status = makeEngagement(n);
+                return Fixture{[in]()
+                               {
+                                   in->timeUs += 100000;
+                                   in->filter.beginReport();
+                                   for (const TargetStatus &t : in->status.targets)
+                                       in->filter.update(t, in->timeUs, in->timeUs);
+                                   in->filter.endReport();
+                               }};
+            });
+
+        // 발사 명령 시 전체 표적 외삽 (상태 사본 + SoA 일괄 예측)
+        add("lc.track.extrapolate", [](size_t n)
+            {
+                struct Input
+                {
+                    SystemStatus status;
+                    TrackFilter filter;
+                };
+                auto in = std::make_shared<Input>();
+                in->status = makeEngagement(n);
+                in->filter.beginReport();
+                for (const TargetStatus &t : in->status.targets)
+                    in->filter.update(t, 1700000000000000ULL, 1700000000000000ULL);
+                in->filter.endReport();
+                return Fixture{[in]()
+                               {
+                                   SystemStatus current = in->status;
+                                   in->filter.extrapolate(current, 1700000000350000ULL);
+                                   doNotOptimize(current.targets.begin());
+                               }};
+            });
+    }
+}
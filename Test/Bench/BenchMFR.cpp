@@ -0,0 +1,126 @@
+// MFR: 탐지 보고(0x24) 인코딩, 탐지 알고리즘 1주기
+#include "Bench.h"
+#include "DetectionEncoder.h"
+#include "Geodesy.h"
+#include "Mfr.h"
+#include "MockTableBuffer.h"
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace
+{
+    constexpr unsigned int RADAR_ID = 101001;
+    constexpr unsigned int TARGET_ID_BASE = 104001;
+
+    // Mfr::mfrCoords 주변 (±0.3도)
+    constexpr double MFR_LAT = 7.5481160;
+    constexpr double MFR_LON = 126.9961166;
+
+    std::vector<TargetSimData> makeSimTargets(size_t n, unsigned seed = 1)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> offsetDeg(-0.3, 0.3);
+        std::uniform_real_distribution<double> angle(0.0, 360.0);
+        std::uniform_int_distribution<long long> altitude(500, 12000);
+        std::uniform_int_distribution<int> speed(300, 2500);
+
+        std::vector<TargetSimData> targets(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            TargetSimData &t = targets[i];
+            t.mockId = TARGET_ID_BASE + static_cast<unsigned>(i);
+            t.mockCoords = EncodedPos3D{std::llround((MFR_LAT + offsetDeg(rng)) * geo::COORD_SCALE),
+                                        std::llround((MFR_LON + offsetDeg(rng)) * geo::COORD_SCALE), altitude(rng)};
+            t.speed = speed(rng);
+            t.angle = angle(rng);
+            t.angle2 = 0.0;
+            t.isHit = false;
+        }
+        return targets;
+    }
+
+    // 탐지 스레드가 LC로 보내는 레코드 (frame마다 표적이 조금씩 이동)
+    std::vector<MfrToLcTargetInfo> makeDetected(const std::vector<TargetSimData> &sim, size_t frame)
+    {
+        std::vector<MfrToLcTargetInfo> out(sim.size());
+        for (size_t i = 0; i < sim.size(); ++i)
+        {
+            MfrToLcTargetInfo &t = out[i];
+            t.id = sim[i].mockId;
+            t.targetCoords = sim[i].mockCoords;
+            t.targetCoords.latitude += static_cast<long long>(frame * (37 + i % 11));
+            t.targetCoords.longitude -= static_cast<long long>(frame * (19 + i % 7));
+            t.targetSpeed = sim[i].speed;
+            t.targetAngle = sim[i].angle;
+            t.targetAngle2 = sim[i].angle2;
+            t.firstDetectionTime = 1700000000000ULL;
+            t.prioirty = static_cast<unsigned char>(1 + i % 5);
+            t.isHit = false;
+        }
+        return out;
+    }
+}
+
+namespace bench
+{
+    std::vector<std::vector<uint8_t>> makeDetectionFrames(size_t numTargets, size_t frameCount)
+    {
+        const std::vector<TargetSimData> sim = makeSimTargets(numTargets);
+        const std::vector<MfrToLcMissileInfo> missiles;
+
+        DetectionEncoder encoder(RADAR_ID);
+        std::vector<char> packet;
+        std::vector<std::vector<uint8_t>> frames;
+        for (size_t f = 0; f < frameCount; ++f)
+        {
+            const trace::Context ctx{static_cast<uint32_t>(f + 1), trace::nowUs()};
+            encoder.encode(makeDetected(sim, f), missiles, ctx, packet);
+            frames.emplace_back(packet.begin(), packet.end());
+        }
+        return frames;
+    }
+
+    void registerMFR()
+    {
+        // 정상 상태: 같은 표적 집합이 움직이는 델타 프레임 (KEYFRAME_INTERVAL마다 키프레임 포함)
+        add("mfr.encode.detection_v2", [](size_t n)
+            {
+                struct Input
+                {
+                    DetectionEncoder encoder{RADAR_ID};
+                    std::vector<MfrToLcTargetInfo> frames[2];
+                    std::vector<MfrToLcMissileInfo> missiles;
+                    std::vector<char> packet;
+                    size_t next = 0;
+                };
+                auto in = std::make_shared<Input>();
+                const std::vector<TargetSimData> sim = makeSimTargets(n);
+                in->frames[0] = makeDetected(sim, 0);
+                in->frames[1] = makeDetected(sim, 1);
+                in->encoder.encode(in->frames[0], in->missiles, trace::Context{}, in->packet);
+
+                return Fixture{[in]()
+                               {
+                                   in->next ^= 1;
+                                   in->encoder.encode(in->frames[in->next], in->missiles, trace::Context{}, in->packet);
+                                   doNotOptimize(in->packet.data());
+                               },
+                               in->packet.size()};
+            },
+            MockTable::SLOT_COUNT);
+
+        // 회전 모드 탐지 1주기: 스냅샷 획득 → 사거리 판정 → 정렬/우선순위 → 0x24 인코딩 (LC 연결 없음)
+        add("mfr.detection_algo", [](size_t n)
+            {
+                auto mfr = std::make_shared<Mfr>();
+                const std::vector<TargetSimData> sim = makeSimTargets(n);
+                mfr->callBackTargetBatch(sim.data(), sim.size(), trace::Context{});
+
+                return Fixture{[mfr]()
+                               { mfr->mfrDetectionAlgo(); }};
+            },
+            MockTable::SLOT_COUNT);
+    }
+}
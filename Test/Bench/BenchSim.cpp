@@ -0,0 +1,123 @@
+// Simulator: 배치 패킷 CRC, 표적 송신 틱(flitghtTarget), 엔진 적분 스텝
+#include "Bench.h"
+#include "CommonPacket.h"
+#include "MockTargetManager.h"
+#include "SimulationEngine.h"
+
+#include <arpa/inet.h>
+#include <memory>
+#include <netinet/in.h>
+#include <random>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace
+{
+	// 송신 대상: 읽지 않는 로컬 UDP 소켓 (수신 버퍼가 차면 커널이 버림, sendto 비용은 그대로 측정)
+	struct UdpSink
+	{
+		int fd = -1;
+		int port = 0;
+
+		UdpSink()
+		{
+			fd = socket(AF_INET, SOCK_DGRAM, 0);
+			sockaddr_in addr{};
+			addr.sin_family = AF_INET;
+			addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+			addr.sin_port = 0;
+			socklen_t len = sizeof(addr);
+			if (fd < 0 || bind(fd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 ||
+				getsockname(fd, reinterpret_cast<sockaddr *>(&addr), &len) != 0)
+			{
+				perror("[bench] UDP sink");
+				return;
+			}
+			port = ntohs(addr.sin_port);
+		}
+
+		~UdpSink()
+		{
+			if (fd >= 0)
+			{
+				close(fd);
+			}
+		}
+	};
+
+	// 시뮬레이터 target_list.ini와 같은 형식의 표적 (1e7 정수 좌표)
+	void addTargets(EntityTable &table, size_t n, unsigned seed = 1)
+	{
+		std::mt19937 rng(seed);
+		std::uniform_real_distribution<double> offsetDeg(-0.5, 0.5);
+		std::uniform_real_distribution<double> angle(0.0, 360.0);
+		std::uniform_real_distribution<double> climb(-5.0, 5.0);
+		std::uniform_int_distribution<long long> altitude(500, 12000);
+		std::uniform_int_distribution<int> speed(300, 2500);
+
+		table.reserve(n);
+		for (size_t i = 0; i < n; ++i)
+		{
+			table.push(104001 + static_cast<unsigned>(i),
+					   static_cast<long long>((37.5 + offsetDeg(rng)) * 1e7),
+					   static_cast<long long>((127.0 + offsetDeg(rng)) * 1e7),
+					   altitude(rng), speed(rng), angle(rng), climb(rng));
+		}
+	}
+}
+
+namespace bench
+{
+	void registerSim()
+	{
+		// 배치 패킷 payload (n × TargetSimData) CRC, 송신/수신 양쪽에서 계산
+		add("common.crc32.target_batch", [](size_t n)
+			{
+				auto payload = std::make_shared<std::vector<uint8_t>>(n * sizeof(TargetSimData));
+				std::mt19937 rng(1);
+				for (auto &b : *payload)
+				{
+					b = static_cast<uint8_t>(rng());
+				}
+				return Fixture{[payload]()
+							   { doNotOptimize(calculateCRC32(payload->data(), payload->size())); },
+							   payload->size()};
+			});
+
+		// 틱당 표적 송신: SoA → TargetSimData 적재, 29개 단위 배치 + CRC, sendto
+		add("sim.flight_target", [](size_t n)
+			{
+				struct Input
+				{
+					UdpSink sink;
+					std::shared_ptr<SimulationEngine> engine;
+					std::shared_ptr<MFRSendUDPManager> sender = std::make_shared<MFRSendUDPManager>();
+					std::unique_ptr<MockTargetManager> manager;
+				};
+				auto in = std::make_shared<Input>();
+				if (in->sink.port == 0 || !in->sender->MFRSocketOpen("127.0.0.1", in->sink.port))
+				{
+					return Fixture{};
+				}
+
+				EngineOptions options;
+				options.workers = 1;
+				in->engine = std::make_shared<SimulationEngine>(options);
+				addTargets(in->engine->targets(), n);
+				in->manager = std::make_unique<MockTargetManager>(in->sender, in->engine);
+
+				return Fixture{[in]()
+							   { in->manager->flitghtTarget(); },
+							   n * sizeof(TargetSimData)};
+			});
+
+		// 고정 스텝 1회 (표적 적분, 작업 스레드 기본값 = 코어 수 - 1)
+		add("sim.engine.step", [](size_t n)
+			{
+				auto engine = std::make_shared<SimulationEngine>(EngineOptions{});
+				addTargets(engine->targets(), n);
+				return Fixture{[engine]()
+							   { engine->step(); }};
+			});
+	}
+}
@@ -141,7 +141,9 @@ void SendSystemStatus(SOCKET client, const std::string& iniPath) {
   //    buffer.resize(3072, 0);  // 0으로 채움
   //}
 
-  // 5. 전송
+  // 5. 전송 (LC 스트림 프레임: [length u32 LE][payload])
+  uint32_t frameLen = static_cast<uint32_t>(buffer.size());
+  send(client, reinterpret_cast<const char*>(&frameLen), sizeof(frameLen), 0);
   send(client, reinterpret_cast<const char*>(buffer.data()), buffer.size(), 0);
   std::cout << "[DEBUG] sizeof(RadarStatus) = " << sizeof(RadarStatus) << "\n";
   std::cout << "[DEBUG] sizeof(LCStatus) = " << sizeof(LCStatus) << "\n";
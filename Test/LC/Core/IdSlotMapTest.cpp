@@ -0,0 +1,239 @@
+// IdSlotMap을 std::unordered_map과 같은 연산열로 돌려 결과 비교
+// - 무작위 upsert/erase/find/eraseIf/sweep/clear, 매 단계 전체 내용과 보관 중인 Handle 확인
+// - 인덱스 끝에서 앞으로 넘어가는 탐사 구간의 역방향 이동 삭제 (모든 삭제 순서)
+// - 삭제 후 슬롯 재사용 시 이전 Handle 무효화
+#include "IdSlotMap.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    int failures = 0;
+    int cases = 0;
+
+    void check(bool ok, const char *what, size_t step)
+    {
+        ++cases;
+        if (!ok)
+        {
+            ++failures;
+            if (failures <= 10)
+                std::printf("FAIL  step=%zu : %s\n", step, what);
+        }
+    }
+
+    struct Item
+    {
+        unsigned int id;
+        int value;
+    };
+
+    using Map = IdSlotMap<Item>;
+    using Ref = std::unordered_map<unsigned int, int>;
+
+    // IdSlotMap::hash와 같은 식 (인덱스 위치를 골라 충돌/순환 구간을 만든다)
+    size_t home(unsigned int id, size_t capacity)
+    {
+        return static_cast<size_t>(static_cast<uint32_t>(id) * 2654435761u) & (capacity - 1);
+    }
+
+    bool same(const Map &map, const Ref &ref, const std::unordered_map<unsigned int, Map::Handle> &handles)
+    {
+        if (map.size() != ref.size())
+            return false;
+        size_t visited = 0;
+        for (const Item &item : map)
+        {
+            auto it = ref.find(item.id);
+            if (it == ref.end() || it->second != item.value)
+                return false;
+            ++visited;
+        }
+        for (const auto &[id, value] : ref)
+        {
+            const Item *item = map.find(id);
+            if (item == nullptr || item->value != value)
+                return false;
+        }
+        // 다른 항목의 삭제로 dense 위치가 바뀌어도 Handle은 같은 항목을 가리켜야 한다
+        for (const auto &[id, handle] : handles)
+        {
+            const Item *item = map.get(handle);
+            if (ref.count(id) ? (item == nullptr || item->id != id) : item != nullptr)
+                return false;
+        }
+        return visited == ref.size();
+    }
+
+    // 전체 비교는 fullCheckEvery 단계마다 (연산별 결과는 매번 확인)
+    void randomOps(unsigned seed, unsigned idRange, size_t steps, size_t fullCheckEvery)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<unsigned> pickId(0, idRange - 1);
+        std::uniform_int_distribution<int> op(0, 99);
+
+        Map map;
+        Ref ref;
+        std::unordered_map<unsigned int, Map::Handle> handles; // 살아 있는 id + 삭제된 id의 이전 Handle
+
+        for (size_t step = 0; step < steps; ++step)
+        {
+            // 연속 ID(실제 표적 104001~)와 넓게 흩어진 ID를 섞음
+            const unsigned id = (step & 1) ? 104001 + pickId(rng) : pickId(rng) * 4096u;
+            const int k = op(rng);
+            if (k < 45)
+            {
+                const int value = static_cast<int>(rng());
+                const Map::Handle h = map.upsert(Item{id, value});
+                const bool existed = ref.count(id) != 0;
+                if (existed)
+                    check(h.slot == handles[id].slot && h.generation == handles[id].generation, "upsert keeps handle", step);
+                ref[id] = value;
+                handles[id] = h;
+            }
+            else if (k < 75)
+            {
+                check(map.erase(id) == (ref.erase(id) != 0), "erase(id) result", step);
+            }
+            else if (k < 85)
+            {
+                auto it = handles.find(id);
+                if (it != handles.end())
+                    check(map.erase(it->second) == (ref.erase(id) != 0), "erase(handle) result", step);
+            }
+            else if (k < 97)
+            {
+                const Item *item = map.find(id);
+                auto it = ref.find(id);
+                check(it == ref.end() ? item == nullptr : (item != nullptr && item->value == it->second), "find", step);
+                check(map.handleOf(id).valid() == (it != ref.end()), "handleOf", step);
+            }
+            else if (k < 98)
+            {
+                const int bit = static_cast<int>(rng() & 7);
+                const size_t removed = map.eraseIf([bit](const Item &item) { return (item.value & 7) == bit; });
+                size_t refRemoved = 0;
+                for (auto it = ref.begin(); it != ref.end();)
+                {
+                    if ((it->second & 7) == bit)
+                    {
+                        it = ref.erase(it);
+                        ++refRemoved;
+                    }
+                    else
+                        ++it;
+                }
+                check(removed == refRemoved, "eraseIf count", step);
+            }
+            else if (k < 99)
+            {
+                // 절반만 다시 보고 → 나머지는 sweep으로 삭제
+                map.beginSweep();
+                Ref kept;
+                for (const auto &[rid, value] : ref)
+                {
+                    if (rid & 1)
+                    {
+                        map.upsert(Item{rid, value});
+                        kept.emplace(rid, value);
+                    }
+                }
+                check(map.endSweep() == ref.size() - kept.size(), "endSweep count", step);
+                ref.swap(kept);
+            }
+            else
+            {
+                map.clear();
+                ref.clear();
+            }
+            if (step % fullCheckEvery == 0)
+                check(same(map, ref, handles), "contents", step);
+        }
+        check(same(map, ref, handles), "final contents", steps);
+    }
+
+    // 용량 16 인덱스의 마지막 두 칸을 home으로 갖는 ID 5개 → 0, 1, 2번 칸으로 넘어가 쌓임
+    // 앞쪽 칸(0, 1)이 home인 ID도 섞어서, 삭제 후 당겨야 하는 항목과 제자리에 있어야 하는 항목이 모두 생기게 함
+    void wraparound()
+    {
+        constexpr size_t CAPACITY = 16; // 첫 rehash 크기, 항목 8개까지 유지
+        std::vector<unsigned> ids;
+        for (unsigned id = 1; ids.size() < 5; ++id)
+        {
+            if (home(id, CAPACITY) >= CAPACITY - 2)
+                ids.push_back(id);
+        }
+        for (unsigned id = 1; ids.size() < 7; ++id)
+        {
+            if (home(id, CAPACITY) <= 1)
+                ids.push_back(id);
+        }
+
+        std::vector<size_t> order(ids.size());
+        for (size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+
+        size_t perm = 0;
+        do
+        {
+            Map map;
+            Ref ref;
+            std::unordered_map<unsigned int, Map::Handle> handles;
+            for (unsigned id : ids)
+            {
+                handles[id] = map.upsert(Item{id, static_cast<int>(id * 3)});
+                ref[id] = static_cast<int>(id * 3);
+            }
+            for (size_t i : order)
+            {
+                check(map.erase(ids[i]), "wraparound erase", perm);
+                ref.erase(ids[i]);
+                check(same(map, ref, handles), "wraparound contents", perm);
+            }
+            ++perm;
+        } while (std::next_permutation(order.begin(), order.end()));
+        check(perm == 5040, "wraparound permutations", perm);
+    }
+
+    void handleReuse()
+    {
+        Map map;
+        const Map::Handle a = map.upsert(Item{104001, 1});
+        const Map::Handle b = map.upsert(Item{104002, 2});
+        map.upsert(Item{104003, 3});
+
+        check(map.erase(104001), "erase a", 0);
+        check(map.get(a) == nullptr && !map.erase(a), "stale handle after erase", 0);
+        check(map.get(b) != nullptr && map.get(b)->id == 104002, "other handle after swap-remove", 0);
+
+        // 빈 슬롯은 재사용되지만 세대가 달라 이전 Handle로는 접근할 수 없다
+        const Map::Handle c = map.upsert(Item{105001, 4});
+        check(c.slot == a.slot && c.generation != a.generation, "slot reused with new generation", 0);
+        check(map.get(a) == nullptr && map.get(c) != nullptr && map.get(c)->id == 105001, "reused slot handles", 0);
+
+        // 같은 ID를 다시 넣어도 새 Handle
+        check(map.erase(104002), "erase b", 0);
+        const Map::Handle b2 = map.upsert(Item{104002, 5});
+        check(map.get(b) == nullptr && map.get(b2) != nullptr && map.get(b2)->value == 5, "re-added id", 0);
+
+        map.clear();
+        check(map.get(b2) == nullptr && map.get(c) == nullptr && map.empty(), "handles after clear", 0);
+        const Map::Handle d = map.upsert(Item{104001, 6});
+        check(map.get(d) != nullptr && map.get(c) == nullptr, "insert after clear", 0);
+    }
+}
+
+int main()
+{
+    randomOps(1, 64, 100000, 1);   // 작은 ID 범위: 삽입/삭제가 자주 겹침
+    randomOps(2, 2000, 100000, 64); // 큰 범위: rehash 여러 번
+    wraparound();
+    handleReuse();
+
+    std::printf("%d checks, %d failures\n", cases, failures);
+    return failures == 0 ? 0 : 1;
+}
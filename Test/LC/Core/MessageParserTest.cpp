@@ -0,0 +1,238 @@
+// MessageParser 잘린 프레임 검증
+// - 명령마다 정상 프레임의 모든 앞부분(1 ~ 길이-1 byte)을 정확한 크기의 버퍼로 넣어 ok == false 확인
+//   (ASan 빌드에서는 버퍼 밖 읽기도 잡힘)
+// - 0x24: 잘린 키프레임/델타가 키프레임 캐시를 망가뜨리지 않아 다음 정상 델타가 그대로 풀리는지 확인
+#include "DetectionDelta.h"
+#include "DetectionEncoder.h"
+#include "MessageParser.h"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using Common::ByteSpan;
+using Common::CommonMessage;
+using Common::MessageParser;
+using Common::RadarDetection;
+
+namespace
+{
+    int failures = 0;
+    int cases = 0;
+
+    void check(bool ok, const char *what, size_t at)
+    {
+        ++cases;
+        if (!ok)
+        {
+            ++failures;
+            if (failures <= 10)
+                std::printf("FAIL  at=%zu : %s\n", at, what);
+        }
+    }
+
+    template <typename T>
+    void put(std::vector<uint8_t> &out, size_t offset, const T &value)
+    {
+        if (out.size() < offset + sizeof(T))
+            out.resize(offset + sizeof(T));
+        std::memcpy(out.data() + offset, &value, sizeof(T));
+    }
+
+    // 앞부분 len byte만 따로 할당해서 파싱 (뒤에 남은 원본 byte를 읽어도 통과하지 않게)
+    CommonMessage parsePrefix(MessageParser &parser, const std::vector<uint8_t> &frame, size_t len, SenderType sender)
+    {
+        std::vector<uint8_t> copy(frame.begin(), frame.begin() + len);
+        return parser.parse(ByteSpan(copy.data(), copy.size()), sender);
+    }
+
+    // 모든 앞부분은 거부, 전체는 수락
+    void checkTruncations(const char *name, const std::vector<uint8_t> &frame, SenderType sender)
+    {
+        MessageParser parser;
+        for (size_t len = 1; len < frame.size(); ++len)
+            check(!parsePrefix(parser, frame, len, sender).ok, name, len);
+        check(parsePrefix(parser, frame, frame.size(), sender).ok, name, frame.size());
+    }
+
+    std::vector<uint8_t> fixedFrame(uint8_t cmd, size_t size)
+    {
+        std::vector<uint8_t> f(size, 0);
+        f[0] = cmd;
+        for (size_t i = 1; i < size; ++i)
+            f[i] = static_cast<uint8_t>(i * 7);
+        return f;
+    }
+
+    std::vector<MfrToLcTargetInfo> makeTargets(size_t n, size_t frame)
+    {
+        std::vector<MfrToLcTargetInfo> out(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            MfrToLcTargetInfo &t = out[i];
+            t.id = 104001 + static_cast<unsigned>(i);
+            t.targetCoords = EncodedPos3D{375000000 + static_cast<long long>(frame * 31 + i * 1000),
+                                          1270000000 - static_cast<long long>(frame * 17 + i * 1000),
+                                          5000 + static_cast<long long>(i)};
+            t.targetSpeed = 900 + static_cast<int>(i);
+            t.targetAngle = 45.0 + static_cast<double>(frame);
+            t.targetAngle2 = 1.5;
+            t.firstDetectionTime = 1700000000000ULL + i;
+            t.prioirty = static_cast<unsigned char>(1 + i % 5);
+            t.isHit = (i == 3 && frame > 0);
+        }
+        return out;
+    }
+
+    std::vector<MfrToLcMissileInfo> makeMissiles(size_t n, size_t frame)
+    {
+        std::vector<MfrToLcMissileInfo> out(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            MfrToLcMissileInfo &m = out[i];
+            m.id = 105001 + static_cast<unsigned>(i);
+            m.missileCoords = EncodedPos3D{375100000 + static_cast<long long>(frame * 50), 1270100000, 3000};
+            m.missileSpeed = 3000;
+            m.missileAngle = 10.0;
+            m.firstDetectionTime = 1700000000500ULL;
+            m.timeToIntercept = 1700000009000ULL - frame;
+            m.isHit = false;
+        }
+        return out;
+    }
+
+    bool sameDetection(const RadarDetection &d, const std::vector<MfrToLcTargetInfo> &targets,
+                       const std::vector<MfrToLcMissileInfo> &missiles)
+    {
+        if (d.targets.size() != targets.size() || d.missiles.size() != missiles.size())
+            return false;
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            const RadarDetection::Target &a = d.targets[i];
+            const MfrToLcTargetInfo &b = targets[i];
+            if (a.id != b.id || a.posX != b.targetCoords.latitude || a.posY != b.targetCoords.longitude ||
+                a.altitude != b.targetCoords.altitude || a.speed != b.targetSpeed || a.angle1 != b.targetAngle ||
+                a.angle2 != b.targetAngle2 || a.detectTime != b.firstDetectionTime || a.priority != b.prioirty ||
+                a.hit != b.isHit)
+                return false;
+        }
+        for (size_t i = 0; i < missiles.size(); ++i)
+        {
+            const RadarDetection::Missile &a = d.missiles[i];
+            const MfrToLcMissileInfo &b = missiles[i];
+            if (a.id != b.id || a.posX != b.missileCoords.latitude || a.posY != b.missileCoords.longitude ||
+                a.altitude != b.missileCoords.altitude || a.speed != b.missileSpeed || a.angle != b.missileAngle ||
+                a.detectTime != b.firstDetectionTime || a.interceptTime != b.timeToIntercept || a.hit != b.isHit)
+                return false;
+        }
+        return true;
+    }
+
+    const RadarDetection *detection(const CommonMessage &msg)
+    {
+        return msg.ok ? std::get_if<RadarDetection>(&msg.payload) : nullptr;
+    }
+
+    void detectionV2()
+    {
+        constexpr unsigned RADAR_ID = 101001;
+        DetectionEncoder encoder(RADAR_ID);
+        MessageParser parser;
+        std::vector<char> packet;
+        const trace::Context ctx{42, 1700000000123456ULL};
+
+        encoder.encode(makeTargets(8, 0), makeMissiles(2, 0), ctx, packet);
+        const std::vector<uint8_t> keyframe(packet.begin(), packet.end());
+        check((keyframe[2] & detection_v2::FLAG_KEYFRAME) != 0, "first frame is keyframe", 0);
+
+        // 키프레임이 없을 때 잘린 키프레임은 모두 거부
+        for (size_t len = 1; len < keyframe.size(); ++len)
+            check(!parsePrefix(parser, keyframe, len, SenderType::MFR).ok, "truncated keyframe", len);
+
+        CommonMessage msg = parsePrefix(parser, keyframe, keyframe.size(), SenderType::MFR);
+        const RadarDetection *d = detection(msg);
+        check(d && sameDetection(*d, makeTargets(8, 0), makeMissiles(2, 0)), "keyframe", keyframe.size());
+        check(d && d->trace.id == ctx.id && d->trace.originUs == ctx.originUs, "keyframe trace", keyframe.size());
+
+        // 같은 표적이 움직인 다음 프레임은 델타
+        const std::vector<MfrToLcTargetInfo> targets1 = makeTargets(8, 1);
+        const std::vector<MfrToLcMissileInfo> missiles1 = makeMissiles(2, 1);
+        encoder.encode(targets1, missiles1, ctx, packet);
+        const std::vector<uint8_t> delta(packet.begin(), packet.end());
+        check((delta[2] & detection_v2::FLAG_KEYFRAME) == 0, "second frame is delta", 0);
+
+        for (size_t len = 1; len < delta.size(); ++len)
+            check(!parsePrefix(parser, delta, len, SenderType::MFR).ok, "truncated delta", len);
+        // 잘린 키프레임(이미 받은 것과 같은 keySeq)도 캐시를 건드리면 안 됨
+        for (size_t len = detection_v2::HEADER_SIZE; len < keyframe.size(); len += 13)
+            check(!parsePrefix(parser, keyframe, len, SenderType::MFR).ok, "truncated keyframe after keyframe", len);
+
+        msg = parsePrefix(parser, delta, delta.size(), SenderType::MFR);
+        d = detection(msg);
+        check(d && sameDetection(*d, targets1, missiles1), "delta after truncated frames", delta.size());
+    }
+
+    void detectionV1()
+    {
+        constexpr size_t TARGETS = 3, MISSILES = 2;
+        std::vector<uint8_t> f;
+        f.push_back(0x22);
+        put(f, 1, static_cast<unsigned>(101001));
+        f.push_back(TARGETS);
+        f.push_back(MISSILES);
+        size_t offset = f.size();
+        for (size_t i = 0; i < TARGETS; ++i, offset += detection_v2::TARGET_RECORD_SIZE)
+        {
+            put(f, offset, static_cast<unsigned>(104001 + i));
+            put(f, offset + 4, 375000000LL + static_cast<long long>(i));
+            put(f, offset + 56, static_cast<uint8_t>(2));
+            put(f, offset + 57, static_cast<uint8_t>(0));
+        }
+        for (size_t i = 0; i < MISSILES; ++i, offset += detection_v2::MISSILE_RECORD_SIZE)
+        {
+            put(f, offset, static_cast<unsigned>(105001 + i));
+            put(f, offset + 56, static_cast<uint8_t>(0));
+        }
+        check(f.size() == 7 + TARGETS * detection_v2::TARGET_RECORD_SIZE + MISSILES * detection_v2::MISSILE_RECORD_SIZE,
+              "0x22 frame size", f.size());
+
+        // 일부 레코드만 남은 목록을 넘기면 빠진 표적이 삭제되므로 잘린 0x22도 거부
+        checkTruncations("0x22", f, SenderType::MFR);
+
+        MessageParser parser;
+        const CommonMessage msg = parsePrefix(parser, f, f.size(), SenderType::MFR);
+        const RadarDetection *d = detection(msg);
+        check(d && d->targets.size() == TARGETS && d->missiles.size() == MISSILES && d->targets[2].id == 104003 &&
+                  d->targets[2].posX == 375000002LL && d->missiles[1].id == 105002,
+              "0x22 records", f.size());
+    }
+}
+
+int main()
+{
+    // 거부될 때마다 파서가 남기는 오류 출력은 숨김
+    std::ostringstream sink;
+    std::streambuf *cerrBuf = std::cerr.rdbuf(sink.rdbuf());
+
+    checkTruncations("0x02 radar mode", fixedFrame(0x02, 11), SenderType::ECC);
+    checkTruncations("0x03 launcher mode", fixedFrame(0x03, 6), SenderType::ECC);
+    checkTruncations("0x04 fire", fixedFrame(0x04, 9), SenderType::ECC);
+    checkTruncations("0x05 move", fixedFrame(0x05, 21), SenderType::ECC);
+    checkTruncations("0x06 subscribe", fixedFrame(0x06, 5), SenderType::ECC);
+    checkTruncations("0x21 radar status", fixedFrame(0x21, 38), SenderType::MFR);
+    checkTruncations("0x41 LS status", fixedFrame(0x41, 42), SenderType::LS);
+    detectionV1();
+    detectionV2();
+
+    // 빈 데이터, 송신자에 없는 명령
+    MessageParser parser;
+    check(!parser.parse(ByteSpan(), SenderType::ECC).ok, "empty", 0);
+    const std::vector<uint8_t> unknown = fixedFrame(0x24, 20);
+    check(!parser.parse(ByteSpan(unknown), SenderType::ECC).ok, "0x24 from ECC", unknown.size());
+
+    std::cerr.rdbuf(cerrBuf);
+    std::printf("%d checks, %d failures\n", cases, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+// StreamFramer 재조립 검증: 같은 프레임 열을 1 byte씩, 무작위 크기로, 한 번에 넣어도 같은 프레임이 같은 순서로 나와야 한다
+// (빈 프레임, 버퍼보다 큰 프레임, 최대 크기 초과, 소켓 recv 경로 포함)
+// SendQueue: 상대가 읽지 않으면 쌓였다가 최대 크기에서 Full, 이후 flush로 빠짐없이 같은 순서로 전달
+#include "StreamFramer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using stream::StreamFramer;
+
+namespace
+{
+    int failures = 0;
+    int cases = 0;
+
+    void check(bool ok, const char *what, size_t at)
+    {
+        ++cases;
+        if (!ok)
+        {
+            ++failures;
+            std::printf("FAIL  at=%zu : %s\n", at, what);
+        }
+    }
+
+    using Frame = std::vector<uint8_t>;
+
+    void appendFrame(std::vector<uint8_t> &stream, const Frame &frame)
+    {
+        const size_t len = frame.size();
+        stream.push_back(static_cast<uint8_t>(len));
+        stream.push_back(static_cast<uint8_t>(len >> 8));
+        stream.push_back(static_cast<uint8_t>(len >> 16));
+        stream.push_back(static_cast<uint8_t>(len >> 24));
+        stream.insert(stream.end(), frame.begin(), frame.end());
+    }
+
+    std::vector<Frame> makeFrames(std::mt19937 &rng, size_t count)
+    {
+        std::uniform_int_distribution<int> kind(0, 9);
+        std::uniform_int_distribution<size_t> small(1, 300);
+        std::uniform_int_distribution<size_t> large(1000, 20000);
+        std::vector<Frame> frames(count);
+        for (Frame &f : frames)
+        {
+            const int k = kind(rng);
+            const size_t len = k == 0 ? 0 : (k == 1 ? large(rng) : small(rng));
+            f.resize(len);
+            for (uint8_t &b : f)
+                b = static_cast<uint8_t>(rng());
+        }
+        return frames;
+    }
+
+    // chunk(i)가 돌려준 크기로 잘라 넣고 받은 프레임을 모은다
+    template <typename Chunk>
+    std::vector<Frame> feedChunks(StreamFramer &framer, const std::vector<uint8_t> &stream, Chunk chunk, bool &ok)
+    {
+        std::vector<Frame> out;
+        ok = true;
+        for (size_t pos = 0; pos < stream.size();)
+        {
+            const size_t n = std::min(chunk(), stream.size() - pos);
+            const StreamFramer::Status status = framer.feed(stream.data() + pos, n, [&](const uint8_t *data, size_t len)
+                                                            { out.emplace_back(data, data + len); });
+            ok = ok && status == StreamFramer::Status::Ok;
+            pos += n;
+        }
+        return out;
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(7);
+    const std::vector<Frame> frames = makeFrames(rng, 400);
+    std::vector<uint8_t> stream;
+    for (const Frame &f : frames)
+        appendFrame(stream, f);
+
+    // 작은 초기 버퍼로 앞당김/확장 경로를 모두 지나게 한다
+    {
+        StreamFramer framer(64);
+        bool ok;
+        const std::vector<Frame> out = feedChunks(framer, stream, []() { return size_t(1); }, ok);
+        check(ok && out == frames, "byte-by-byte split", 1);
+        check(framer.pendingBytes() == 0, "byte-by-byte pending", 1);
+    }
+    for (size_t maxChunk : {7u, 100u, 5000u, 70000u})
+    {
+        StreamFramer framer(256);
+        std::uniform_int_distribution<size_t> size(1, maxChunk);
+        bool ok;
+        const std::vector<Frame> out = feedChunks(framer, stream, [&]() { return size(rng); }, ok);
+        check(ok && out == frames, "random split", maxChunk);
+        check(framer.pendingBytes() == 0, "random split pending", maxChunk);
+    }
+    {
+        StreamFramer framer;
+        bool ok;
+        const std::vector<Frame> out = feedChunks(framer, stream, [&]() { return stream.size(); }, ok);
+        check(ok && out == frames, "coalesced", stream.size());
+    }
+
+    // 접두만 온 상태에서는 아무것도 넘기지 않고 기다린다
+    {
+        StreamFramer framer(64);
+        size_t got = 0;
+        auto count = [&](const uint8_t *, size_t) { ++got; };
+        std::vector<uint8_t> one;
+        appendFrame(one, Frame(10, 0xAB));
+        framer.feed(one.data(), 3, count);
+        framer.feed(one.data() + 3, 5, count);
+        check(got == 0 && framer.pendingBytes() == 8, "partial frame held", 8);
+        framer.feed(one.data() + 8, one.size() - 8, count);
+        check(got == 1 && framer.pendingBytes() == 0, "partial frame completed", one.size());
+    }
+
+    // 최대 크기를 넘는 길이는 동기화 불가 → Oversize, 버퍼는 비운다
+    {
+        StreamFramer framer(64, 1000);
+        std::vector<uint8_t> bad;
+        appendFrame(bad, Frame(1001, 0));
+        size_t got = 0;
+        const StreamFramer::Status status = framer.feed(bad.data(), 8, [&](const uint8_t *, size_t) { ++got; });
+        check(status == StreamFramer::Status::Oversize && got == 0 && framer.pendingBytes() == 0, "oversize", 1001);
+    }
+
+    // 소켓 경로: 한 프레임을 두 번에 나눠 쓰고, 이어서 두 프레임을 한 번에 쓴다
+    int fds[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+    {
+        std::perror("socketpair");
+        return 1;
+    }
+    {
+        StreamFramer framer(64);
+        std::vector<Frame> out;
+        auto collect = [&](const uint8_t *data, size_t len) { out.emplace_back(data, data + len); };
+
+        std::vector<uint8_t> first;
+        appendFrame(first, frames[1]);
+        check(write(fds[0], first.data(), 2) == 2, "write", 2);
+        check(framer.receive(fds[1], collect) == StreamFramer::Status::Ok && out.empty(), "receive partial", 2);
+        check(write(fds[0], first.data() + 2, first.size() - 2) == static_cast<ssize_t>(first.size() - 2), "write", first.size());
+        while (framer.pendingBytes() > 0 || out.empty())
+        {
+            if (framer.receive(fds[1], collect) != StreamFramer::Status::Ok)
+                break;
+        }
+        check(out.size() == 1 && out[0] == frames[1], "receive split", first.size());
+
+        out.clear();
+        check(stream::sendFrame(fds[0], frames[2].data(), frames[2].size()) &&
+                  stream::sendFrame(fds[0], frames[3].data(), frames[3].size()),
+              "sendFrame", 0);
+        while (out.size() < 2)
+        {
+            if (framer.receive(fds[1], collect) != StreamFramer::Status::Ok)
+                break;
+        }
+        check(out.size() == 2 && out[0] == frames[2] && out[1] == frames[3], "receive coalesced", 0);
+
+        close(fds[0]);
+        check(framer.receive(fds[1], collect) == StreamFramer::Status::Closed, "receive closed", 0);
+        close(fds[1]);
+    }
+
+    // 논블로킹 송신 큐
+    {
+        int fds[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds) != 0)
+        {
+            std::perror("socketpair");
+            return 1;
+        }
+
+        StreamFramer framer;
+        std::vector<Frame> out;
+        auto collect = [&](const uint8_t *data, size_t len) { out.emplace_back(data, data + len); };
+        check(framer.receive(fds[1], collect) == StreamFramer::Status::Ok && out.empty(), "receive EAGAIN", 0);
+
+        constexpr size_t maxBytes = 256 * 1024;
+        stream::SendQueue queue(maxBytes);
+        std::vector<Frame> sent;
+        stream::SendQueue::Status status = stream::SendQueue::Status::Ok;
+        for (size_t i = 0; status == stream::SendQueue::Status::Ok && i < 10000; ++i)
+        {
+            Frame frame(1000 + i % 700, static_cast<uint8_t>(i));
+            status = queue.push(fds[0], frame.data(), frame.size());
+            if (status == stream::SendQueue::Status::Ok)
+                sent.push_back(std::move(frame));
+        }
+        check(status == stream::SendQueue::Status::Full, "queue full", sent.size());
+        check(queue.pendingBytes() > 0 && queue.pendingBytes() <= maxBytes, "queue bound", queue.pendingBytes());
+
+        for (int round = 0; round < 10000 && (queue.pendingBytes() > 0 || out.size() < sent.size()); ++round)
+        {
+            check(queue.flush(fds[0]) == stream::SendQueue::Status::Ok, "flush", round);
+            if (framer.receive(fds[1], collect) != StreamFramer::Status::Ok)
+                break;
+        }
+        check(queue.pendingBytes() == 0, "queue drained", queue.pendingBytes());
+        check(out == sent, "queue order", out.size());
+
+        close(fds[1]);
+        const Frame frame(16, 0);
+        check(queue.push(fds[0], frame.data(), frame.size()) == stream::SendQueue::Status::Error, "peer closed", 0);
+        close(fds[0]);
+    }
+
+    std::printf("%zu frames, %zu bytes\n", frames.size(), stream.size());
+    std::printf("%d checks, %d failures\n", cases, failures);
+    return failures == 0 ? 0 : 1;
+}
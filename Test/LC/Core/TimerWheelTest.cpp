@@ -0,0 +1,188 @@
+// TimerWheel 결정적 검증 (실제 시계 없이 tick을 직접 진행)
+// - 주기 → tick 올림, 0 주기 보정
+// - 실행 tick 열, 휠 한 바퀴보다 긴 주기
+// - setPeriod 재예약 (이전 슬롯 항목은 실행되지 않음)
+// - 지연 삭제 (콜백 안에서 자기/다른 작업 삭제, 추가)
+// - 밀린 주기 건너뛰기와 missed() 누적
+#include "TimerWheel.h"
+
+#include <cstdio>
+#include <vector>
+
+using std::chrono::milliseconds;
+
+namespace
+{
+    int failures = 0;
+    int cases = 0;
+
+    void check(bool ok, const char *what, uint64_t tick)
+    {
+        ++cases;
+        if (!ok)
+        {
+            ++failures;
+            std::printf("FAIL  tick=%llu : %s\n", static_cast<unsigned long long>(tick), what);
+        }
+    }
+
+    using Ticks = std::vector<uint64_t>;
+
+    // 1 tick씩 진행
+    void runTo(TimerWheel &wheel, uint64_t &now, uint64_t until)
+    {
+        while (now < until)
+            wheel.advance(++now);
+    }
+
+    void periodRounding()
+    {
+        const milliseconds tick(10);
+        check(TimerWheel::toTicks(milliseconds(10), tick) == 1, "10ms", 10);
+        check(TimerWheel::toTicks(milliseconds(11), tick) == 2, "11ms rounds up", 11);
+        check(TimerWheel::toTicks(milliseconds(15), tick) == 2, "15ms rounds up", 15);
+        check(TimerWheel::toTicks(milliseconds(20), tick) == 2, "20ms", 20);
+        check(TimerWheel::toTicks(milliseconds(1000), tick) == 100, "1s", 1000);
+        check(TimerWheel::toTicks(milliseconds(1), tick) == 1, "1ms -> 1 tick", 1);
+        check(TimerWheel::toTicks(milliseconds(0), tick) == 1, "0ms -> 1 tick", 0);
+        check(TimerWheel::toTicks(milliseconds(-5), tick) == 1, "negative -> 1 tick", 0);
+        check(TimerWheel::toTicks(milliseconds(7), milliseconds(1)) == 7, "1ms tick", 7);
+
+        // 0 주기는 매 tick
+        TimerWheel wheel(8);
+        uint64_t now = 0;
+        int count = 0;
+        wheel.add(0, [&]() { ++count; }, now);
+        runTo(wheel, now, 5);
+        check(count == 5, "period 0 clamps to 1", now);
+    }
+
+    void schedule()
+    {
+        TimerWheel wheel(8);
+        uint64_t now = 0;
+        Ticks fast, slow;
+        wheel.add(3, [&]() { fast.push_back(now); }, now);
+        wheel.add(20, [&]() { slow.push_back(now); }, now); // 휠(8칸)보다 긴 주기
+        runTo(wheel, now, 45);
+        check(fast == Ticks({3, 6, 9, 12, 15, 18, 21, 24, 27, 30, 33, 36, 39, 42, 45}), "period 3", now);
+        check(slow == Ticks({20, 40}), "period longer than wheel", now);
+        check(wheel.missed() == 0, "no missed", now);
+
+        // 진행된 시각보다 이전 nowTick으로 추가하면 진행된 시각 기준
+        Ticks late;
+        wheel.add(2, [&]() { late.push_back(now); }, 10);
+        runTo(wheel, now, 50);
+        check(late == Ticks({47, 49}), "add uses last advanced tick", now);
+
+        // 같은 tick 또는 이전 tick으로 advance하면 아무 일도 없음
+        const size_t before = fast.size();
+        wheel.advance(now);
+        wheel.advance(now - 3);
+        check(fast.size() == before, "advance backwards is no-op", now);
+    }
+
+    void setPeriod()
+    {
+        TimerWheel wheel(8);
+        uint64_t now = 0;
+        Ticks fired;
+        const TimerWheel::TimerId id = wheel.add(3, [&]() { fired.push_back(now); }, now);
+        runTo(wheel, now, 7);
+        check(fired == Ticks({3, 6}), "before setPeriod", now);
+
+        // 9에 있던 이전 항목은 버려지고 7 + 5부터
+        check(wheel.setPeriod(id, 5, now), "setPeriod", now);
+        runTo(wheel, now, 25);
+        check(fired == Ticks({3, 6, 12, 17, 22}), "after setPeriod", now);
+
+        // 콜백 안에서 주기 변경
+        TimerWheel wheel2(8);
+        now = 0;
+        Ticks fired2;
+        TimerWheel::TimerId id2 = 0;
+        id2 = wheel2.add(2, [&]()
+                         {
+                             fired2.push_back(now);
+                             if (now == 4)
+                                 wheel2.setPeriod(id2, 6, now);
+                         },
+                         now);
+        runTo(wheel2, now, 20);
+        check(fired2 == Ticks({2, 4, 10, 16}), "setPeriod inside callback", now);
+
+        check(!wheel.setPeriod(9999, 5, now), "setPeriod unknown id", now);
+    }
+
+    void lazyRemoval()
+    {
+        TimerWheel wheel(4);
+        uint64_t now = 0;
+        Ticks a, b, c, added;
+        TimerWheel::TimerId idA = 0, idB = 0, idC = 0;
+
+        idA = wheel.add(2, [&]()
+                        {
+                            a.push_back(now);
+                            if (now == 6)
+                                wheel.remove(idA); // 자기 자신
+                        },
+                        now);
+        // 같은 마감(4)에 먼저 실행되는 작업이 뒤 작업을 삭제
+        idB = wheel.add(4, [&]()
+                        {
+                            b.push_back(now);
+                            wheel.remove(idC);
+                            wheel.add(3, [&]() { added.push_back(now); }, now);
+                        },
+                        now);
+        idC = wheel.add(4, [&]() { c.push_back(now); }, now);
+        check(wheel.size() == 3, "size after add", now);
+
+        runTo(wheel, now, 4);
+        check(b == Ticks({4}) && c.empty(), "removed by earlier callback in same slot", now);
+        check(wheel.remove(idB) && !wheel.remove(idB), "remove twice", now);
+        check(!wheel.remove(idC), "already removed", now);
+
+        runTo(wheel, now, 12);
+        check(a == Ticks({2, 4, 6}), "removed itself", now);
+        check(b == Ticks({4}), "removed outside callback", now);
+        check(added == Ticks({7, 10}), "added inside callback", now);
+        check(wheel.size() == 1, "size after removals", now);
+        check(wheel.missed() == 0, "no missed", now);
+    }
+
+    void missed()
+    {
+        TimerWheel wheel(8);
+        uint64_t now = 0;
+        Ticks fired;
+        wheel.add(2, [&]() { fired.push_back(now); }, now);
+
+        // 2, 4, 6, 8, 10 마감 → 한 번만 실행, 4개 건너뜀, 다음 마감은 12
+        now = 11;
+        wheel.advance(now);
+        check(fired == Ticks({11}) && wheel.missed() == 4, "missed within one lap", now);
+        runTo(wheel, now, 14);
+        check(fired == Ticks({11, 12, 14}), "back on schedule", now);
+
+        // 휠 한 바퀴(8)보다 많이 밀림: 16 ~ 100 중 짝수 마감 43개 → 실행 1, 건너뜀 42
+        now = 100;
+        wheel.advance(now);
+        check(fired.size() == 4 && fired.back() == 100 && wheel.missed() == 4 + 42, "missed over several laps", now);
+        runTo(wheel, now, 104);
+        check(fired == Ticks({11, 12, 14, 100, 102, 104}), "back on schedule after laps", now);
+    }
+}
+
+int main()
+{
+    periodRounding();
+    schedule();
+    setPeriod();
+    lazyRemoval();
+    missed();
+
+    std::printf("%d checks, %d failures\n", cases, failures);
+    return failures == 0 ? 0 : 1;
+}
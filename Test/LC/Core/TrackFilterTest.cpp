@@ -0,0 +1,275 @@
+// TrackFilter 검증 (시각을 직접 넣어 결정적으로 진행)
+// - 등속 표적 수렴: 초기 속력이 틀려도 위치/속도가 참값에 수렴 (측정 시각은 LC와 다른 시계)
+// - 재보고 무시: 같은 측정 시각(update), 같은 위치(updateReceived)는 상태를 바꾸지 않음
+// - resetSec보다 긴 공백 뒤에는 보고 위치/방위로 트랙을 새로 시작
+// - endReport의 swap-remove 뒤에도 id → 트랙 대응 유지
+// - extrapolate: maxPredictSec까지만 외삽, 명중 표적은 건드리지 않음
+#include "TrackFilter.h"
+#include "InterceptSolver.h"
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    int failures = 0;
+    int cases = 0;
+
+    void check(bool ok, const char *what, size_t at)
+    {
+        ++cases;
+        if (!ok)
+        {
+            ++failures;
+            if (failures <= 10)
+                std::printf("FAIL  at=%zu : %s\n", at, what);
+        }
+    }
+
+    constexpr uint64_t LC_BASE_US = 1700000000000000ULL; // LC 수신 시계
+    constexpr uint64_t SIM_BASE_US = 42000000ULL;        // 시뮬레이터 호스트 시계 (LC와 무관)
+    constexpr double LAT0 = 37.5;
+    constexpr double LON0 = 127.0;
+
+    uint64_t us(double sec) { return static_cast<uint64_t>(std::llround(sec * 1e6)); }
+
+    // 북쪽 vN, 동쪽 vE (m/s)로 움직이는 표적의 t초 위치
+    TargetStatus makeTarget(unsigned int id, double t, double vN, double vE, int speedKmh, double heading)
+    {
+        TargetStatus target{};
+        target.id = id;
+        target.posX = std::llround((LAT0 + vN * t / geo::METERS_PER_DEG_LAT) * geo::COORD_SCALE);
+        target.posY = std::llround((LON0 + vE * t / geo::metersPerDegLon(LAT0)) * geo::COORD_SCALE);
+        target.altitude = 5000;
+        target.speed = speedKmh;
+        target.angle1 = heading;
+        target.angle2 = 0.0;
+        return target;
+    }
+
+    double distanceM(const TrackFilter::State &s, const TargetStatus &target)
+    {
+        const double dN = (s.lat - static_cast<double>(target.posX) / geo::COORD_SCALE) * geo::METERS_PER_DEG_LAT;
+        const double dE = (s.lon - static_cast<double>(target.posY) / geo::COORD_SCALE) * geo::metersPerDegLon(LAT0);
+        return std::hypot(dN, dE);
+    }
+
+    bool sameState(const TrackFilter::State &a, const TrackFilter::State &b)
+    {
+        return a.lat == b.lat && a.lon == b.lon && a.alt == b.alt && a.vLat == b.vLat && a.vLon == b.vLon &&
+               a.vAlt == b.vAlt;
+    }
+
+    void report(TrackFilter &filter, const TargetStatus &target, uint64_t receivedUs, uint64_t measuredUs)
+    {
+        filter.beginReport();
+        filter.update(target, receivedUs, measuredUs);
+        filter.endReport();
+    }
+
+    void convergence()
+    {
+        // 200 m/s 북동진 표적, MFR 속력은 0으로 보고 (초기 속도가 틀린 상태에서 시작)
+        const double vN = 120.0, vE = 160.0;
+        TrackFilter filter;
+        for (int ms = 0; ms <= 10000; ms += 10)
+        {
+            // 같은 100ms 샘플을 10ms마다 재보고, 수신 시각은 LC 시계
+            const int sampleMs = ms / 100 * 100;
+            const TargetStatus target = makeTarget(1, sampleMs / 1000.0, vN, vE, 0, 0.0);
+            report(filter, target, LC_BASE_US + us(ms / 1000.0), SIM_BASE_US + us(sampleMs / 1000.0));
+        }
+
+        // 마지막 샘플(10.0s)은 LC 10.0s에 받았으므로 LC 10.05s 예측은 10.05s 참 위치
+        TrackFilter::State s{};
+        check(filter.predict(1, LC_BASE_US + us(10.05), s), "track exists", 0);
+        const double err = distanceM(s, makeTarget(1, 10.05, vN, vE, 0, 0.0));
+        check(err < 1.0, "converged position", static_cast<size_t>(err * 100));
+        const double estN = s.vLat * geo::METERS_PER_DEG_LAT;
+        const double estE = s.vLon * geo::metersPerDegLon(LAT0);
+        check(std::fabs(estN - vN) < 0.5 && std::fabs(estE - vE) < 0.5, "converged velocity",
+              static_cast<size_t>(std::hypot(estN - vN, estE - vE) * 100));
+        check(std::fabs(s.vAlt) < 1e-9, "level flight", 0);
+    }
+
+    void repeatsIgnored()
+    {
+        TrackFilter filter;
+        report(filter, makeTarget(1, 0.0, 100.0, 0.0, 360, 0.0), LC_BASE_US, SIM_BASE_US);
+        report(filter, makeTarget(1, 0.1, 100.0, 0.0, 360, 0.0), LC_BASE_US + us(0.1), SIM_BASE_US + us(0.1));
+
+        TrackFilter::State before{}, after{};
+        const uint64_t at = LC_BASE_US + us(0.5);
+        filter.predict(1, at, before);
+
+        // 같은 측정 시각: 위치가 달라도(재보고 중 값이 바뀐 것처럼 보여도) 무시, 트랙 시각도 그대로
+        report(filter, makeTarget(1, 0.3, 100.0, 0.0, 360, 0.0), LC_BASE_US + us(0.13), SIM_BASE_US + us(0.1));
+        filter.predict(1, at, after);
+        check(sameState(before, after), "same measuredUs ignored", 0);
+
+        // 순서가 뒤바뀐 측정도 무시
+        report(filter, makeTarget(1, 0.05, 100.0, 0.0, 360, 0.0), LC_BASE_US + us(0.15), SIM_BASE_US + us(0.05));
+        filter.predict(1, at, after);
+        check(sameState(before, after), "older measuredUs ignored", 0);
+        check(filter.size() == 1, "repeat keeps track", filter.size());
+
+        // 측정 시각 없이 수신 시각만: 같은 위치는 재보고
+        TrackFilter received;
+        const TargetStatus first = makeTarget(2, 0.0, 100.0, 0.0, 360, 0.0);
+        received.beginReport();
+        received.updateReceived(first, LC_BASE_US);
+        received.endReport();
+        received.predict(2, at, before);
+        for (int i = 1; i <= 9; ++i)
+        {
+            received.beginReport();
+            received.updateReceived(first, LC_BASE_US + us(0.01 * i));
+            received.endReport();
+        }
+        received.predict(2, at, after);
+        check(sameState(before, after), "same position ignored", 0);
+
+        // 위치가 바뀌면 갱신
+        received.beginReport();
+        received.updateReceived(makeTarget(2, 0.1, 100.0, 0.0, 360, 0.0), LC_BASE_US + us(0.1));
+        received.endReport();
+        received.predict(2, at, after);
+        check(!sameState(before, after), "new position updates", 0);
+    }
+
+    void resetAfterGap()
+    {
+        TrackFilter::Options options;
+        options.resetSec = 1.0;
+        TrackFilter filter(options);
+
+        // 북쪽 100 m/s로 수렴시킨 뒤
+        for (int i = 0; i <= 20; ++i)
+            report(filter, makeTarget(1, i * 0.1, 100.0, 0.0, 360, 0.0), LC_BASE_US + us(i * 0.1),
+                   SIM_BASE_US + us(i * 0.1));
+
+        // 1.5s 공백 후 동쪽 방위(90도), 720 km/h로 다시 보고 → 보고 값으로 새로 시작
+        TargetStatus target = makeTarget(1, 3.5, 100.0, 0.0, 720, 90.0);
+        const uint64_t receivedUs = LC_BASE_US + us(3.5);
+        report(filter, target, receivedUs, SIM_BASE_US + us(3.5));
+
+        TrackFilter::State s{};
+        check(filter.predict(1, receivedUs, s), "track exists", 0);
+        check(distanceM(s, target) < 1e-6, "reset position", 0);
+
+        const geo::Enu v = InterceptSolver::velocityFromHeading(720 * geo::KMH_TO_MPS, 90.0, 0.0);
+        check(std::fabs(s.vLat * geo::METERS_PER_DEG_LAT - v.north) < 1e-6, "reset vLat", 0);
+        check(std::fabs(s.vLon * geo::metersPerDegLon(s.lat) - v.east) < 1e-6, "reset vLon", 0);
+
+        // 공백이 resetSec 이하면 이어서 갱신 (위치가 보고값과 다름)
+        TrackFilter kept(options);
+        for (int i = 0; i <= 20; ++i)
+            report(kept, makeTarget(1, i * 0.1, 100.0, 0.0, 360, 0.0), LC_BASE_US + us(i * 0.1),
+                   SIM_BASE_US + us(i * 0.1));
+        target = makeTarget(1, 2.8, 150.0, 0.0, 720, 90.0);
+        report(kept, target, LC_BASE_US + us(2.8), SIM_BASE_US + us(2.8));
+        kept.predict(1, LC_BASE_US + us(2.8), s);
+        check(distanceM(s, target) > 1.0, "within resetSec filtered", 0);
+    }
+
+    void swapRemove()
+    {
+        TrackFilter filter;
+        const uint64_t t0 = LC_BASE_US;
+
+        // id마다 다른 위치 (id * 1km 북쪽)
+        auto targetOf = [](unsigned int id) {
+            TargetStatus target = makeTarget(id, 0.0, 0.0, 0.0, 0, 0.0);
+            target.posX += std::llround(id * 1000.0 / geo::METERS_PER_DEG_LAT * geo::COORD_SCALE);
+            return target;
+        };
+        auto reportIds = [&](const std::vector<unsigned int> &ids, uint64_t timeUs) {
+            filter.beginReport();
+            for (unsigned int id : ids)
+                filter.updateReceived(targetOf(id), timeUs);
+            filter.endReport();
+        };
+        auto matches = [&](const std::vector<unsigned int> &ids, const std::vector<unsigned int> &gone) {
+            bool ok = filter.size() == ids.size();
+            TrackFilter::State s{};
+            for (unsigned int id : ids)
+                ok = ok && filter.predict(id, t0, s) && distanceM(s, targetOf(id)) < 1e-6;
+            for (unsigned int id : gone)
+                ok = ok && !filter.predict(id, t0, s);
+            return ok;
+        };
+
+        reportIds({1, 2, 3, 4, 5}, t0);
+        check(matches({1, 2, 3, 4, 5}, {}), "all tracks", filter.size());
+
+        // 앞/중간 삭제 → 뒤 트랙이 빈 자리로 이동
+        reportIds({2, 4, 5}, t0);
+        check(matches({2, 4, 5}, {1, 3}), "remove 1, 3", filter.size());
+
+        // 마지막 트랙 삭제, 새 트랙 추가
+        reportIds({2, 4, 6}, t0);
+        check(matches({2, 4, 6}, {1, 3, 5}), "remove last, add 6", filter.size());
+
+        reportIds({6}, t0);
+        check(matches({6}, {2, 4}), "single track left", filter.size());
+
+        reportIds({}, t0);
+        check(filter.size() == 0, "empty report clears", filter.size());
+    }
+
+    void extrapolateClamp()
+    {
+        TrackFilter::Options options;
+        options.maxPredictSec = 2.0;
+        TrackFilter filter(options);
+
+        // 북쪽 360 km/h(100 m/s) 두 표적, 하나는 명중
+        const TargetStatus moving = makeTarget(1, 0.0, 0.0, 0.0, 360, 0.0);
+        TargetStatus hit = makeTarget(2, 0.0, 0.0, 0.0, 360, 0.0);
+        hit.hit = true;
+        filter.beginReport();
+        filter.update(moving, LC_BASE_US, SIM_BASE_US);
+        filter.update(hit, LC_BASE_US, SIM_BASE_US);
+        filter.endReport();
+
+        auto northM = [](const TargetStatus &t) {
+            return (static_cast<double>(t.posX) / geo::COORD_SCALE - LAT0) * geo::METERS_PER_DEG_LAT;
+        };
+        auto extrapolateAt = [&](uint64_t timeUs) {
+            SystemStatus status;
+            status.targets.upsert(moving);
+            status.targets.upsert(hit);
+            filter.extrapolate(status, timeUs);
+            return status;
+        };
+
+        SystemStatus status = extrapolateAt(LC_BASE_US + us(1.0));
+        check(std::fabs(northM(*status.targets.find(1)) - 100.0) < 0.1, "1s ahead", 1);
+
+        status = extrapolateAt(LC_BASE_US + us(10.0));
+        check(std::fabs(northM(*status.targets.find(1)) - 200.0) < 0.1, "clamped to maxPredictSec", 10);
+        const TargetStatus *kept = status.targets.find(2);
+        check(kept->posX == hit.posX && kept->posY == hit.posY && kept->altitude == hit.altitude, "hit target untouched", 2);
+
+        // 마지막 갱신 이전 시각은 갱신 위치 그대로
+        status = extrapolateAt(LC_BASE_US - us(1.0));
+        check(std::fabs(northM(*status.targets.find(1))) < 0.1, "past clamps to 0", 0);
+
+        TrackFilter::State s{};
+        filter.predict(1, LC_BASE_US + us(10.0), s);
+        check(std::fabs((s.lat - LAT0) * geo::METERS_PER_DEG_LAT - 200.0) < 0.1, "predict clamped", 10);
+    }
+}
+
+int main()
+{
+    convergence();
+    repeatsIgnored();
+    resetAfterGap();
+    swapRemove();
+    extrapolateClamp();
+
+    std::printf("%d checks, %d failures\n", cases, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+// 요격 계산 마이크로벤치마크
+// 기존 LCCommandHandler의 0.1s 시간 탐색(출력 제외)과 InterceptSolver(수평 닫힌 해 / Newton 보정)를
+// 같은 무작위 교전 상황에서 비교한다.
+//   ./intercept_bench [cases=2000] [seed=1]
+#include "InterceptSolver.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Scenario
+    {
+        geo::Enu target;
+        double speed;   // m/s
+        double heading; // deg
+        double climb;   // deg
+        double missileSpeed;
+    };
+
+    struct Outcome
+    {
+        bool ok;
+        double time;
+        double bearing;
+    };
+
+    // 기존 구현: t = 1..2000s 를 0.1s씩 올리며 |사거리/미사일속력 - t| < 0.2 인 첫 t
+    Outcome legacyScan(const Scenario &s)
+    {
+        const double heading = s.heading * geo::DEG_TO_RAD;
+        const double vx = s.speed * std::sin(heading);
+        const double vy = s.speed * std::cos(heading);
+        for (double t = 1.0; t <= 2000.0; t += 0.1)
+        {
+            const double dx = s.target.east + vx * t;
+            const double dy = s.target.north + vy * t;
+            const double required = std::sqrt(dx * dx + dy * dy) / s.missileSpeed;
+            if (std::abs(required - t) < 0.2)
+                return Outcome{true, t, geo::flatBearing(geo::Enu{dx, dy, 0.0})};
+        }
+        return Outcome{false, 0.0, 0.0};
+    }
+
+    template <typename Fn>
+    double nsPerCall(const std::vector<Scenario> &cases, int repeat, Fn fn, double &sink)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; ++r)
+        {
+            for (const auto &s : cases)
+            {
+                const Outcome o = fn(s);
+                sink += o.time;
+            }
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        return elapsed / (static_cast<double>(cases.size()) * repeat);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int numCases = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const unsigned seed = argc > 2 ? static_cast<unsigned>(std::atoi(argv[2])) : 1u;
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> range(5000.0, 80000.0);
+    std::uniform_real_distribution<double> angle(0.0, 360.0);
+    std::uniform_real_distribution<double> targetSpeed(100.0, 700.0);
+    std::uniform_real_distribution<double> climb(-10.0, 10.0);
+    std::uniform_real_distribution<double> altitude(500.0, 12000.0);
+    std::uniform_real_distribution<double> missileSpeed(800.0, 1500.0);
+
+    std::vector<Scenario> cases;
+    cases.reserve(numCases);
+    for (int i = 0; i < numCases; ++i)
+    {
+        const double r = range(rng);
+        const double bearing = angle(rng) * geo::DEG_TO_RAD;
+        cases.push_back(Scenario{geo::Enu{r * std::sin(bearing), r * std::cos(bearing), altitude(rng)},
+                                 targetSpeed(rng), angle(rng), climb(rng), missileSpeed(rng)});
+    }
+
+    InterceptSolver::Options flat;
+    flat.refine = false;
+    const InterceptSolver flatSolver(flat);
+    const InterceptSolver refineSolver;
+
+    auto solveWith = [](const InterceptSolver &solver)
+    {
+        return [&solver](const Scenario &s)
+        {
+            const auto r = solver.solve(s.target, InterceptSolver::velocityFromHeading(s.speed, s.heading, s.climb), s.missileSpeed);
+            return Outcome{r.ok, r.time, r.bearingDeg};
+        };
+    };
+
+    // 정확도: 수평 닫힌 해와 기존 탐색 결과 비교, Newton 보정 후 3차원 잔차
+    int agree = 0, legacyOnly = 0, solverOnly = 0;
+    double maxTimeDiff = 0.0, maxResidual = 0.0, maxShift = 0.0;
+    for (const auto &s : cases)
+    {
+        const Outcome legacy = legacyScan(s);
+        const Outcome closed = solveWith(flatSolver)(s);
+        if (legacy.ok && closed.ok)
+        {
+            ++agree;
+            maxTimeDiff = std::max(maxTimeDiff, std::abs(legacy.time - closed.time));
+        }
+        else if (legacy.ok)
+            ++legacyOnly;
+        else if (closed.ok)
+            ++solverOnly;
+
+        const auto v = InterceptSolver::velocityFromHeading(s.speed, s.heading, s.climb);
+        const auto refined = refineSolver.solve(s.target, v, s.missileSpeed);
+        if (refined.ok)
+        {
+            const double range3d = std::sqrt(refined.aim.east * refined.aim.east + refined.aim.north * refined.aim.north + refined.aim.up * refined.aim.up);
+            maxResidual = std::max(maxResidual, std::abs(range3d - s.missileSpeed * refined.time));
+            maxShift = std::max(maxShift, std::abs(refined.time - closed.time));
+        }
+    }
+
+    double sink = 0.0;
+    const double legacyNs = nsPerCall(cases, 1, legacyScan, sink);
+    const double flatNs = nsPerCall(cases, 200, solveWith(flatSolver), sink);
+    const double refineNs = nsPerCall(cases, 200, solveWith(refineSolver), sink);
+
+    std::printf("cases %d (seed %u)\n", numCases, seed);
+    std::printf("  legacy scan     : %10.1f ns/call\n", legacyNs);
+    std::printf("  closed form     : %10.1f ns/call (x%.0f)\n", flatNs, legacyNs / flatNs);
+    std::printf("  closed + Newton : %10.1f ns/call (x%.0f)\n", refineNs, legacyNs / refineNs);
+    std::printf("accuracy\n");
+    std::printf("  both solved %d, legacy only %d, solver only %d\n", agree, legacyOnly, solverOnly);
+    std::printf("  max |t_legacy - t_closed| : %.3f s\n", maxTimeDiff);
+    std::printf("  max 3D residual (Newton)  : %.3e m\n", maxResidual);
+    std::printf("  max altitude/climb shift  : %.3f s\n", maxShift);
+    std::printf("(sink %.1f)\n", sink);
+    return 0;
+}
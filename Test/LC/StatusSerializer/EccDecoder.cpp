@@ -0,0 +1,100 @@
+#include "EccDecoder.h"
+#include "Trace.h" // ECC 소스가 포함하기 전에 전역 이름공간에 먼저 포함
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+// ECC 소스를 별도 이름공간으로 감싸 LC 쪽 동명 구조체와 분리
+namespace ecc
+{
+#include "Deserializer.cpp"
+#include "PacketParser.cpp"
+}
+
+namespace eccdecode
+{
+    namespace
+    {
+        struct Buffers
+        {
+            std::vector<ecc::RadarStatus> radars;
+            std::vector<ecc::LCStatus> lcs;
+            std::vector<ecc::LSStatus> lss;
+            std::vector<ecc::TargetStatus> targets;
+            std::vector<ecc::MissileStatus> missiles;
+            ecc::StatusTrace trace;
+
+            bool run(const uint8_t *data, size_t len)
+            {
+                return ecc::DeserializeStatusResponse(data, len, radars, lcs, lss, targets, missiles, &trace);
+            }
+        };
+    }
+
+    namespace
+    {
+        void convert(const std::vector<ecc::RadarStatus> &radars, const std::vector<ecc::LCStatus> &lcs,
+                     const std::vector<ecc::LSStatus> &lss, const std::vector<ecc::TargetStatus> &targets,
+                     const std::vector<ecc::MissileStatus> &missiles, Decoded &out)
+        {
+            out = Decoded{};
+            for (const auto &r : radars)
+                out.radars.push_back(Unit{r.id, r.position.x, r.position.y, r.position.z, r.mode, r.angle});
+            for (const auto &l : lss)
+                out.lss.push_back(Unit{l.id, l.position.x, l.position.y, l.position.z, l.mode, l.angle});
+            for (const auto &l : lcs)
+                out.lcs.push_back(Unit{l.id, l.position.x, l.position.y, l.position.z, 0, 0.0});
+            for (const auto &m : missiles)
+                out.missiles.push_back(Missile{m.id, m.position.x, m.position.y, m.position.z, m.speed, m.angle,
+                                               m.predicted_time, m.intercept_time, m.hit});
+            for (const auto &t : targets)
+                out.targets.push_back(Target{t.id, t.position.x, t.position.y, t.position.z, t.speed, t.angle1, t.angle2,
+                                             t.first_detect_time, t.priority, t.hit});
+        }
+    }
+
+    bool decode(const uint8_t *data, size_t len, Decoded &out)
+    {
+        Buffers b;
+        if (!b.run(data, len))
+            return false;
+        convert(b.radars, b.lcs, b.lss, b.targets, b.missiles, out);
+        out.traceId = b.trace.id;
+        out.traceOriginUs = b.trace.originUs;
+        return true;
+    }
+
+    bool applyDelta(const uint8_t *data, size_t len, Applied &out)
+    {
+        try
+        {
+            ecc::ParsedPacket parsed = ecc::PacketParser::Parse(reinterpret_cast<const char *>(data), len);
+            const auto *r = std::get_if<ecc::ParsedStatusResponse>(&parsed);
+            if (r == nullptr)
+                return false;
+            convert(r->radarList, r->lcList, r->lsList, r->targetList, r->missileList, out.status);
+            out.status.traceId = r->trace.id;
+            out.status.traceOriginUs = r->trace.originUs;
+            out.pushVersion = r->pushVersion;
+            out.resyncRequired = r->resyncRequired;
+            return true;
+        }
+        catch (const std::exception &)
+        {
+            return false;
+        }
+    }
+
+    long decodeOnly(const uint8_t *data, size_t len)
+    {
+        static Buffers b;
+        return b.run(data, len) ? static_cast<long>(b.targets.size()) : -1;
+    }
+}
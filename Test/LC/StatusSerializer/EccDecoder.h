@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ECC의 DeserializeStatusResponse 결과를 LC 타입과 이름이 겹치지 않는 평범한 구조체로 전달
+// (ECC와 LC 모두 전역 TargetStatus/MissileStatus 등을 정의하므로 ECC 코드는 EccDecoder.cpp 안에서만 사용)
+namespace eccdecode
+{
+    struct Unit
+    {
+        unsigned int id;
+        long long x, y, z;
+        uint8_t mode;
+        double angle;
+    };
+
+    struct Missile
+    {
+        unsigned int id;
+        long long x, y, z;
+        int speed;
+        double angle;
+        unsigned long long predictedTime;
+        unsigned long long interceptTime;
+        bool hit;
+    };
+
+    struct Target
+    {
+        unsigned int id;
+        long long x, y, z;
+        int speed;
+        double angle1, angle2;
+        unsigned long long detectTime;
+        uint8_t priority;
+        bool hit;
+    };
+
+    struct Decoded
+    {
+        std::vector<Unit> radars;
+        std::vector<Unit> lss;
+        std::vector<Unit> lcs; // mode/angle 미사용
+        std::vector<Missile> missiles;
+        std::vector<Target> targets;
+        uint32_t traceId = 0; // v2 / 푸시 FLAG_TRACE만
+        uint64_t traceOriginUs = 0;
+    };
+
+    bool decode(const uint8_t *data, size_t len, Decoded &out);
+
+    // 상태 푸시(0x57)를 ECC PacketParser로 적용한 뒤의 전체 목록 (표적/미사일은 id 순)
+    struct Applied
+    {
+        Decoded status;
+        uint32_t pushVersion = 0;
+        bool resyncRequired = false;
+    };
+    bool applyDelta(const uint8_t *data, size_t len, Applied &out);
+
+    // 벤치마크용: ECC 함수만 호출 (내부 vector 재사용), 표적 수 반환, 실패 시 -1
+    long decodeOnly(const uint8_t *data, size_t len);
+}
@@ -0,0 +1,193 @@
+// LC StatusDeltaEncoder(0x57) → ECC PacketParser 적용 결과가 같은 시점의 전체 상태와 일치하는지 검증
+// (키프레임, 변경분, 삭제, 무변경 생략, ack 흐름 제어, 유실 후 재동기)
+#include "EccDecoder.h"
+#include "Serializer.h"
+#include "StatusDeltaEncoder.h"
+#include "StatusFixture.h"
+#include "StatusStore.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using Common::Serializer;
+
+namespace
+{
+    int failures = 0;
+    int cases = 0;
+
+    void check(bool ok, const char *what, int tick)
+    {
+        ++cases;
+        if (!ok)
+        {
+            ++failures;
+            std::printf("FAIL  tick=%d : %s\n", tick, what);
+        }
+    }
+
+    bool sameUnit(const eccdecode::Unit &a, const eccdecode::Unit &b)
+    {
+        return a.id == b.id && a.x == b.x && a.y == b.y && a.z == b.z && a.mode == b.mode && a.angle == b.angle;
+    }
+
+    bool sameMissile(const eccdecode::Missile &a, const eccdecode::Missile &b)
+    {
+        return a.id == b.id && a.x == b.x && a.y == b.y && a.z == b.z && a.speed == b.speed && a.angle == b.angle &&
+               a.predictedTime == b.predictedTime && a.interceptTime == b.interceptTime && a.hit == b.hit;
+    }
+
+    bool sameTarget(const eccdecode::Target &a, const eccdecode::Target &b)
+    {
+        return a.id == b.id && a.x == b.x && a.y == b.y && a.z == b.z && a.speed == b.speed && a.angle1 == b.angle1 &&
+               a.angle2 == b.angle2 && a.detectTime == b.detectTime && a.priority == b.priority && a.hit == b.hit;
+    }
+
+    template <typename T, typename Same>
+    bool sameList(const std::vector<T> &a, const std::vector<T> &b, Same same)
+    {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), same);
+    }
+
+    // 같은 상태를 전체 응답(v2)으로 보냈을 때 ECC가 얻는 목록 (id 순 정렬)
+    eccdecode::Decoded expected(const SystemStatus &s)
+    {
+        std::vector<uint8_t> buf;
+        Serializer::serializeStatusResponse(s, buf, Serializer::STATUS_V2);
+        eccdecode::Decoded d;
+        eccdecode::decode(buf.data(), buf.size(), d);
+        std::sort(d.missiles.begin(), d.missiles.end(), [](const auto &a, const auto &b) { return a.id < b.id; });
+        std::sort(d.targets.begin(), d.targets.end(), [](const auto &a, const auto &b) { return a.id < b.id; });
+        return d;
+    }
+
+    bool matches(const eccdecode::Applied &applied, const SystemStatus &s)
+    {
+        const eccdecode::Decoded e = expected(s);
+        const eccdecode::Decoded &d = applied.status;
+        return sameList(d.radars, e.radars, sameUnit) && sameList(d.lss, e.lss, sameUnit) &&
+               sameList(d.lcs, e.lcs, sameUnit) && sameList(d.missiles, e.missiles, sameMissile) &&
+               sameList(d.targets, e.targets, sameTarget);
+    }
+
+    // 한 주기 동안의 변화: 표적 일부 이동/삭제/추가, 가끔 레이더 각도·계산 시각 변경
+    void mutate(SystemStatus &s, std::mt19937 &rng, unsigned &nextId)
+    {
+        std::uniform_int_distribution<int> pct(0, 99);
+        std::vector<unsigned> removed;
+        for (auto &t : s.targets)
+        {
+            const int r = pct(rng);
+            if (r < 10)
+                t.posX += 100;
+            else if (r < 12)
+                removed.push_back(t.id);
+        }
+        for (unsigned id : removed)
+            s.targets.erase(id);
+        if (pct(rng) < 30)
+        {
+            TargetStatus t{};
+            t.id = nextId++;
+            t.posX = rng();
+            t.priority = static_cast<uint8_t>(rng());
+            s.targets.upsert(t);
+        }
+        for (auto &m : s.missiles)
+        {
+            if (pct(rng) < 50)
+                m.posY += 10;
+        }
+        if (pct(rng) < 20)
+            s.mfr.degree += 1.0;
+        if (pct(rng) < 5)
+            s.lc.calculated_time += 1000;
+    }
+}
+
+int main()
+{
+    StatusStore store;
+    store.update([](SystemStatus &s) { s = makeStatus(200, 4, 7); });
+
+    StatusDeltaEncoder encoder(20);
+    std::vector<uint8_t> packet;
+    eccdecode::Applied applied;
+
+    // 구독 전에는 보내지 않음
+    check(!encoder.encode(store.snapshot(), packet), "sent before subscribe", 0);
+
+    // 구독 → 첫 푸시는 키프레임
+    encoder.acknowledge(0);
+    check(encoder.encode(store.snapshot(), packet), "no keyframe after subscribe", 0);
+    check(packet[5] & StatusDeltaEncoder::FLAG_KEYFRAME, "first push not keyframe", 0);
+    check(eccdecode::applyDelta(packet.data(), packet.size(), applied) && matches(applied, *store.snapshot()),
+          "keyframe apply", 0);
+    encoder.acknowledge(applied.pushVersion);
+
+    // 변화 없으면 생략
+    check(!encoder.encode(store.snapshot(), packet), "sent without changes", 0);
+
+    // 변경분 적용 결과가 매 시점 전체 상태와 같아야 한다
+    std::mt19937 rng(3);
+    unsigned nextId = 900000;
+    size_t deltaBytes = 0, fullBytes = 0;
+    int keyframes = 0;
+    for (int tick = 1; tick <= 400; ++tick)
+    {
+        store.update([&](SystemStatus &s)
+                     {
+                         mutate(s, rng, nextId);
+                         s.trace = trace::Context{static_cast<uint32_t>(tick), 1700000000000000ull + tick};
+                     });
+        if (!encoder.encode(store.snapshot(), packet))
+            continue;
+        keyframes += (packet[5] & StatusDeltaEncoder::FLAG_KEYFRAME) ? 1 : 0;
+        deltaBytes += packet.size();
+        fullBytes += Serializer::statusResponseSize(*store.snapshot(), Serializer::STATUS_V2);
+
+        const bool ok = eccdecode::applyDelta(packet.data(), packet.size(), applied);
+        check(ok && !applied.resyncRequired && matches(applied, *store.snapshot()), "delta apply", tick);
+        check(ok && applied.status.traceId == static_cast<uint32_t>(tick), "delta trace", tick);
+        // ack는 3번에 1번만 (MAX_UNACKED 안쪽이면 계속 보내야 한다)
+        if (tick % 3 == 0)
+            encoder.acknowledge(applied.pushVersion);
+    }
+    check(keyframes >= 400 / 20 - 1, "periodic keyframes", 400);
+    check(deltaBytes * 4 < fullBytes, "delta not smaller than full", 400);
+
+    // ack가 없으면 MAX_UNACKED개에서 멈춘다
+    encoder.acknowledge(encoder.version());
+    uint32_t sent = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        store.update([](SystemStatus &s) { s.mfr.degree += 1.0; });
+        if (!encoder.encode(store.snapshot(), packet))
+            break;
+        eccdecode::applyDelta(packet.data(), packet.size(), applied);
+        ++sent;
+    }
+    check(sent == StatusDeltaEncoder::MAX_UNACKED, "flow control", 0);
+    encoder.acknowledge(applied.pushVersion);
+
+    // 한 건 유실 → ECC는 재동기 요청, 구독(0) 후 키프레임으로 복구
+    store.update([](SystemStatus &s) { s.mfr.degree += 1.0; });
+    check(encoder.encode(store.snapshot(), packet), "lost delta not sent", 0);
+    store.update([](SystemStatus &s) { s.targets.erase(s.targets[0].id); });
+    check(encoder.encode(store.snapshot(), packet), "next delta not sent", 0);
+    check(eccdecode::applyDelta(packet.data(), packet.size(), applied) && applied.resyncRequired, "gap not detected", 0);
+    encoder.acknowledge(0);
+    check(encoder.encode(store.snapshot(), packet) && (packet[5] & StatusDeltaEncoder::FLAG_KEYFRAME), "resync keyframe", 0);
+    check(eccdecode::applyDelta(packet.data(), packet.size(), applied) && !applied.resyncRequired &&
+              matches(applied, *store.snapshot()),
+          "resync apply", 0);
+
+    // 잘린 패킷은 거부
+    check(!eccdecode::applyDelta(packet.data(), packet.size() - 1, applied), "truncated delta accepted", 0);
+
+    std::printf("push bytes %zu vs full v2 %zu (%.1f%%)\n", deltaBytes, fullBytes, 100.0 * deltaBytes / fullBytes);
+    std::printf("%d checks, %d failures\n", cases, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "SystemStatus.h"
+
+#include <random>
+
+// 무작위 값으로 채운 상태 (표적 numTargets개, 미사일 numMissiles개)
+inline SystemStatus makeStatus(size_t numTargets, size_t numMissiles, unsigned seed = 1)
+{
+    std::mt19937_64 rng(seed);
+    auto i64 = [&]() { return static_cast<long long>(rng()); };
+    auto f64 = [&]() { return static_cast<double>(rng() % 3600000) / 10000.0; };
+
+    SystemStatus s;
+    s.mfr = MFRStatus{105001, MFRMode::ROTATE, f64(), Pos2D{i64(), i64()}, i64()};
+    s.ls = LSStatus{106001, LauncherMode::WAR, f64(), Pos2D{i64(), i64()}, i64(), 4000};
+    s.lc = LCStatus{103001, Pos2D{i64(), i64()}, i64(), rng()};
+
+    for (size_t i = 0; i < numMissiles; ++i)
+    {
+        MissileStatus m{};
+        m.id = 105001 + static_cast<unsigned>(i);
+        m.posX = i64();
+        m.posY = i64();
+        m.altitude = i64();
+        m.speed = static_cast<int>(rng());
+        m.angle = f64();
+        m.detectTime = rng();
+        m.interceptTime = rng();
+        m.hit = rng() & 1;
+        s.missiles.upsert(m);
+    }
+    for (size_t i = 0; i < numTargets; ++i)
+    {
+        TargetStatus t{};
+        t.id = 104001 + static_cast<unsigned>(i);
+        t.posX = i64();
+        t.posY = i64();
+        t.altitude = i64();
+        t.speed = static_cast<int>(rng());
+        t.angle1 = f64();
+        t.angle2 = f64();
+        t.detectTime = rng();
+        t.priority = static_cast<uint8_t>(rng());
+        t.hit = rng() & 1;
+        s.targets.upsert(t);
+    }
+    return s;
+}
@@ -0,0 +1,120 @@
+// LC Serializer 상태 응답(v1 0x51 / v2 0x56) → ECC DeserializeStatusResponse 왕복 검증
+#include "EccDecoder.h"
+#include "LegacyStatusSerializer.h"
+#include "Serializer.h"
+#include "StatusFixture.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using Common::Serializer;
+
+namespace
+{
+    int failures = 0;
+
+    void check(bool ok, const char *what, size_t nTargets, int version)
+    {
+        if (!ok)
+        {
+            ++failures;
+            std::printf("FAIL  v%d targets=%zu : %s\n", version, nTargets, what);
+        }
+    }
+
+    bool sameUnit(const eccdecode::Unit &u, unsigned id, const Pos2D &p, long long z)
+    {
+        return u.id == id && u.x == p.x && u.y == p.y && u.z == z;
+    }
+
+    void roundTrip(size_t nTargets, size_t nMissiles, int version)
+    {
+        SystemStatus s = makeStatus(nTargets, nMissiles, static_cast<unsigned>(nTargets * 31 + version));
+        s.trace = trace::Context{static_cast<uint32_t>(nTargets + 1), 1700000000000000ull + nTargets};
+        const size_t limit = version == Serializer::STATUS_V2 ? 0xFFFF : 0xFF;
+        const size_t expTargets = std::min(nTargets, limit);
+        const size_t expMissiles = std::min(nMissiles, limit);
+
+        // 크기 선계산 = 실제 기록 크기, 모자란 버퍼는 거부
+        const size_t size = Serializer::statusResponseSize(s, version);
+        std::vector<uint8_t> buf(size + 16, 0xCD);
+        check(Serializer::writeStatusResponse(s, buf.data(), size - 1, version) == 0, "short buffer accepted", nTargets, version);
+        check(Serializer::writeStatusResponse(s, buf.data(), buf.size(), version) == size, "written size", nTargets, version);
+        check(std::all_of(buf.begin() + size, buf.end(), [](uint8_t b) { return b == 0xCD; }), "overrun", nTargets, version);
+        buf.resize(size);
+
+        std::vector<uint8_t> reused;
+        Serializer::serializeStatusResponse(s, reused, version);
+        check(reused == buf, "vector overload differs", nTargets, version);
+
+        // v1은 255개 이하에서 기존 구현과 바이트 단위로 동일해야 한다
+        if (version == Serializer::STATUS_V1 && nTargets <= 0xFF && nMissiles <= 0xFF)
+            check(legacy::serializeStatusResponse(s) == buf, "v1 differs from legacy bytes", nTargets, version);
+
+        eccdecode::Decoded d;
+        if (!eccdecode::decode(buf.data(), buf.size(), d))
+        {
+            check(false, "ECC decode failed", nTargets, version);
+            return;
+        }
+
+        check(d.radars.size() == 1 && sameUnit(d.radars[0], s.mfr.mfrId, s.mfr.position, s.mfr.height) &&
+                  d.radars[0].angle == s.mfr.degree,
+              "radar", nTargets, version);
+        check(d.lss.size() == 1 && sameUnit(d.lss[0], s.ls.launchSystemId, s.ls.position, s.ls.height) &&
+                  d.lss[0].angle == s.ls.launchAngle,
+              "ls", nTargets, version);
+        check(d.lcs.size() == 1 && sameUnit(d.lcs[0], s.lc.LCId, s.lc.position, 15), "lc", nTargets, version);
+        if (version == Serializer::STATUS_V2)
+            check(d.traceId == s.trace.id && d.traceOriginUs == s.trace.originUs, "trace", nTargets, version);
+
+        check(d.missiles.size() == expMissiles, "missile count", nTargets, version);
+        for (size_t i = 0; i < std::min(d.missiles.size(), expMissiles); ++i)
+        {
+            const auto &a = d.missiles[i];
+            const auto &m = s.missiles[i];
+            if (!(a.id == m.id && a.x == m.posX && a.y == m.posY && a.z == m.altitude && a.speed == m.speed &&
+                  a.angle == m.angle && a.predictedTime == s.lc.calculated_time && a.interceptTime == m.interceptTime && a.hit == m.hit))
+            {
+                check(false, "missile record", nTargets, version);
+                break;
+            }
+        }
+
+        check(d.targets.size() == expTargets, "target count", nTargets, version);
+        for (size_t i = 0; i < std::min(d.targets.size(), expTargets); ++i)
+        {
+            const auto &a = d.targets[i];
+            const auto &t = s.targets[i];
+            if (!(a.id == t.id && a.x == t.posX && a.y == t.posY && a.z == t.altitude && a.speed == t.speed &&
+                  a.angle1 == t.angle1 && a.angle2 == t.angle2 && a.detectTime == t.detectTime &&
+                  a.priority == t.priority && a.hit == t.hit))
+            {
+                check(false, "target record", nTargets, version);
+                break;
+            }
+        }
+
+        // 잘린 패킷은 ECC에서 거부
+        check(!eccdecode::decode(buf.data(), buf.size() - 1, d), "truncated packet accepted", nTargets, version);
+    }
+}
+
+int main()
+{
+    const size_t counts[] = {0, 1, 7, 255, 256, 1000, 20000};
+    int cases = 0;
+    for (int version : {Serializer::STATUS_V1, Serializer::STATUS_V2})
+    {
+        for (size_t n : counts)
+        {
+            roundTrip(n, n / 3 + 1, version);
+            roundTrip(n, 0, version);
+            cases += 2;
+        }
+    }
+
+    std::printf("%d cases, %d failures\n", cases, failures);
+    return failures == 0 ? 0 : 1;
+}
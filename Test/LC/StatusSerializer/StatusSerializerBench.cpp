@@ -0,0 +1,54 @@
+// 상태 응답 직렬화 벤치마크
+//   legacy : 기존 push_back/insert 직렬화 (호출마다 새 vector)
+//   v1/v2  : 크기 선계산 + 커서 기록, 재사용 버퍼 (할당 없음)
+//   ecc    : ECC DeserializeStatusResponse (v2 패킷, 내부 vector 재사용)
+//   ./status_serializer_bench [iterations=20000]
+#include "EccDecoder.h"
+#include "LegacyStatusSerializer.h"
+#include "Serializer.h"
+#include "StatusFixture.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using Common::Serializer;
+
+namespace
+{
+    template <typename Fn>
+    double nsPerOp(int iterations, Fn fn)
+    {
+        fn(); // 워밍업
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            fn();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / iterations;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int iterations = argc > 1 ? std::atoi(argv[1]) : 20000;
+    volatile size_t sink = 0;
+
+    std::printf("%8s %8s %12s %12s %12s %12s\n", "targets", "bytes", "legacy ns", "v1 ns", "v2 ns", "ecc ns");
+    for (size_t n : {10, 50, 100, 255, 1000})
+    {
+        const SystemStatus s = makeStatus(n, 4);
+        const int iters = static_cast<int>(iterations * 50 / (n + 50));
+
+        const double legacyNs = nsPerOp(iters, [&]() { sink = sink + legacy::serializeStatusResponse(s).size(); });
+
+        std::vector<uint8_t> v1, v2;
+        const double v1Ns = nsPerOp(iters, [&]()
+                                    { Serializer::serializeStatusResponse(s, v1, Serializer::STATUS_V1); sink = sink + v1.size(); });
+        const double v2Ns = nsPerOp(iters, [&]()
+                                    { Serializer::serializeStatusResponse(s, v2, Serializer::STATUS_V2); sink = sink + v2.size(); });
+        const double eccNs = nsPerOp(iters, [&]() { sink = sink + static_cast<size_t>(eccdecode::decodeOnly(v2.data(), v2.size())); });
+
+        std::printf("%8zu %8zu %12.0f %12.0f %12.0f %12.0f\n", n, v2.size(), legacyNs, v1Ns, v2Ns, eccNs);
+    }
+    return sink == 0 ? 1 : 0;
+}
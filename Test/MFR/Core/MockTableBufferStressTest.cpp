@@ -0,0 +1,197 @@
+// MockTableBuffer(무잠금 3중 버퍼) 쓰기 1개 / 읽기 1개 동시 실행 검증
+// - 배치 b마다 정해진 슬롯을 값 b로 갱신하고 trace.id = b로 게시 → 배치 번호만으로 표 전체의 기대값이 정해짐
+// - 읽기 측은 acquire()한 표가 한 배치 안에서 일관되고(찢어진 표 없음), 직전에 게시가 확인된 배치보다 오래되지 않는지 확인
+// - 쓰기가 읽기보다 한참 앞서는 구간과 거의 매 배치를 읽는 구간을 번갈아 실행
+// - 일부 배치는 한 슬롯을 LOG_CAPACITY보다 많이 갱신해 쓰기 로그가 덮어써지게 함
+//   (그 사이 다른 슬롯 갱신은 로그에서 사라지므로 전체 복사 경로가 없으면 오래된 값이 보임)
+#include "MockTableBuffer.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    constexpr unsigned int ID_BASE = 104001;
+    constexpr uint64_t BATCHES = 4000;
+    constexpr uint64_t BURST_EVERY = 40;
+    constexpr int BURST_UPDATES = 4200; // LOG_CAPACITY(4096)보다 많게
+    constexpr size_t HOT_SLOT = 0;
+    constexpr uint64_t PHASE = 500; // 홀수 구간은 쓰기가 읽기를 최대 2배치 앞서도록 맞춤, 짝수 구간은 제한 없음
+
+    std::atomic<int> failures{0};
+
+    void fail(const char *what, uint64_t batch, size_t slot)
+    {
+        if (failures.fetch_add(1) < 10)
+            std::printf("FAIL  batch=%llu slot=%zu : %s\n", static_cast<unsigned long long>(batch), slot, what);
+    }
+
+    // 슬롯 s는 배치 s / 4 + 1에 처음 등록 (250번째 배치부터 999개 모두 사용)
+    uint64_t firstBatch(size_t slot) { return slot / 4 + 1; }
+
+    bool updatedIn(uint64_t batch, size_t slot)
+    {
+        const uint64_t first = firstBatch(slot);
+        if (batch < first)
+            return false;
+        if (batch == first)
+            return true;
+        if (slot == HOT_SLOT && batch % BURST_EVERY == 0)
+            return true;
+        return (slot * 7 + batch) % 13 == 0;
+    }
+
+    // 배치 batch 게시 시점에 슬롯의 마지막 갱신 배치 (0: 등록 전)
+    uint64_t lastUpdate(uint64_t batch, size_t slot)
+    {
+        for (uint64_t b = batch; b >= firstBatch(slot); --b)
+        {
+            if (updatedIn(b, slot))
+                return b;
+        }
+        return 0;
+    }
+
+    localMockSimData makeMock(uint64_t batch, size_t slot)
+    {
+        localMockSimData mock{};
+        mock.mockId = ID_BASE + static_cast<unsigned int>(slot);
+        mock.mockCoords = Pos3D{static_cast<double>(batch), static_cast<double>(slot),
+                                static_cast<double>(batch * 1000 + slot)};
+        mock.angle = static_cast<double>(batch);
+        mock.angle2 = static_cast<double>(slot);
+        mock.speed = static_cast<int>(batch);
+        mock.isHit = ((batch + slot) & 1) != 0;
+        return mock;
+    }
+
+    bool sameMock(const localMockSimData &a, const localMockSimData &b)
+    {
+        return a.mockId == b.mockId && a.mockCoords.latitude == b.mockCoords.latitude &&
+               a.mockCoords.longitude == b.mockCoords.longitude && a.mockCoords.altitude == b.mockCoords.altitude &&
+               a.angle == b.angle && a.angle2 == b.angle2 && a.speed == b.speed && a.isHit == b.isHit;
+    }
+
+    void writeBatch(MockTableBuffer &buffer, uint64_t batch)
+    {
+        if (batch % BURST_EVERY == 0 && batch >= firstBatch(HOT_SLOT))
+        {
+            // 같은 슬롯만 반복 갱신해 로그를 한 바퀴 이상 돌림 (값은 모두 이 배치의 값)
+            for (int i = 0; i < BURST_UPDATES; ++i)
+                buffer.upsert(makeMock(batch, HOT_SLOT));
+        }
+        for (size_t slot = 0; slot < MockTable::SLOT_COUNT; ++slot)
+        {
+            if (updatedIn(batch, slot))
+                buffer.upsert(makeMock(batch, slot));
+        }
+        trace::Context trace;
+        trace.id = static_cast<uint32_t>(batch);
+        trace.originUs = batch;
+        buffer.setTrace(trace);
+        buffer.publish();
+    }
+
+    // 표 전체가 배치 trace.id의 기대값과 같은지
+    void verify(const MockTable &table)
+    {
+        const uint64_t batch = table.trace.id;
+        if (table.trace.originUs != batch || table.syncedHead == 0)
+        {
+            fail("trace/head mismatch", batch, 0);
+            return;
+        }
+
+        size_t present = 0;
+        for (size_t slot = 0; slot < MockTable::SLOT_COUNT; ++slot)
+        {
+            const uint64_t last = lastUpdate(batch, slot);
+            const localMockSimData *mock = table.find(ID_BASE + static_cast<unsigned int>(slot));
+            if (last == 0)
+            {
+                if (mock != nullptr)
+                    fail("slot present before registration", batch, slot);
+                continue;
+            }
+            ++present;
+            if (mock == nullptr)
+                fail("registered slot missing", batch, slot);
+            else if (!sameMock(*mock, makeMock(last, slot)))
+                fail(mock->speed < static_cast<int>(last) ? "stale slot" : "torn slot", batch, slot);
+        }
+
+        // 등록 순서 = 슬롯 번호 순서
+        if (table.active.size() != present)
+            fail("active size", batch, table.active.size());
+        for (size_t i = 0; i < table.active.size() && i < present; ++i)
+        {
+            if (table.active[i] != i)
+            {
+                fail("active order", batch, i);
+                break;
+            }
+        }
+    }
+}
+
+int main()
+{
+    MockTableBuffer buffer(ID_BASE);
+    std::atomic<uint64_t> published{0};
+    std::atomic<uint64_t> seen{0};
+    std::atomic<bool> done{false};
+    uint64_t reads = 0;
+    uint64_t distinct = 0;
+
+    std::thread reader([&]()
+                       {
+                           uint64_t last = 0;
+                           while (true)
+                           {
+                               // acquire 전에 게시가 확인된 배치는 반드시 보여야 함
+                               const bool finished = done.load(std::memory_order_acquire);
+                               const uint64_t floor = published.load(std::memory_order_acquire);
+                               const MockTable &table = buffer.acquire();
+                               const uint64_t batch = table.trace.id;
+                               if (batch < floor)
+                                   fail("older than published", batch, 0);
+                               if (batch < last)
+                                   fail("went backwards", batch, 0);
+                               if (batch != 0 && batch != last)
+                               {
+                                   verify(table);
+                                   ++distinct;
+                               }
+                               else
+                               {
+                                   std::this_thread::yield(); // 코어가 적을 때 쓰기 측에 양보
+                               }
+                               last = batch;
+                               seen.store(batch, std::memory_order_release);
+                               ++reads;
+                               if (finished)
+                                   break;
+                           }
+                           if (last != BATCHES)
+                               fail("final batch not seen", last, 0);
+                       });
+
+    for (uint64_t batch = 1; batch <= BATCHES; ++batch)
+    {
+        writeBatch(buffer, batch);
+        published.store(batch, std::memory_order_release);
+        if ((batch / PHASE) % 2 == 1)
+        {
+            while (seen.load(std::memory_order_acquire) + 2 < batch)
+                std::this_thread::yield();
+        }
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    std::printf("%llu batches, %llu reads (%llu distinct)\n", static_cast<unsigned long long>(BATCHES),
+                static_cast<unsigned long long>(reads), static_cast<unsigned long long>(distinct));
+    std::printf("%d failures\n", failures.load());
+    return failures.load() == 0 ? 0 : 1;
+}